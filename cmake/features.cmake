@@ -34,7 +34,9 @@ Supported values:\
  FIRST_INFERENCE - enable only first inference time counters" ALL
                ALLOWED_VALUES ALL FIRST_INFERENCE)
 
-ie_option (ENABLE_PROFILING_FIRST_INFERENCE "Build with ITT tracing of first inference time." ON)
+ie_option (ENABLE_PROFILING_FIRST_INFERENCE "Build with tracing of first inference time, feeds ITT and the startup profile of the compiled models." ON)
+
+ie_option (ENABLE_PROFILING_TRACE "Build all the ITT counters without ITT for the built-in tracer enabled at runtime by OPENVINO_TRACE_FILE environment variable, the per-node scopes of the inference are built without it." OFF)
 
 ie_option_enum(SELECTIVE_BUILD "Enable OpenVINO conditional compilation or statistics collection. \
 In case SELECTIVE_BUILD is enabled, the SELECTIVE_BUILD_STAT variable should contain the path to the collected InelSEAPI statistics. \
@@ -142,6 +142,12 @@ static const char json_stats_message[] = "Optional. Enables JSON-based statistic
 static const char exec_graph_path_message[] =
     "Optional. Path to a file where to store executable graph information serialized.";
 
+// @brief message for startup_report option
+static const char startup_report_message[] =
+    "Optional. Path to a JSON file where to store the startup report: read, compile and first inference "
+    "times and the breakdown of the model compilation and of the first inference into phases with the "
+    "resident and peak memory of each phase.";
+
 // @brief message for progress bar option
 static const char progress_message[] =
     "Optional. Show progress bar (can affect performance measurement). Default values is "
@@ -228,6 +234,25 @@ static constexpr char inference_only_message[] =
     " To enable full mode for static models pass \"false\" value to this argument:"
     " ex. \"-inference_only=false\".\n";
 
+static constexpr char arrival_message[] =
+    "Optional. Enables the open-loop mode: the requests are submitted at the arrival times regardless of the "
+    "completion of the previous ones and wait in a queue when all the infer requests are busy. The arrival "
+    "process is \"poisson\" or \"constant\" inter-arrival times at the -rate rate or the path to a trace "
+    "file with one arrival time in milliseconds per line. Queueing and service latencies are reported separately.";
+
+static constexpr char rate_message[] = "Optional. Target rate of the open-loop mode in requests per second.";
+
+static constexpr char sla_p99_message[] =
+    "Optional. p99 latency SLA in milliseconds. Searches the maximal rate of the open-loop mode whose p99 "
+    "latency (queueing plus service) meets the SLA, starting from the -rate rate if it is set. "
+    "Each tried rate is run with the -t/-niter limits.";
+
+static constexpr char models_spec_message[] =
+    "Optional. Path to a JSON spec of several models to benchmark concurrently in one process with the shared core "
+    "instead of the -m model. Each model has its own \"path\", \"device\", \"hint\", \"nireq\", \"rate\" "
+    "(open-loop mode if set), \"arrival\" and \"config\". Per-model and aggregate throughput, latency and memory "
+    "footprint are reported.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -242,6 +267,9 @@ DEFINE_string(i, "", input_message);
 /// It is a required parameter
 DEFINE_string(m, "", model_message);
 
+/// @brief Define parameter for the spec of the co-located models
+DEFINE_string(models_spec, "", models_spec_message);
+
 /// @brief Define execution mode
 DEFINE_string(hint, "", hint_message);
 
@@ -280,6 +308,15 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Arrival process of the open-loop mode
+DEFINE_string(arrival, "", arrival_message);
+
+/// @brief Target rate of the open-loop mode in requests per second
+DEFINE_double(rate, 0, rate_message);
+
+/// @brief p99 latency SLA for the search of the maximal rate in milliseconds
+DEFINE_double(sla_p99, 0, sla_p99_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint32(b, 0, batch_size_message);
@@ -302,6 +339,9 @@ DEFINE_bool(json_stats, false, json_stats_message);
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
+/// @brief Path to a file where to store the startup report
+DEFINE_string(startup_report, "", startup_report_message);
+
 /// @brief Define flag for showing progress bar <br>
 DEFINE_bool(progress, false, progress_message);
 
@@ -372,6 +412,7 @@ static void show_usage() {
     std::cout << "    -h, --help                " << help_message << std::endl;
     std::cout << "    -m \"<path>\"               " << model_message << std::endl;
     std::cout << "    -i \"<path>\"               " << input_message << std::endl;
+    std::cout << "    -models_spec \"<path>\"     " << models_spec_message << std::endl;
     std::cout << "    -d \"<device>\"             " << target_device_message << std::endl;
     std::cout << "    -l \"<absolute_path>\"      " << custom_cpu_library_message << std::endl;
     std::cout << "          Or" << std::endl;
@@ -390,6 +431,10 @@ static void show_usage() {
     std::cout << "    -cache_dir \"<path>\"       " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << std::endl << "  Open-loop mode options:" << std::endl;
+    std::cout << "    -arrival \"<poisson/constant/path>\" " << arrival_message << std::endl;
+    std::cout << "    -rate \"<float>\"           " << rate_message << std::endl;
+    std::cout << "    -sla_p99 \"<float>\"        " << sla_p99_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -403,6 +448,7 @@ static void show_usage() {
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -json_stats               " << json_stats_message;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
+    std::cout << "    -startup_report           " << startup_report_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
     std::cout << "    -pcseq                    " << pcseq_message << std::endl;
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
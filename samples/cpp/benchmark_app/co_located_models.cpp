@@ -0,0 +1,294 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <exception>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "co_located_models.hpp"
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "open_loop.hpp"
+#include "utils.hpp"
+// clang-format on
+
+namespace {
+/// @brief Resident and peak resident memory of the process in megabytes, zeros if the platform doesn't report them
+struct MemoryUsage {
+    double rss = 0;
+    double peak_rss = 0;
+};
+
+MemoryUsage get_memory_usage() {
+    MemoryUsage usage;
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        // the values are reported in kB
+        if (line.compare(0, 6, "VmRSS:") == 0) {
+            usage.rss = std::stod(line.substr(6)) / 1024.0;
+        } else if (line.compare(0, 6, "VmHWM:") == 0) {
+            usage.peak_rss = std::stod(line.substr(6)) / 1024.0;
+        }
+    }
+#endif
+    return usage;
+}
+
+struct CoLocatedModel {
+    CoLocatedModelSpec spec;
+    ov::CompiledModel compiledModel;
+    std::unique_ptr<InferRequestsQueue> inferRequestsQueue;
+    uint32_t nireq = 0;
+    size_t batchSize = 1;
+    // growth of the resident memory caused by the compilation of the model and the creation of its requests
+    double memory = 0;
+
+    size_t iterations = 0;
+    double duration_ms = 0;
+    std::vector<double> latencies;
+    LatencyDistribution totalLatency;
+    std::exception_ptr error;
+};
+
+ov::AnyMap get_compile_config(const CoLocatedModelSpec& spec) {
+    ov::AnyMap config;
+    if (spec.hint == "throughput" || spec.hint == "tput") {
+        config.emplace(ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT));
+    } else if (spec.hint == "latency") {
+        config.emplace(ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY));
+    } else if (spec.hint != "none") {
+        throw std::logic_error("Incorrect performance hint '" + spec.hint + "' of the model " + spec.name +
+                               ". Please use `throughput`(tput), `latency' or 'none'.");
+    }
+    if (spec.nireq != 0 && spec.hint != "none") {
+        config.emplace(ov::hint::num_requests(spec.nireq));
+    }
+    for (const auto& item : spec.config) {
+        config[item.first] = item.second;
+    }
+    return config;
+}
+
+void compile_model(ov::Core& core, CoLocatedModel& model) {
+    const auto memoryBefore = get_memory_usage();
+    auto startTime = Time::now();
+    model.compiledModel = core.compile_model(model.spec.path, model.spec.device, get_compile_config(model.spec));
+    slog::info << "Model " << model.spec.name << " compiled for " << model.spec.device << " in "
+               << double_to_string(get_duration_ms_till_now(startTime)) << " ms" << slog::endl;
+
+    model.nireq = model.spec.nireq != 0 ? model.spec.nireq
+                                        : model.compiledModel.get_property(ov::optimal_number_of_infer_requests);
+    model.inferRequestsQueue.reset(new InferRequestsQueue(model.compiledModel, model.nireq, 1, false));
+
+    // inference only mode: the inputs are filled once before the measurements
+    auto inputsInfo = get_inputs_info("", "", 0, "", {}, "", "", model.compiledModel.inputs());
+    for (const auto& input : inputsInfo[0]) {
+        if (input.second.partialShape.is_dynamic()) {
+            throw std::logic_error("The model " + model.spec.name +
+                                   " has dynamic shapes which aren't supported by the co-located benchmark.");
+        }
+    }
+    model.batchSize = get_batch_size(inputsInfo[0]);
+    auto inputsData = get_tensors_static_case({}, model.batchSize, inputsInfo[0], model.nireq);
+    for (size_t i = 0; i < model.inferRequestsQueue->requests.size(); i++) {
+        auto& inferRequest = model.inferRequestsQueue->requests[i];
+        for (const auto& input : inputsData) {
+            auto requestTensor = inferRequest->get_tensor(input.first);
+            copy_tensor_data(requestTensor, input.second[i % input.second.size()]);
+        }
+    }
+    model.memory = get_memory_usage().rss - memoryBefore.rss;
+}
+
+void run_model(CoLocatedModel& model, uint32_t duration_seconds, uint32_t niter) {
+    auto& inferRequestsQueue = *model.inferRequestsQueue;
+    if (model.spec.rate > 0) {
+        auto arrivalTimes = get_arrival_times(model.spec.arrival,
+                                              model.spec.rate,
+                                              niter,
+                                              get_duration_in_milliseconds(duration_seconds));
+        auto result = run_open_loop(inferRequestsQueue, arrivalTimes, [](InferReqWrap::Ptr&, size_t) {});
+        model.iterations = result.iterations;
+        model.duration_ms = result.duration_ms;
+        model.latencies = result.service_latencies;
+        model.totalLatency = result.total;
+        return;
+    }
+
+    inferRequestsQueue.reset_times();
+    const uint64_t duration_nanoseconds = get_duration_in_nanoseconds(duration_seconds);
+    auto startTime = Time::now();
+    auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+    size_t iteration = 0;
+    while ((niter != 0LL && iteration < niter) ||
+           (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds)) {
+        auto inferRequest = inferRequestsQueue.get_idle_request();
+        // rethrows the exception of the previous inference
+        inferRequest->wait();
+        inferRequest->start_async();
+        ++iteration;
+        execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+    }
+    inferRequestsQueue.wait_all();
+    model.iterations = iteration;
+    model.duration_ms = inferRequestsQueue.get_duration_in_milliseconds();
+    model.latencies = inferRequestsQueue.get_latencies();
+}
+}  // namespace
+
+CoLocatedModelsSpec read_models_spec(const std::string& filename) {
+    std::ifstream ifs(filename);
+    if (!ifs.is_open()) {
+        throw std::runtime_error("Can't load models spec file \"" + filename + "\".");
+    }
+
+    nlohmann::json jsonSpec;
+    try {
+        ifs >> jsonSpec;
+    } catch (const nlohmann::json::parse_error& e) {
+        throw std::runtime_error("Can't parse models spec file \"" + filename + "\".\n" + e.what());
+    }
+
+    CoLocatedModelsSpec spec;
+    try {
+        spec.duration = jsonSpec.value("duration", 0u);
+        for (const auto& jsonModel : jsonSpec.at("models")) {
+            CoLocatedModelSpec model;
+            model.path = jsonModel.at("path").get<std::string>();
+            model.name = jsonModel.value("name", fileNameNoExt(model.path));
+            model.device = jsonModel.value("device", model.device);
+            model.hint = jsonModel.value("hint", model.hint);
+            model.nireq = jsonModel.value("nireq", model.nireq);
+            model.rate = jsonModel.value("rate", model.rate);
+            model.arrival = jsonModel.value("arrival", model.arrival);
+            if (jsonModel.count("config")) {
+                for (const auto& option : jsonModel.at("config").items()) {
+                    model.config[option.key()] = option.value().get<std::string>();
+                }
+            }
+            spec.models.push_back(model);
+        }
+    } catch (const nlohmann::json::exception& e) {
+        throw std::runtime_error("Incorrect models spec file \"" + filename + "\".\n" + e.what());
+    }
+    if (spec.models.empty()) {
+        throw std::runtime_error("The models spec file \"" + filename + "\" contains no models.");
+    }
+    return spec;
+}
+
+void run_co_located_models(ov::Core& core,
+                           const CoLocatedModelsSpec& spec,
+                           uint32_t duration_seconds,
+                           uint32_t niter,
+                           size_t latency_percentile,
+                           const std::shared_ptr<StatisticsReport>& statistics) {
+    if (spec.duration != 0) {
+        duration_seconds = spec.duration;
+    }
+    if (duration_seconds == 0 && niter == 0) {
+        throw std::logic_error("The co-located benchmark requires the duration or the number of iterations.");
+    }
+
+    // the models are compiled one by one to attribute the growth of the memory to each of them
+    const auto initialMemory = get_memory_usage();
+    std::vector<CoLocatedModel> models(spec.models.size());
+    for (size_t i = 0; i < models.size(); i++) {
+        models[i].spec = spec.models[i];
+        compile_model(core, models[i]);
+    }
+
+    // warming up - out of scope
+    for (auto& model : models) {
+        auto inferRequest = model.inferRequestsQueue->get_idle_request();
+        inferRequest->start_async();
+        model.inferRequestsQueue->wait_all();
+        inferRequest->wait();
+    }
+
+    slog::info << "Start concurrent inference of " << models.size() << " models, limits: "
+               << (duration_seconds ? std::to_string(get_duration_in_milliseconds(duration_seconds)) + " ms duration"
+                                    : std::to_string(niter) + " iterations")
+               << slog::endl;
+    std::vector<std::thread> threads;
+    for (auto& model : models) {
+        threads.emplace_back([&model, duration_seconds, niter] {
+            try {
+                run_model(model, duration_seconds, niter);
+            } catch (...) {
+                model.error = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& model : models) {
+        if (model.error) {
+            std::rethrow_exception(model.error);
+        }
+    }
+
+    const auto finalMemory = get_memory_usage();
+    std::vector<double> allLatencies;
+    double totalThroughput = 0;
+    StatisticsReport::Parameters parameters;
+    for (auto& model : models) {
+        const double fps = 1000.0 * model.iterations * model.batchSize / model.duration_ms;
+        totalThroughput += fps;
+        allLatencies.insert(allLatencies.end(), model.latencies.begin(), model.latencies.end());
+        LatencyMetrics latency(model.latencies, "", latency_percentile);
+
+        slog::info << "Model " << model.spec.name << " (" << model.spec.device << ", " << model.nireq
+                   << " infer requests, "
+                   << (model.spec.rate > 0 ? double_to_string(model.spec.rate) + " requests/s " + model.spec.arrival
+                                           : std::string("closed loop"))
+                   << "):" << slog::endl;
+        slog::info << "Count:      " << model.iterations << " iterations" << slog::endl;
+        slog::info << "Duration:   " << double_to_string(model.duration_ms) << " ms" << slog::endl;
+        slog::info << "Latency: " << slog::endl;
+        latency.write_to_slog();
+        if (!model.totalLatency.empty()) {
+            model.totalLatency.write_to_slog("Total (queueing + service)");
+        }
+        slog::info << "Throughput: " << double_to_string(fps) << " FPS" << slog::endl;
+        slog::info << "Memory:     " << double_to_string(model.memory) << " MB" << slog::endl;
+
+        const auto& name = model.spec.name;
+        parameters.emplace_back(name + " iterations",
+                                name + "_iterations_num",
+                                static_cast<unsigned long long>(model.iterations));
+        parameters.emplace_back(name + " latency (ms)", name + "_latency_median", latency.median_or_percentile);
+        parameters.emplace_back(name + " average latency (ms)", name + "_latency_avg", latency.avg);
+        parameters.emplace_back(name + " max latency (ms)", name + "_latency_max", latency.max);
+        parameters.emplace_back(name + " throughput", name + "_throughput", fps);
+        parameters.emplace_back(name + " memory (MB)", name + "_memory", model.memory);
+    }
+
+    LatencyMetrics aggregateLatency(allLatencies, "", latency_percentile);
+    slog::info << "All models:" << slog::endl;
+    slog::info << "Latency: " << slog::endl;
+    aggregateLatency.write_to_slog();
+    slog::info << "Throughput: " << double_to_string(totalThroughput) << " FPS" << slog::endl;
+    slog::info << "Memory:     " << double_to_string(finalMemory.rss - initialMemory.rss) << " MB, peak resident "
+               << double_to_string(finalMemory.peak_rss) << " MB" << slog::endl;
+
+    if (statistics) {
+        parameters.emplace_back("latency (ms)", "latency_median", aggregateLatency.median_or_percentile);
+        parameters.emplace_back("Average latency (ms)", "latency_avg", aggregateLatency.avg);
+        parameters.emplace_back("throughput", "throughput", totalThroughput);
+        parameters.emplace_back("memory (MB)", "memory", finalMemory.rss - initialMemory.rss);
+        parameters.emplace_back("peak resident memory (MB)", "peak_memory", finalMemory.peak_rss);
+        statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS, parameters);
+    }
+}
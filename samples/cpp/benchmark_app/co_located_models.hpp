@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <openvino/openvino.hpp>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "statistics_report.hpp"
+// clang-format on
+
+/// @brief Model of the co-located benchmark described by an item of the "models" array of the JSON spec
+struct CoLocatedModelSpec {
+    std::string name;
+    std::string path;
+    std::string device = "CPU";
+    /// @brief "throughput" (default), "latency" or "none"
+    std::string hint = "throughput";
+    /// @brief 0 means the optimal number of requests of the compiled model
+    uint32_t nireq = 0;
+    /// @brief Target rate in requests per second, 0 means the closed-loop mode
+    double rate = 0;
+    /// @brief Arrival process of the open-loop mode, see -arrival option
+    std::string arrival = "poisson";
+    /// @brief Additional properties of the compiled model
+    std::map<std::string, std::string> config;
+};
+
+/// @brief JSON spec of the co-located benchmark
+struct CoLocatedModelsSpec {
+    /// @brief Duration of the concurrent run in seconds, 0 means the -t/-niter limits
+    uint32_t duration = 0;
+    std::vector<CoLocatedModelSpec> models;
+};
+
+/**
+ * @brief Reads the JSON spec of the co-located benchmark, for example:
+ * {
+ *     "duration": 60,
+ *     "models": [
+ *         {"name": "detector", "path": "detector.xml", "device": "CPU", "hint": "throughput", "nireq": 4},
+ *         {"name": "classifier", "path": "classifier.xml", "hint": "latency", "rate": 200, "arrival": "poisson"}
+ *     ]
+ * }
+ */
+CoLocatedModelsSpec read_models_spec(const std::string& filename);
+
+/**
+ * @brief Compiles all the models of the spec with the shared core and runs them concurrently, each model with its
+ * own infer requests in its own thread. Reports per-model and aggregate throughput and latency and the memory
+ * footprint of each model and of the whole process.
+ */
+void run_co_located_models(ov::Core& core,
+                           const CoLocatedModelsSpec& spec,
+                           uint32_t duration_seconds,
+                           uint32_t niter,
+                           size_t latency_percentile,
+                           const std::shared_ptr<StatisticsReport>& statistics);
@@ -48,6 +48,14 @@ public:
 
     void start_async() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
+        _request.start_async();
+    }
+
+    /// @brief Starts the request that arrived at arrivalTime and waited in the queue since then
+    void start_async(const Time::time_point& arrivalTime) {
+        _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.start_async();
     }
 
@@ -57,6 +65,7 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.infer();
         _endTime = Time::now();
         _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds());
@@ -84,6 +93,11 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double get_queueing_time_in_milliseconds() const {
+        auto queueingTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueingTime.count()) * 0.000001;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -97,6 +111,7 @@ public:
 
 private:
     ov::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -137,6 +152,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueingLatencies.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -149,6 +165,7 @@ public:
     void put_idle_request(size_t id, size_t lat_group_id, const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueingLatencies.push_back(requests.at(id)->get_queueing_time_in_milliseconds());
         if (enable_lat_groups) {
             _latency_groups[lat_group_id].push_back(latency);
         }
@@ -168,6 +185,20 @@ public:
         return request;
     }
 
+    /// @brief Waits for an idle request until the deadline, returns nullptr if no request got idle in time
+    InferReqWrap::Ptr get_idle_request_until(const Time::time_point& deadline) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_cv.wait_until(lock, deadline, [this] {
+                return _idleIds.size() > 0;
+            })) {
+            return nullptr;
+        }
+        auto request = requests.at(_idleIds.front());
+        _idleIds.pop();
+        _startTime = std::min(Time::now(), _startTime);
+        return request;
+    }
+
     void wait_all() {
         std::unique_lock<std::mutex> lock(_mutex);
         _cv.wait(lock, [this] {
@@ -179,6 +210,10 @@ public:
         return _latencies;
     }
 
+    std::vector<double> get_queueing_latencies() {
+        return _queueingLatencies;
+    }
+
     std::vector<std::vector<double>> get_latency_groups() {
         return _latency_groups;
     }
@@ -192,6 +227,7 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueingLatencies;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
 };
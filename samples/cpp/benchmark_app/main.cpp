@@ -22,8 +22,10 @@
 #include "samples/slog.hpp"
 
 #include "benchmark_app.hpp"
+#include "co_located_models.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "open_loop.hpp"
 #include "progress_bar.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
@@ -43,7 +45,7 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_models_spec.empty()) {
         show_usage();
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
@@ -55,6 +57,22 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (!FLAGS_arrival.empty()) {
+        if (FLAGS_api != "async") {
+            throw std::logic_error("The open-loop mode (-arrival option) requires the `async` API.");
+        }
+        bool isGenerated = FLAGS_arrival == poissonArrival || FLAGS_arrival == constantArrival;
+        if (isGenerated && FLAGS_rate <= 0 && FLAGS_sla_p99 <= 0) {
+            throw std::logic_error("The " + FLAGS_arrival +
+                                   " arrival process requires the target rate. Please set -rate option.");
+        }
+        if (!isGenerated && FLAGS_sla_p99 > 0) {
+            throw std::logic_error("The search of the maximal rate meeting the SLA (-sla_p99 option) requires "
+                                   "the `poisson` or `constant` arrival process.");
+        }
+    } else if (FLAGS_rate > 0 || FLAGS_sla_p99 > 0) {
+        throw std::logic_error("-rate and -sla_p99 options require the open-loop mode. Please set -arrival option.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -232,6 +250,23 @@ int main(int argc, char* argv[]) {
         slog::info << "Device info: " << slog::endl;
         slog::info << core.get_versions(device_name) << slog::endl;
 
+        if (!FLAGS_models_spec.empty()) {
+            // several models are benchmarked concurrently with the shared core, each with its own settings
+            uint32_t duration_seconds = FLAGS_t;
+            if (duration_seconds == 0 && FLAGS_niter == 0) {
+                duration_seconds = device_default_device_duration_in_seconds(device_name);
+            }
+            run_co_located_models(core,
+                                  read_models_spec(FLAGS_models_spec),
+                                  duration_seconds,
+                                  FLAGS_niter,
+                                  FLAGS_latency_percentile,
+                                  statistics);
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         // ----------------- 3. Setting device configuration
         // -----------------------------------------------------------
         next_step();
@@ -425,6 +460,13 @@ int main(int argc, char* argv[]) {
         }
 
         bool isDynamicNetwork = false;
+        // times of the startup steps for the -startup_report
+        std::vector<std::pair<std::string, double>> startupTimes;
+        // the startup profile of the compiled model is collected only on demand
+        ov::AnyMap loadConfig;
+        if (!FLAGS_startup_report.empty()) {
+            loadConfig.emplace(ov::enable_startup_profile(true));
+        }
 
         if (FLAGS_load_from_file && !isNetworkCompiled) {
             next_step();
@@ -434,9 +476,10 @@ int main(int argc, char* argv[]) {
             next_step();
             slog::info << "Skipping the step for loading network from file" << slog::endl;
             auto startTime = Time::now();
-            compiledModel = core.compile_model(FLAGS_m, device_name);
+            compiledModel = core.compile_model(FLAGS_m, device_name, loadConfig);
             auto duration_ms = get_duration_ms_till_now(startTime);
             slog::info << "Load network took " << double_to_string(duration_ms) << " ms" << slog::endl;
+            startupTimes.emplace_back("load_network_time", duration_ms);
             if (statistics)
                 statistics->add_parameters(
                     StatisticsReport::Category::EXECUTION_RESULTS,
@@ -466,6 +509,7 @@ int main(int argc, char* argv[]) {
             auto model = core.read_model(FLAGS_m);
             auto duration_ms = get_duration_ms_till_now(startTime);
             slog::info << "Read network took " << double_to_string(duration_ms) << " ms" << slog::endl;
+            startupTimes.emplace_back("read_network_time", duration_ms);
             if (statistics)
                 statistics->add_parameters(
                     StatisticsReport::Category::EXECUTION_RESULTS,
@@ -500,6 +544,7 @@ int main(int argc, char* argv[]) {
                 model->reshape(shapes);
                 duration_ms = get_duration_ms_till_now(startTime);
                 slog::info << "Reshape network took " << double_to_string(duration_ms) << " ms" << slog::endl;
+                startupTimes.emplace_back("reshape_network_time", duration_ms);
                 if (statistics)
                     statistics->add_parameters(
                         StatisticsReport::Category::EXECUTION_RESULTS,
@@ -605,9 +650,10 @@ int main(int argc, char* argv[]) {
             // --------------------------------------------------------
             next_step();
             startTime = Time::now();
-            compiledModel = core.compile_model(model, device_name);
+            compiledModel = core.compile_model(model, device_name, loadConfig);
             duration_ms = get_duration_ms_till_now(startTime);
             slog::info << "Load network took " << double_to_string(duration_ms) << " ms" << slog::endl;
+            startupTimes.emplace_back("load_network_time", duration_ms);
             if (statistics)
                 statistics->add_parameters(
                     StatisticsReport::Category::EXECUTION_RESULTS,
@@ -628,11 +674,12 @@ int main(int argc, char* argv[]) {
             if (!modelStream.is_open()) {
                 throw std::runtime_error("Cannot open model file " + FLAGS_m);
             }
-            compiledModel = core.import_model(modelStream, device_name, {});
+            compiledModel = core.import_model(modelStream, device_name, loadConfig);
             modelStream.close();
 
             auto duration_ms = get_duration_ms_till_now(startTime);
             slog::info << "Import network took " << double_to_string(duration_ms) << " ms" << slog::endl;
+            startupTimes.emplace_back("import_network_time", duration_ms);
             if (statistics)
                 statistics->add_parameters(
                     StatisticsReport::Category::EXECUTION_RESULTS,
@@ -932,6 +979,11 @@ int main(int argc, char* argv[]) {
 
         auto duration_ms = inferRequestsQueue.get_latencies()[0];
         slog::info << "First inference took " << double_to_string(duration_ms) << " ms" << slog::endl;
+        startupTimes.emplace_back("first_inference_time", duration_ms);
+        if (!FLAGS_startup_report.empty()) {
+            dump_startup_report(FLAGS_startup_report, startupTimes, compiledModel);
+            slog::info << "Startup report is stored to " << FLAGS_startup_report << slog::endl;
+        }
 
         if (statistics) {
             statistics->add_parameters(
@@ -940,93 +992,130 @@ int main(int argc, char* argv[]) {
         }
         inferRequestsQueue.reset_times();
 
-        size_t processedFramesN = 0;
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                IE_THROW() << "No idle Infer Requests!";
+        // setting of the inputs included into the performance measurements in the full mode
+        auto prepare_request = [&](InferReqWrap::Ptr& inferRequest, size_t iterationNum) {
+            if (inferenceOnly) {
+                return;
             }
+            auto inputs = app_inputs_info[iterationNum % app_inputs_info.size()];
 
-            if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
-
-                if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
-                }
+            if (FLAGS_pcseq) {
+                inferRequest->set_latency_group_id(iterationNum % app_inputs_info.size());
+            }
 
-                if (isDynamicNetwork) {
-                    batchSize = get_batch_size(inputs);
-                    if (!std::any_of(inputs.begin(),
-                                     inputs.end(),
-                                     [](const std::pair<const std::string, benchmark_app::InputInfo>& info) {
-                                         return ov::layout::has_batch(info.second.layout);
-                                     })) {
-                        slog::warn
-                            << "No batch dimension was found, asssuming batch to be 1. Beware: this might affect "
-                               "FPS calculation."
-                            << slog::endl;
-                    }
+            if (isDynamicNetwork) {
+                batchSize = get_batch_size(inputs);
+                if (!std::any_of(inputs.begin(),
+                                 inputs.end(),
+                                 [](const std::pair<const std::string, benchmark_app::InputInfo>& info) {
+                                     return ov::layout::has_batch(info.second.layout);
+                                 })) {
+                    slog::warn << "No batch dimension was found, asssuming batch to be 1. Beware: this might affect "
+                                  "FPS calculation."
+                               << slog::endl;
                 }
+            }
 
-                for (auto& item : inputs) {
-                    auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
-                }
+            for (auto& item : inputs) {
+                auto inputName = item.first;
+                const auto& data = inputsData.at(inputName)[iterationNum % inputsData.at(inputName).size()];
+                inferRequest->set_tensor(inputName, data);
+            }
 
-                if (useGpuMem) {
-                    auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
-                    for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
-                    }
+            if (useGpuMem) {
+                auto outputTensors =
+                    ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
+                for (auto& output : compiledModel.outputs()) {
+                    inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
                 }
             }
+        };
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
+        size_t processedFramesN = 0;
+        std::vector<double> latencies;
+        double totalDuration = 0;
+        OpenLoopResult openLoopResult;
+        double maxRateForSla = 0;
+        ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
+
+        if (!FLAGS_arrival.empty()) {
+            // open-loop mode: the arrivals don't depend on the completion of the previous requests
+            auto run_at_rate = [&](double rate) {
+                auto arrivalTimes = get_arrival_times(FLAGS_arrival,
+                                                      rate,
+                                                      FLAGS_niter,
+                                                      get_duration_in_milliseconds(duration_seconds));
+                return run_open_loop(inferRequestsQueue, arrivalTimes, prepare_request, FLAGS_sla_p99);
+            };
+            if (FLAGS_sla_p99 > 0) {
+                // without the target rate the search starts from the rate estimated by the first inference
+                double initialRate = FLAGS_rate > 0 ? FLAGS_rate : 1000.0 * nireq / std::max(duration_ms, 0.001);
+                slog::info << "Searching the maximal rate meeting the p99 latency SLA of "
+                           << double_to_string(FLAGS_sla_p99) << " ms" << slog::endl;
+                maxRateForSla = find_max_rate_for_sla(initialRate, FLAGS_sla_p99, run_at_rate, openLoopResult);
             } else {
-                // As the inference request is currently idle, the wait() adds no
-                // additional overhead (and should return immediately). The primary
-                // reason for calling the method is exception checking/re-throwing.
-                // Callback, that governs the actual execution can handle errors as
-                // well, but as it uses just error codes it has no details like ‘what()’
-                // method of `std::exception` So, rechecking for any exceptions here.
-                inferRequest->wait();
-                inferRequest->start_async();
+                openLoopResult = run_at_rate(FLAGS_rate);
             }
-            ++iteration;
+            iteration = openLoopResult.iterations;
+            processedFramesN = iteration * batchSize;
+            latencies = openLoopResult.service_latencies;
+            totalDuration = openLoopResult.duration_ms;
+        } else {
+            auto startTime = Time::now();
+            auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+            /** Start inference & calculate performance **/
+            /** to align number if iterations to guarantee that last infer requests are
+             * executed in the same conditions **/
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    IE_THROW() << "No idle Infer Requests!";
+                }
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
+                prepare_request(inferRequest, iteration);
 
-            if (niter > 0) {
-                progressBar.add_progress(1);
-            } else {
-                // calculate how many progress intervals are covered by current
-                // iteration. depends on the current iteration time and time of each
-                // progress interval. Previously covered progress intervals must be
-                // skipped.
-                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
-                progressBar.add_progress(newProgress);
-                progressCnt += newProgress;
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else {
+                    // As the inference request is currently idle, the wait() adds no
+                    // additional overhead (and should return immediately). The primary
+                    // reason for calling the method is exception checking/re-throwing.
+                    // Callback, that governs the actual execution can handle errors as
+                    // well, but as it uses just error codes it has no details like ‘what()’
+                    // method of `std::exception` So, rechecking for any exceptions here.
+                    inferRequest->wait();
+                    inferRequest->start_async();
+                }
+                ++iteration;
+
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
+
+                if (niter > 0) {
+                    progressBar.add_progress(1);
+                } else {
+                    // calculate how many progress intervals are covered by current
+                    // iteration. depends on the current iteration time and time of each
+                    // progress interval. Previously covered progress intervals must be
+                    // skipped.
+                    auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
+                    size_t newProgress = execTime / progressIntervalTime - progressCnt;
+                    progressBar.add_progress(newProgress);
+                    progressCnt += newProgress;
+                }
             }
-        }
 
-        // wait the latest inference executions
-        inferRequestsQueue.wait_all();
+            // wait the latest inference executions
+            inferRequestsQueue.wait_all();
 
-        LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+            latencies = inferRequestsQueue.get_latencies();
+            totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
+        }
+
+        LatencyMetrics generalLatency(latencies, "", FLAGS_latency_percentile);
         std::vector<LatencyMetrics> groupLatencies = {};
         if (FLAGS_pcseq && app_inputs_info.size() > 1) {
             const auto& lat_groups = inferRequestsQueue.get_latency_groups();
@@ -1044,7 +1133,6 @@ int main(int argc, char* argv[]) {
             }
         }
 
-        double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / generalLatency.median_or_percentile
                                            : 1000.0 * processedFramesN / totalDuration;
 
@@ -1077,6 +1165,35 @@ int main(int argc, char* argv[]) {
             }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
+            if (!FLAGS_arrival.empty()) {
+                StatisticsReport::Parameters openLoopParameters = {
+                    StatisticsVariant("arrival process", "arrival", FLAGS_arrival),
+                    StatisticsVariant("offered rate (requests/s)", "offered_rate", openLoopResult.target_rate),
+                    StatisticsVariant("achieved rate (requests/s)", "achieved_rate", openLoopResult.achieved_rate)};
+                const std::vector<std::pair<std::string, const LatencyDistribution*>> distributions = {
+                    {"queueing", &openLoopResult.queueing},
+                    {"service", &openLoopResult.service},
+                    {"total", &openLoopResult.total}};
+                const std::vector<std::pair<std::string, double>> percentiles = {{"p50", 50},
+                                                                                 {"p90", 90},
+                                                                                 {"p99", 99},
+                                                                                 {"p99.9", 99.9}};
+                for (const auto& distribution : distributions) {
+                    for (const auto& percentile : percentiles) {
+                        openLoopParameters.emplace_back(
+                            distribution.first + " latency " + percentile.first + " (ms)",
+                            distribution.first + "_latency_" + percentile.first,
+                            distribution.second->percentile(percentile.second));
+                    }
+                }
+                if (FLAGS_sla_p99 > 0) {
+                    openLoopParameters.emplace_back("p99 latency SLA (ms)", "sla_p99", FLAGS_sla_p99);
+                    openLoopParameters.emplace_back("max rate meeting the SLA (requests/s)",
+                                                    "max_rate_for_sla",
+                                                    maxRateForSla);
+                }
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS, openLoopParameters);
+            }
         }
         progressBar.finish();
 
@@ -1144,6 +1261,32 @@ int main(int argc, char* argv[]) {
         }
         slog::info << "Throughput: " << double_to_string(fps) << " FPS" << slog::endl;
 
+        if (!FLAGS_arrival.empty()) {
+            slog::info << "Open-loop mode with " << FLAGS_arrival << " arrivals:" << slog::endl;
+            slog::info << "Offered rate:  " << double_to_string(openLoopResult.target_rate) << " requests/s"
+                       << slog::endl;
+            slog::info << "Achieved rate: " << double_to_string(openLoopResult.achieved_rate) << " requests/s"
+                       << slog::endl;
+            if (openLoopResult.overloaded) {
+                slog::warn << "The run was stopped because more than 1% of the requests waited in the queue longer "
+                              "than the SLA."
+                           << slog::endl;
+            }
+            openLoopResult.queueing.write_to_slog("Queueing");
+            openLoopResult.service.write_to_slog("Service");
+            openLoopResult.total.write_to_slog("Total (queueing + service)");
+            openLoopResult.total.write_histogram_to_slog();
+            if (FLAGS_sla_p99 > 0) {
+                if (maxRateForSla > 0) {
+                    slog::info << "Max rate meeting the p99 latency SLA of " << double_to_string(FLAGS_sla_p99)
+                               << " ms: " << double_to_string(maxRateForSla) << " requests/s" << slog::endl;
+                } else {
+                    slog::warn << "No tried rate meets the p99 latency SLA of " << double_to_string(FLAGS_sla_p99)
+                               << " ms" << slog::endl;
+                }
+            }
+        }
+
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -0,0 +1,263 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open_loop.hpp"
+// clang-format on
+
+namespace {
+constexpr size_t maxRateDoublings = 10;
+constexpr size_t maxRateBisections = 8;
+// the search stops when the rate is known with this relative precision
+constexpr double ratePrecision = 0.02;
+// fixed seed to offer the same arrivals to the compared configurations
+constexpr unsigned int poissonSeed = 42;
+
+bool meets_sla(const OpenLoopResult& result, double sla_p99_ms) {
+    return !result.overloaded && !result.total.empty() && result.total.percentile(99) <= sla_p99_ms;
+}
+}  // namespace
+
+LatencyDistribution::LatencyDistribution(std::vector<double> latencies) : _latencies(std::move(latencies)) {
+    if (_latencies.empty()) {
+        return;
+    }
+    std::sort(_latencies.begin(), _latencies.end());
+    avg = std::accumulate(_latencies.begin(), _latencies.end(), 0.0) / _latencies.size();
+    max = _latencies.back();
+}
+
+double LatencyDistribution::percentile(double percentile) const {
+    if (_latencies.empty()) {
+        throw std::logic_error("Latency distribution is empty.");
+    }
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * _latencies.size()));
+    return _latencies[std::min(std::max<size_t>(rank, 1), _latencies.size()) - 1];
+}
+
+void LatencyDistribution::write_to_slog(const std::string& name) const {
+    slog::info << name << " latency:" << slog::endl;
+    if (_latencies.empty()) {
+        slog::info << "\tNo completed requests" << slog::endl;
+        return;
+    }
+    slog::info << "\tp50:        " << double_to_string(percentile(50)) << " ms" << slog::endl;
+    slog::info << "\tp90:        " << double_to_string(percentile(90)) << " ms" << slog::endl;
+    slog::info << "\tp99:        " << double_to_string(percentile(99)) << " ms" << slog::endl;
+    slog::info << "\tp99.9:      " << double_to_string(percentile(99.9)) << " ms" << slog::endl;
+    slog::info << "\tAverage:    " << double_to_string(avg) << " ms" << slog::endl;
+    slog::info << "\tMax:        " << double_to_string(max) << " ms" << slog::endl;
+}
+
+void LatencyDistribution::write_histogram_to_slog() const {
+    static const size_t maxBuckets = 32;
+    static const size_t barWidth = 40;
+    auto firstPositive = std::upper_bound(_latencies.begin(), _latencies.end(), 0.0);
+    if (firstPositive == _latencies.end()) {
+        return;
+    }
+    // power of two buckets: [lowest, 2 * lowest), [2 * lowest, 4 * lowest), ...
+    const double lowest = std::exp2(std::floor(std::log2(*firstPositive)));
+    const size_t bucketsNum =
+        std::min(maxBuckets, static_cast<size_t>(std::floor(std::log2(max / lowest))) + 1);
+    std::vector<size_t> buckets(bucketsNum, 0);
+    for (const auto latency : _latencies) {
+        size_t bucket = latency < lowest ? 0 : static_cast<size_t>(std::floor(std::log2(latency / lowest)));
+        buckets[std::min(bucket, bucketsNum - 1)]++;
+    }
+    const size_t maxCount = *std::max_element(buckets.begin(), buckets.end());
+    slog::info << "Latency histogram:" << slog::endl;
+    for (size_t i = 0; i < bucketsNum; i++) {
+        std::stringstream range;
+        range << "[" << std::setw(10) << double_to_string(lowest * std::exp2(i)) << ", " << std::setw(10)
+              << double_to_string(lowest * std::exp2(i + 1)) << ") ms";
+        slog::info << "\t" << range.str() << std::setw(10) << buckets[i] << " "
+                   << std::string(buckets[i] * barWidth / maxCount, '#') << slog::endl;
+    }
+}
+
+std::vector<double> get_arrival_times(const std::string& arrival, double rate, size_t niter, uint64_t duration_ms) {
+    std::vector<double> arrivalTimes;
+    if (arrival == poissonArrival || arrival == constantArrival) {
+        if (rate <= 0) {
+            throw std::logic_error("The " + arrival + " arrival process requires a positive rate.");
+        }
+        if (niter == 0 && duration_ms == 0) {
+            throw std::logic_error("The open-loop mode requires either the number of iterations or the duration.");
+        }
+        std::mt19937 generator(poissonSeed);
+        // the rate is in requests per second, the arrival times are in milliseconds
+        std::exponential_distribution<double> interArrival(rate / 1000.0);
+        const double constantInterArrival = 1000.0 / rate;
+        double time = 0;
+        while ((niter == 0 || arrivalTimes.size() < niter) && (duration_ms == 0 || time < duration_ms)) {
+            arrivalTimes.push_back(time);
+            time += arrival == poissonArrival ? interArrival(generator) : constantInterArrival;
+        }
+        return arrivalTimes;
+    }
+
+    std::ifstream trace(arrival);
+    if (!trace.is_open()) {
+        throw std::logic_error("Can't open the arrival trace file " + arrival);
+    }
+    std::string line;
+    while (std::getline(trace, line)) {
+        line.erase(0, line.find_first_not_of(" \t\r"));
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        try {
+            arrivalTimes.push_back(std::stod(line));
+        } catch (const std::exception&) {
+            throw std::logic_error("Incorrect arrival time '" + line + "' in the trace file " + arrival);
+        }
+    }
+    if (arrivalTimes.empty()) {
+        throw std::logic_error("The arrival trace file " + arrival + " contains no arrival times.");
+    }
+    std::sort(arrivalTimes.begin(), arrivalTimes.end());
+    const double firstArrival = arrivalTimes.front();
+    for (auto& time : arrivalTimes) {
+        time -= firstArrival;
+    }
+    if (niter != 0 && arrivalTimes.size() > niter) {
+        arrivalTimes.resize(niter);
+    }
+    return arrivalTimes;
+}
+
+OpenLoopResult run_open_loop(InferRequestsQueue& inferRequestsQueue,
+                             const std::vector<double>& arrivalTimes,
+                             const PrepareRequestFunction& prepareRequest,
+                             double sla_p99_ms) {
+    if (arrivalTimes.empty()) {
+        throw std::logic_error("The open-loop mode requires at least one arrival.");
+    }
+    OpenLoopResult result;
+    inferRequestsQueue.reset_times();
+
+    const size_t maxLateArrivals = arrivalTimes.size() / 100;
+    size_t lateArrivals = 0;
+    std::deque<Time::time_point> pendingArrivals;
+    size_t nextArrival = 0;
+    const auto startTime = Time::now();
+    auto arrival_time_point = [&](size_t i) {
+        return startTime +
+               std::chrono::duration_cast<Time::duration>(std::chrono::duration<double, std::milli>(arrivalTimes[i]));
+    };
+
+    while (nextArrival < arrivalTimes.size() || !pendingArrivals.empty()) {
+        const auto now = Time::now();
+        while (nextArrival < arrivalTimes.size() && arrival_time_point(nextArrival) <= now) {
+            pendingArrivals.push_back(arrival_time_point(nextArrival++));
+        }
+        if (pendingArrivals.empty()) {
+            std::this_thread::sleep_until(arrival_time_point(nextArrival));
+            continue;
+        }
+
+        // wake up at the next arrival to put it into the queue even if all the requests are busy
+        auto inferRequest = nextArrival < arrivalTimes.size()
+                                ? inferRequestsQueue.get_idle_request_until(arrival_time_point(nextArrival))
+                                : inferRequestsQueue.get_idle_request();
+        if (!inferRequest) {
+            continue;
+        }
+        auto arrivalTime = pendingArrivals.front();
+        pendingArrivals.pop_front();
+
+        prepareRequest(inferRequest, result.iterations);
+        // rethrows the exception of the previous inference, see the closed-loop mode
+        inferRequest->wait();
+        inferRequest->start_async(arrivalTime);
+        ++result.iterations;
+
+        if (sla_p99_ms > 0 && get_duration_ms_till_now(arrivalTime) > sla_p99_ms &&
+            ++lateArrivals > maxLateArrivals) {
+            result.overloaded = true;
+            break;
+        }
+    }
+    inferRequestsQueue.wait_all();
+
+    result.duration_ms = inferRequestsQueue.get_duration_in_milliseconds();
+    if (arrivalTimes.back() > 0) {
+        result.target_rate = 1000.0 * arrivalTimes.size() / arrivalTimes.back();
+    }
+    if (result.duration_ms > 0) {
+        result.achieved_rate = 1000.0 * result.iterations / result.duration_ms;
+    }
+    result.service_latencies = inferRequestsQueue.get_latencies();
+    auto queueingLatencies = inferRequestsQueue.get_queueing_latencies();
+    std::vector<double> totalLatencies(result.service_latencies.size());
+    std::transform(result.service_latencies.begin(),
+                   result.service_latencies.end(),
+                   queueingLatencies.begin(),
+                   totalLatencies.begin(),
+                   std::plus<double>());
+    result.queueing = LatencyDistribution(std::move(queueingLatencies));
+    result.service = LatencyDistribution(result.service_latencies);
+    result.total = LatencyDistribution(std::move(totalLatencies));
+    return result;
+}
+
+double find_max_rate_for_sla(double initial_rate,
+                             double sla_p99_ms,
+                             const std::function<OpenLoopResult(double rate)>& runAtRate,
+                             OpenLoopResult& best) {
+    auto run = [&](double rate) {
+        auto result = runAtRate(rate);
+        bool meets = meets_sla(result, sla_p99_ms);
+        slog::info << "Rate " << double_to_string(rate) << " requests/s: "
+                   << (result.overloaded ? std::string("overloaded")
+                                         : "p99 latency " + double_to_string(result.total.percentile(99)) + " ms")
+                   << (meets ? ", meets the SLA" : ", violates the SLA") << slog::endl;
+        return std::make_pair(meets, result);
+    };
+
+    double low = 0;
+    double high = initial_rate;
+    auto trial = run(high);
+    best = trial.second;
+    if (trial.first) {
+        low = high;
+        high = 0;
+        for (size_t i = 0; i < maxRateDoublings; i++) {
+            trial = run(low * 2);
+            if (!trial.first) {
+                high = low * 2;
+                break;
+            }
+            low *= 2;
+            best = trial.second;
+        }
+        if (high == 0) {
+            slog::warn << "The SLA is met at the highest tried rate, the maximal rate may be higher." << slog::endl;
+            return low;
+        }
+    }
+
+    for (size_t i = 0; i < maxRateBisections && high - low > ratePrecision * high; i++) {
+        const double rate = (low + high) / 2;
+        trial = run(rate);
+        if (trial.first) {
+            low = rate;
+            best = trial.second;
+        } else {
+            high = rate;
+        }
+    }
+    return low;
+}
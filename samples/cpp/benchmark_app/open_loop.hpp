@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "infer_request_wrap.hpp"
+#include "utils.hpp"
+// clang-format on
+
+// @brief arrival processes of the open-loop mode
+static constexpr char poissonArrival[] = "poisson";
+static constexpr char constantArrival[] = "constant";
+
+/// @brief Percentiles and histogram of the latencies measured in the open-loop mode
+class LatencyDistribution {
+public:
+    LatencyDistribution() {}
+
+    explicit LatencyDistribution(std::vector<double> latencies);
+
+    /// @brief Returns the nearest-rank percentile, percentile is in the (0, 100] range
+    double percentile(double percentile) const;
+
+    void write_to_slog(const std::string& name) const;
+    void write_histogram_to_slog() const;
+
+    bool empty() const {
+        return _latencies.empty();
+    }
+
+    double avg = 0;
+    double max = 0;
+
+private:
+    std::vector<double> _latencies;
+};
+
+/// @brief Results of one open-loop run
+struct OpenLoopResult {
+    double target_rate = 0;
+    double achieved_rate = 0;
+    double duration_ms = 0;
+    size_t iterations = 0;
+    /// @brief The run was stopped because the queueing alone already violates the SLA
+    bool overloaded = false;
+    std::vector<double> service_latencies;
+    LatencyDistribution queueing;
+    LatencyDistribution service;
+    LatencyDistribution total;
+};
+
+using PrepareRequestFunction = std::function<void(InferReqWrap::Ptr& request, size_t iteration)>;
+
+/**
+ * @brief Generates the arrival times in milliseconds relative to the start of the run
+ * @param arrival Arrival process: "poisson", "constant" or the path to a trace file with one arrival time in
+ * milliseconds per line
+ * @param rate Target rate in requests per second, ignored for the traces
+ * @param niter Maximal number of arrivals, 0 means no limit
+ * @param duration_ms Duration of the arrivals window, 0 means no limit
+ */
+std::vector<double> get_arrival_times(const std::string& arrival, double rate, size_t niter, uint64_t duration_ms);
+
+/**
+ * @brief Submits the requests at the arrival times regardless of the completion of the previous ones.
+ * The requests that arrive when all the infer requests are busy wait in a FIFO queue, so the total latency
+ * of a request is the queueing latency plus the service latency.
+ * @param sla_p99_ms If not zero, the run is stopped as soon as more than 1% of the arrivals waited in the
+ * queue longer than the SLA, so the p99 latency can't meet it anyway
+ */
+OpenLoopResult run_open_loop(InferRequestsQueue& inferRequestsQueue,
+                             const std::vector<double>& arrivalTimes,
+                             const PrepareRequestFunction& prepareRequest,
+                             double sla_p99_ms = 0);
+
+/**
+ * @brief Searches the maximal rate whose p99 of the total latency meets the SLA: the rate is doubled from the
+ * initial one until the SLA is violated and then refined with a binary search
+ * @param runAtRate Runs the open-loop mode at the given rate
+ * @param best Result of the run at the returned rate or at the initial rate if no rate meets the SLA
+ * @return The maximal rate meeting the SLA or 0 if even the lowest tried rate violates it
+ */
+double find_max_rate_for_sla(double initial_rate,
+                             double sla_p99_ms,
+                             const std::function<OpenLoopResult(double rate)>& runAtRate,
+                             OpenLoopResult& best);
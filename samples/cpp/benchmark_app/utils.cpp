@@ -764,6 +764,26 @@ void load_config(const std::string& filename, std::map<std::string, ov::AnyMap>&
 }
 #endif
 
+void dump_startup_report(const std::string& filename,
+                         const std::vector<std::pair<std::string, double>>& appTimes,
+                         const ov::CompiledModel& compiledModel) {
+    nlohmann::json report;
+    for (const auto& time : appTimes) {
+        report["app"][time.first] = time.second;
+    }
+    try {
+        report["startup_profile"] = nlohmann::json::parse(compiledModel.get_property(ov::startup_profile));
+    } catch (const std::exception& ex) {
+        slog::warn << "Startup profile is not available: " << ex.what() << slog::endl;
+    }
+
+    std::ofstream ofs(filename);
+    if (!ofs.is_open()) {
+        throw std::runtime_error("Can't open startup report file \"" + filename + "\".");
+    }
+    ofs << report.dump(4);
+}
+
 #ifdef USE_OPENCV
 const std::vector<std::string> supported_image_extensions =
     {"bmp", "dib", "jpeg", "jpg", "jpe", "jp2", "png", "pbm", "pgm", "ppm", "sr", "ras", "tiff", "tif"};
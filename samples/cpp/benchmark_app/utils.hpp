@@ -125,6 +125,14 @@ std::vector<benchmark_app::InputsInfo> get_inputs_info(const std::string& shape_
 void dump_config(const std::string& filename, const std::map<std::string, ov::AnyMap>& config);
 void load_config(const std::string& filename, std::map<std::string, ov::AnyMap>& config);
 
+/**
+ * @brief Writes the JSON startup report: the times of the startup steps measured by the application in
+ * milliseconds and the startup profile of the compiled model, see ov::startup_profile
+ */
+void dump_startup_report(const std::string& filename,
+                         const std::vector<std::pair<std::string, double>>& appTimes,
+                         const ov::CompiledModel& compiledModel);
+
 extern const std::vector<std::string> supported_image_extensions;
 extern const std::vector<std::string> supported_binary_extensions;
 
@@ -0,0 +1,542 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ov_c_api.h
+ * C API of OpenVINO Runtime 2.0 over ov::Core, ov::CompiledModel and ov::InferRequest.
+ * Besides the synchronous and asynchronous inference it provides tensors wrapping the
+ * user memory without a copy, pools of infer requests and completion queues, so many
+ * asynchronous requests can be driven from one thread by reaping their completions
+ * instead of handling a callback per request.
+**/
+
+/**
+ *  @defgroup ov_c_api OpenVINO Runtime C API
+ *  OpenVINO Runtime C API
+ */
+
+#ifndef OV_C_API_H
+#define OV_C_API_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+    #define OPENVINO_C_API_EXTERN extern "C"
+#else
+    #define OPENVINO_C_API_EXTERN
+#endif
+
+#if defined(OPENVINO_STATIC_LIBRARY) || defined(__GNUC__) && (__GNUC__ < 4)
+    #define OPENVINO_C_API(...) OPENVINO_C_API_EXTERN __VA_ARGS__
+    #define OV_NODISCARD
+#else
+    #if defined(_WIN32)
+        #ifdef openvino_c_EXPORTS
+            #define OPENVINO_C_API(...) OPENVINO_C_API_EXTERN __declspec(dllexport) __VA_ARGS__ __cdecl
+        #else
+            #define OPENVINO_C_API(...) OPENVINO_C_API_EXTERN __declspec(dllimport) __VA_ARGS__ __cdecl
+        #endif
+        #define OV_NODISCARD
+    #else
+        #define OPENVINO_C_API(...) OPENVINO_C_API_EXTERN __attribute__((visibility("default"))) __VA_ARGS__
+        #define OV_NODISCARD __attribute__((warn_unused_result))
+    #endif
+#endif
+
+typedef struct ov_core ov_core_t;
+typedef struct ov_model ov_model_t;
+typedef struct ov_compiled_model ov_compiled_model_t;
+typedef struct ov_infer_request ov_infer_request_t;
+typedef struct ov_tensor ov_tensor_t;
+typedef struct ov_infer_request_pool ov_infer_request_pool_t;
+typedef struct ov_completion_queue ov_completion_queue_t;
+
+/**
+ * @enum ov_status_e
+ * @brief This enum contains codes for all possible return values of the interface functions.
+ * The values match the ones of IEStatusCode.
+ */
+typedef enum {
+    OV_OK = 0,
+    OV_GENERAL_ERROR = -1,
+    OV_NOT_IMPLEMENTED = -2,
+    OV_PARAMETER_MISMATCH = -4,
+    OV_NOT_FOUND = -5,
+    OV_OUT_OF_BOUNDS = -6,
+    /*
+     * @brief exception not of std::exception derived type was thrown
+     */
+    OV_UNEXPECTED = -7,
+    OV_REQUEST_BUSY = -8,
+    OV_RESULT_NOT_READY = -9,
+    OV_INFER_CANCELLED = -13,
+} ov_status_e;
+
+/**
+ * @enum ov_element_type_e
+ * @brief Element types of the tensors
+ */
+typedef enum {
+    OV_ELEMENT_UNDEFINED = 0,  //!< Undefined element type
+    OV_ELEMENT_BOOLEAN,        //!< boolean element type
+    OV_ELEMENT_BF16,           //!< bf16 element type
+    OV_ELEMENT_F16,            //!< f16 element type
+    OV_ELEMENT_F32,            //!< f32 element type
+    OV_ELEMENT_F64,            //!< f64 element type
+    OV_ELEMENT_I4,             //!< i4 element type
+    OV_ELEMENT_I8,             //!< i8 element type
+    OV_ELEMENT_I16,            //!< i16 element type
+    OV_ELEMENT_I32,            //!< i32 element type
+    OV_ELEMENT_I64,            //!< i64 element type
+    OV_ELEMENT_U1,             //!< binary element type
+    OV_ELEMENT_U4,             //!< u4 element type
+    OV_ELEMENT_U8,             //!< u8 element type
+    OV_ELEMENT_U16,            //!< u16 element type
+    OV_ELEMENT_U32,            //!< u32 element type
+    OV_ELEMENT_U64,            //!< u64 element type
+} ov_element_type_e;
+
+/**
+ * @struct ov_shape
+ * @brief Represents a static shape of a tensor
+ */
+typedef struct ov_shape {
+    size_t rank;     //!< A rank representing a number of dimensions
+    size_t dims[8];  //!< An array of dimensions
+} ov_shape_t;
+
+/**
+ * @struct ov_property
+ * @brief Represents a property of a device or a compiled model as a pair of strings
+ */
+typedef struct ov_property {
+    const char *key;           //!< A property key
+    const char *value;         //!< A property value
+    struct ov_property *next;  //!< A pointer to the next property
+} ov_property_t;
+
+/**
+ * @struct ov_completion
+ * @brief Represents a finished asynchronous inference reaped from a completion queue
+ */
+typedef struct ov_completion {
+    ov_infer_request_t *request;  //!< The finished infer request
+    void *user_data;              //!< The user data given at the submission
+    ov_status_e status;           //!< Status of the inference: OV_OK(0) for success
+} ov_completion_t;
+
+// Core
+
+/**
+ * @defgroup ov_core_c_api Core
+ * @ingroup ov_c_api
+ * Set of functions to read models and compile them for the devices.
+ * @{
+ */
+
+/**
+ * @brief Constructs OpenVINO Runtime Core instance. Use the ov_core_free() method to free memory.
+ * @ingroup ov_core_c_api
+ * @param xml_config_file A path to .xml file with devices to load from. If the path is empty,
+ * the default devices are loaded from the default plugins.xml file.
+ * @param core A pointer to the newly created ov_core_t.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_core_create(const char *xml_config_file, ov_core_t **core);
+
+/**
+ * @brief Releases memory occupied by core.
+ * @ingroup ov_core_c_api
+ * @param core A pointer to the core to free memory.
+ */
+OPENVINO_C_API(void) ov_core_free(ov_core_t **core);
+
+/**
+ * @brief Reads a model from the IR or ONNX files. Use the ov_model_free() method to free memory.
+ * @ingroup ov_core_c_api
+ * @param core A pointer to ov_core_t instance.
+ * @param model_path A path to the model file.
+ * @param bin_path A path to the weights file of the IR, may be NULL or empty to look for the file with the same name.
+ * @param model A pointer to the newly created model.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_core_read_model(ov_core_t *core, const char *model_path, const char *bin_path,
+                                                            ov_model_t **model);
+
+/**
+ * @brief Releases memory occupied by model.
+ * @ingroup ov_core_c_api
+ * @param model A pointer to the model to free memory.
+ */
+OPENVINO_C_API(void) ov_model_free(ov_model_t **model);
+
+/**
+ * @brief Compiles a model for the device. Use the ov_compiled_model_free() method to free memory.
+ * @ingroup ov_core_c_api
+ * @param core A pointer to ov_core_t instance.
+ * @param model A pointer to the model.
+ * @param device_name A name of the device to compile the model for.
+ * @param properties A list of the properties of the compilation, may be NULL.
+ * @param compiled_model A pointer to the newly created compiled model.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_core_compile_model(ov_core_t *core, const ov_model_t *model, const char *device_name,
+                                                               const ov_property_t *properties, ov_compiled_model_t **compiled_model);
+
+/** @} */ // end of Core
+
+// CompiledModel
+
+/**
+ * @defgroup ov_compiled_model_c_api CompiledModel
+ * @ingroup ov_c_api
+ * Set of functions to create infer requests of a compiled model.
+ * @{
+ */
+
+/**
+ * @brief Releases memory occupied by compiled model.
+ * @ingroup ov_compiled_model_c_api
+ * @param compiled_model A pointer to the compiled model to free memory.
+ */
+OPENVINO_C_API(void) ov_compiled_model_free(ov_compiled_model_t **compiled_model);
+
+/**
+ * @brief Creates an infer request of the compiled model. Use the ov_infer_request_free() method to free memory.
+ * @ingroup ov_compiled_model_c_api
+ * @param compiled_model A pointer to the compiled model.
+ * @param infer_request A pointer to the newly created infer request.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_compiled_model_create_infer_request(ov_compiled_model_t *compiled_model,
+                                                                                ov_infer_request_t **infer_request);
+
+/**
+ * @brief Gets the value of a property of the compiled model as a string. Use the ov_free() method to free memory.
+ * @ingroup ov_compiled_model_c_api
+ * @param compiled_model A pointer to the compiled model.
+ * @param key A property key, e.g. "OPTIMAL_NUMBER_OF_INFER_REQUESTS".
+ * @param value A pointer to the newly allocated string with the value.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_compiled_model_get_property(const ov_compiled_model_t *compiled_model, const char *key,
+                                                                        char **value);
+
+/**
+ * @brief Releases a string allocated by the API.
+ * @ingroup ov_compiled_model_c_api
+ * @param content A pointer to the string to free memory.
+ */
+OPENVINO_C_API(void) ov_free(char **content);
+
+/** @} */ // end of CompiledModel
+
+// Tensor
+
+/**
+ * @defgroup ov_tensor_c_api Tensor
+ * @ingroup ov_c_api
+ * Set of functions to create tensors and access their memory.
+ * @{
+ */
+
+/**
+ * @brief Creates a tensor allocating its memory. Use the ov_tensor_free() method to free memory.
+ * @ingroup ov_tensor_c_api
+ * @param type An element type of the tensor.
+ * @param shape A shape of the tensor.
+ * @param tensor A pointer to the newly created tensor.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_tensor_create(ov_element_type_e type, const ov_shape_t *shape, ov_tensor_t **tensor);
+
+/**
+ * @brief Creates a tensor on the user memory without a copy. The memory must be kept alive and not be
+ * changed while the tensor or an infer request it is set to uses it. Use the ov_tensor_free() method to free memory.
+ * @ingroup ov_tensor_c_api
+ * @param type An element type of the tensor.
+ * @param shape A shape of the tensor.
+ * @param host_ptr A pointer to the user memory of at least the byte size of the tensor.
+ * @param tensor A pointer to the newly created tensor.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_tensor_create_from_host_ptr(ov_element_type_e type, const ov_shape_t *shape, void *host_ptr,
+                                                                        ov_tensor_t **tensor);
+
+/**
+ * @brief Releases memory occupied by tensor. The memory of the tensor is released when it is not used
+ * by the infer requests anymore, the user memory of ov_tensor_create_from_host_ptr() is never released.
+ * @ingroup ov_tensor_c_api
+ * @param tensor A pointer to the tensor to free memory.
+ */
+OPENVINO_C_API(void) ov_tensor_free(ov_tensor_t **tensor);
+
+/**
+ * @brief Gets the pointer to the memory of the tensor.
+ * @ingroup ov_tensor_c_api
+ * @param tensor A pointer to the tensor.
+ * @param data A pointer to the memory of the tensor.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_tensor_data(const ov_tensor_t *tensor, void **data);
+
+/**
+ * @brief Gets the shape of the tensor.
+ * @ingroup ov_tensor_c_api
+ * @param tensor A pointer to the tensor.
+ * @param shape A pointer to the shape of the tensor.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_tensor_get_shape(const ov_tensor_t *tensor, ov_shape_t *shape);
+
+/**
+ * @brief Gets the element type of the tensor.
+ * @ingroup ov_tensor_c_api
+ * @param tensor A pointer to the tensor.
+ * @param type A pointer to the element type of the tensor.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_tensor_get_element_type(const ov_tensor_t *tensor, ov_element_type_e *type);
+
+/**
+ * @brief Gets the size of the tensor memory in bytes.
+ * @ingroup ov_tensor_c_api
+ * @param tensor A pointer to the tensor.
+ * @param byte_size A pointer to the size of the tensor memory.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_tensor_get_byte_size(const ov_tensor_t *tensor, size_t *byte_size);
+
+/** @} */ // end of Tensor
+
+// InferRequest
+
+/**
+ * @defgroup ov_infer_request_c_api InferRequest
+ * @ingroup ov_c_api
+ * Set of functions to set the tensors of infer requests and run the inference.
+ * @{
+ */
+
+/**
+ * @brief Releases memory occupied by infer request. The requests taken from a pool are owned by the pool
+ * and are not released by the call.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the infer request to free memory.
+ */
+OPENVINO_C_API(void) ov_infer_request_free(ov_infer_request_t **infer_request);
+
+/**
+ * @brief Sets a tensor of the input or the output with the given tensor name. The memory of the tensor
+ * is used by the request without a copy.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the infer request.
+ * @param tensor_name A name of the input or the output tensor.
+ * @param tensor A pointer to the tensor.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_set_tensor(ov_infer_request_t *infer_request, const char *tensor_name,
+                                                                     const ov_tensor_t *tensor);
+
+/**
+ * @brief Sets a tensor of the input with the given index. The memory of the tensor is used by the request without a copy.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the infer request.
+ * @param index An index of the input.
+ * @param tensor A pointer to the tensor.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_set_input_tensor(ov_infer_request_t *infer_request, size_t index,
+                                                                           const ov_tensor_t *tensor);
+
+/**
+ * @brief Sets a tensor of the output with the given index. The memory of the tensor is used by the request without a copy.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the infer request.
+ * @param index An index of the output.
+ * @param tensor A pointer to the tensor.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_set_output_tensor(ov_infer_request_t *infer_request, size_t index,
+                                                                            const ov_tensor_t *tensor);
+
+/**
+ * @brief Gets a tensor of the input or the output with the given tensor name. The returned tensor shares
+ * the memory with the request. Use the ov_tensor_free() method to free memory.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the infer request.
+ * @param tensor_name A name of the input or the output tensor.
+ * @param tensor A pointer to the newly created tensor.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_get_tensor(ov_infer_request_t *infer_request, const char *tensor_name,
+                                                                     ov_tensor_t **tensor);
+
+/**
+ * @brief Gets a tensor of the output with the given index. The returned tensor shares the memory with the request.
+ * Use the ov_tensor_free() method to free memory.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the infer request.
+ * @param index An index of the output.
+ * @param tensor A pointer to the newly created tensor.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_get_output_tensor(ov_infer_request_t *infer_request, size_t index,
+                                                                            ov_tensor_t **tensor);
+
+/**
+ * @brief Runs the inference synchronously.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the infer request.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_infer(ov_infer_request_t *infer_request);
+
+/**
+ * @brief Starts the inference asynchronously. Use ov_infer_request_wait() to wait for the result.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the infer request.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_start_async(ov_infer_request_t *infer_request);
+
+/**
+ * @brief Starts the inference asynchronously and posts its completion with the user data to the queue.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the infer request.
+ * @param queue A pointer to the completion queue.
+ * @param user_data A pointer returned in the completion, e.g. to identify the submission.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_submit(ov_infer_request_t *infer_request, ov_completion_queue_t *queue,
+                                                                 void *user_data);
+
+/**
+ * @brief Waits for the result of the asynchronous inference.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the infer request.
+ * @param timeout Maximum duration in milliseconds to block for, -1 waits until the result becomes available
+ * and 0 returns the status immediately.
+ * @return Status code of the operation: OV_OK(0) for success, OV_RESULT_NOT_READY if the timeout has elapsed.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_wait(ov_infer_request_t *infer_request, const int64_t timeout);
+
+/**
+ * @brief Cancels the inference of the request.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the infer request.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_cancel(ov_infer_request_t *infer_request);
+
+/** @} */ // end of InferRequest
+
+// InferRequestPool
+
+/**
+ * @defgroup ov_infer_request_pool_c_api InferRequestPool
+ * @ingroup ov_c_api
+ * Set of functions to share the infer requests of a compiled model between the submissions.
+ * @{
+ */
+
+/**
+ * @brief Creates a pool of the infer requests of the compiled model. Use the ov_infer_request_pool_free() method to free memory.
+ * @ingroup ov_infer_request_pool_c_api
+ * @param compiled_model A pointer to the compiled model.
+ * @param size A number of the requests, 0 creates the optimal number of the infer requests of the compiled model.
+ * @param pool A pointer to the newly created pool.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_pool_create(ov_compiled_model_t *compiled_model, size_t size,
+                                                                      ov_infer_request_pool_t **pool);
+
+/**
+ * @brief Releases memory occupied by the pool and its infer requests. No request of the pool may run.
+ * @ingroup ov_infer_request_pool_c_api
+ * @param pool A pointer to the pool to free memory.
+ */
+OPENVINO_C_API(void) ov_infer_request_pool_free(ov_infer_request_pool_t **pool);
+
+/**
+ * @brief Gets the number of the infer requests in the pool.
+ * @ingroup ov_infer_request_pool_c_api
+ * @param pool A pointer to the pool.
+ * @param size A pointer to the number of the requests.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_pool_size(const ov_infer_request_pool_t *pool, size_t *size);
+
+/**
+ * @brief Takes an idle infer request from the pool without blocking. The request is owned by the pool
+ * and must be returned with ov_infer_request_pool_release().
+ * @ingroup ov_infer_request_pool_c_api
+ * @param pool A pointer to the pool.
+ * @param infer_request A pointer to the taken request.
+ * @return Status code of the operation: OV_OK(0) for success, OV_REQUEST_BUSY if all the requests are taken.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_pool_acquire(ov_infer_request_pool_t *pool, ov_infer_request_t **infer_request);
+
+/**
+ * @brief Returns the request taken from the pool.
+ * @ingroup ov_infer_request_pool_c_api
+ * @param pool A pointer to the pool.
+ * @param infer_request A pointer to the request taken from the pool.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_infer_request_pool_release(ov_infer_request_pool_t *pool, ov_infer_request_t *infer_request);
+
+/** @} */ // end of InferRequestPool
+
+// CompletionQueue
+
+/**
+ * @defgroup ov_completion_queue_c_api CompletionQueue
+ * @ingroup ov_c_api
+ * Set of functions to reap the completions of the asynchronous inferences submitted with ov_infer_request_submit().
+ * @{
+ */
+
+/**
+ * @brief Creates a completion queue. Use the ov_completion_queue_free() method to free memory.
+ * @ingroup ov_completion_queue_c_api
+ * @param queue A pointer to the newly created queue.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_completion_queue_create(ov_completion_queue_t **queue);
+
+/**
+ * @brief Releases memory occupied by the queue. The completions of the requests still running are dropped.
+ * @ingroup ov_completion_queue_c_api
+ * @param queue A pointer to the queue to free memory.
+ */
+OPENVINO_C_API(void) ov_completion_queue_free(ov_completion_queue_t **queue);
+
+/**
+ * @brief Reaps the completions posted to the queue.
+ * @ingroup ov_completion_queue_c_api
+ * @param queue A pointer to the queue.
+ * @param timeout Maximum duration in milliseconds to block for until at least one completion is posted,
+ * -1 waits without a limit and 0 reaps the posted completions without blocking.
+ * @param completions An array to store the completions to.
+ * @param max_count A size of the completions array.
+ * @param count A pointer to the number of the reaped completions.
+ * @return Status code of the operation: OV_OK(0) for success, OV_RESULT_NOT_READY if nothing was posted before the timeout.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_completion_queue_wait(ov_completion_queue_t *queue, const int64_t timeout,
+                                                                  ov_completion_t *completions, size_t max_count, size_t *count);
+
+/**
+ * @brief Gets the number of the inferences submitted to the queue which completions are not reaped yet.
+ * @ingroup ov_completion_queue_c_api
+ * @param queue A pointer to the queue.
+ * @param count A pointer to the number of the inferences.
+ * @return Status code of the operation: OV_OK(0) for success.
+ */
+OPENVINO_C_API(OV_NODISCARD ov_status_e) ov_completion_queue_in_flight(const ov_completion_queue_t *queue, size_t *count);
+
+/** @} */ // end of CompletionQueue
+
+#endif  // OV_C_API_H
@@ -0,0 +1,626 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/exception.hpp"
+#include "c_api/ov_c_api.h"
+
+/**
+ * @struct ov_core
+ * @brief This struct represents OpenVINO Runtime Core entity.
+ */
+struct ov_core {
+    ov::Core object;
+};
+
+/**
+ * @struct ov_model
+ * @brief This struct represents a model read by the core
+ */
+struct ov_model {
+    std::shared_ptr<ov::Model> object;
+};
+
+/**
+ * @struct ov_compiled_model
+ * @brief This struct represents a model compiled for a device
+ */
+struct ov_compiled_model {
+    ov::CompiledModel object;
+};
+
+/**
+ * @struct ov_tensor
+ * @brief This struct represents a tensor, it shares the memory with its copies
+ */
+struct ov_tensor {
+    ov::Tensor object;
+};
+
+/**
+ * @struct ov_infer_request
+ * @brief This struct represents an infer request of a compiled model
+ */
+struct ov_infer_request {
+    explicit ov_infer_request(ov::InferRequest request, bool is_pooled = false) : object(std::move(request)), pooled(is_pooled) {}
+
+    ov::InferRequest object;
+    // the requests of a pool are released with the pool
+    const bool pooled;
+    // the completion callback of the last submission to a queue is set to the request
+    bool has_queue_callback = false;
+};
+
+/**
+ * @struct ov_infer_request_pool
+ * @brief This struct represents a pool of the infer requests of a compiled model
+ */
+struct ov_infer_request_pool {
+    std::vector<std::unique_ptr<ov_infer_request_t>> requests;
+    std::vector<ov_infer_request_t*> idle;
+    std::mutex mutex;
+};
+
+/**
+ * @struct CompletionQueue
+ * @brief The completions posted by the callbacks of the submitted requests. The callbacks hold the queue,
+ * so it outlives the requests still running when the queue handle is released.
+ */
+struct CompletionQueue {
+    std::mutex mutex;
+    std::condition_variable posted;
+    std::deque<ov_completion_t> completions;
+    // submitted inferences which completions are not reaped yet
+    size_t in_flight = 0;
+};
+
+/**
+ * @struct ov_completion_queue
+ * @brief This struct represents a completion queue of the asynchronous inferences
+ */
+struct ov_completion_queue {
+    std::shared_ptr<CompletionQueue> object;
+};
+
+std::map<ov_element_type_e, ov::element::Type> element_type_map = {{ov_element_type_e::OV_ELEMENT_UNDEFINED, ov::element::undefined},
+                                                                   {ov_element_type_e::OV_ELEMENT_BOOLEAN, ov::element::boolean},
+                                                                   {ov_element_type_e::OV_ELEMENT_BF16, ov::element::bf16},
+                                                                   {ov_element_type_e::OV_ELEMENT_F16, ov::element::f16},
+                                                                   {ov_element_type_e::OV_ELEMENT_F32, ov::element::f32},
+                                                                   {ov_element_type_e::OV_ELEMENT_F64, ov::element::f64},
+                                                                   {ov_element_type_e::OV_ELEMENT_I4, ov::element::i4},
+                                                                   {ov_element_type_e::OV_ELEMENT_I8, ov::element::i8},
+                                                                   {ov_element_type_e::OV_ELEMENT_I16, ov::element::i16},
+                                                                   {ov_element_type_e::OV_ELEMENT_I32, ov::element::i32},
+                                                                   {ov_element_type_e::OV_ELEMENT_I64, ov::element::i64},
+                                                                   {ov_element_type_e::OV_ELEMENT_U1, ov::element::u1},
+                                                                   {ov_element_type_e::OV_ELEMENT_U4, ov::element::u4},
+                                                                   {ov_element_type_e::OV_ELEMENT_U8, ov::element::u8},
+                                                                   {ov_element_type_e::OV_ELEMENT_U16, ov::element::u16},
+                                                                   {ov_element_type_e::OV_ELEMENT_U32, ov::element::u32},
+                                                                   {ov_element_type_e::OV_ELEMENT_U64, ov::element::u64}};
+
+#define CATCH_OV_EXCEPTIONS                                                          \
+        catch (const ov::Cancelled&) {return ov_status_e::OV_INFER_CANCELLED;}      \
+        catch (const ov::Busy&) {return ov_status_e::OV_REQUEST_BUSY;}              \
+        catch (const std::exception&) {return ov_status_e::OV_GENERAL_ERROR;}       \
+        catch (...) {return ov_status_e::OV_UNEXPECTED;}
+
+/**
+ *@brief convert the exception of the finished inference to the status.
+ */
+ov_status_e exception2status(const std::exception_ptr& exception) {
+    if (!exception) {
+        return ov_status_e::OV_OK;
+    }
+    try {
+        std::rethrow_exception(exception);
+    } CATCH_OV_EXCEPTIONS
+    return ov_status_e::OV_UNEXPECTED;
+}
+
+/**
+ *@brief convert the property list to the map.
+ */
+ov::AnyMap properties2Map(const ov_property_t *properties) {
+    ov::AnyMap m;
+    const ov_property_t *tmp = properties;
+    while (tmp && tmp->key && tmp->value) {
+        m[tmp->key] = std::string(tmp->value);
+        tmp = tmp->next;
+    }
+    return m;
+}
+
+bool shape2OvShape(const ov_shape_t *shape, ov::Shape& ov_shape) {
+    if (shape->rank > sizeof(shape->dims) / sizeof(shape->dims[0])) {
+        return false;
+    }
+    ov_shape = ov::Shape(shape->dims, shape->dims + shape->rank);
+    return true;
+}
+
+ov_status_e ov_core_create(const char *xml_config_file, ov_core_t **core) {
+    if (xml_config_file == nullptr || core == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        *core = new ov_core_t { ov::Core(xml_config_file) };
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+void ov_core_free(ov_core_t **core) {
+    if (core) {
+        delete *core;
+        *core = NULL;
+    }
+}
+
+ov_status_e ov_core_read_model(ov_core_t *core, const char *model_path, const char *bin_path, ov_model_t **model) {
+    if (core == nullptr || model_path == nullptr || model == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        *model = new ov_model_t { core->object.read_model(model_path, bin_path ? bin_path : "") };
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+void ov_model_free(ov_model_t **model) {
+    if (model) {
+        delete *model;
+        *model = NULL;
+    }
+}
+
+ov_status_e ov_core_compile_model(ov_core_t *core, const ov_model_t *model, const char *device_name,
+                                  const ov_property_t *properties, ov_compiled_model_t **compiled_model) {
+    if (core == nullptr || model == nullptr || device_name == nullptr || compiled_model == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        *compiled_model = new ov_compiled_model_t { core->object.compile_model(model->object, device_name, properties2Map(properties)) };
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+void ov_compiled_model_free(ov_compiled_model_t **compiled_model) {
+    if (compiled_model) {
+        delete *compiled_model;
+        *compiled_model = NULL;
+    }
+}
+
+ov_status_e ov_compiled_model_create_infer_request(ov_compiled_model_t *compiled_model, ov_infer_request_t **infer_request) {
+    if (compiled_model == nullptr || infer_request == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        *infer_request = new ov_infer_request_t(compiled_model->object.create_infer_request());
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_compiled_model_get_property(const ov_compiled_model_t *compiled_model, const char *key, char **value) {
+    if (compiled_model == nullptr || key == nullptr || value == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        const auto str = compiled_model->object.get_property(key).as<std::string>();
+        std::unique_ptr<char[]> value_temp(new char[str.length() + 1]);
+        memcpy(value_temp.get(), str.c_str(), str.length() + 1);
+        *value = value_temp.release();
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+void ov_free(char **content) {
+    if (content) {
+        delete[] *content;
+        *content = NULL;
+    }
+}
+
+ov_status_e ov_tensor_create(ov_element_type_e type, const ov_shape_t *shape, ov_tensor_t **tensor) {
+    if (shape == nullptr || tensor == nullptr || element_type_map.find(type) == element_type_map.end()) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    ov::Shape ov_shape;
+    if (!shape2OvShape(shape, ov_shape)) {
+        return ov_status_e::OV_OUT_OF_BOUNDS;
+    }
+    try {
+        *tensor = new ov_tensor_t { ov::Tensor(element_type_map[type], ov_shape) };
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_tensor_create_from_host_ptr(ov_element_type_e type, const ov_shape_t *shape, void *host_ptr, ov_tensor_t **tensor) {
+    if (shape == nullptr || host_ptr == nullptr || tensor == nullptr || element_type_map.find(type) == element_type_map.end()) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    ov::Shape ov_shape;
+    if (!shape2OvShape(shape, ov_shape)) {
+        return ov_status_e::OV_OUT_OF_BOUNDS;
+    }
+    try {
+        // the tensor doesn't own the memory, it is used by the requests as is
+        *tensor = new ov_tensor_t { ov::Tensor(element_type_map[type], ov_shape, host_ptr) };
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+void ov_tensor_free(ov_tensor_t **tensor) {
+    if (tensor) {
+        delete *tensor;
+        *tensor = NULL;
+    }
+}
+
+ov_status_e ov_tensor_data(const ov_tensor_t *tensor, void **data) {
+    if (tensor == nullptr || data == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        *data = tensor->object.data();
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_tensor_get_shape(const ov_tensor_t *tensor, ov_shape_t *shape) {
+    if (tensor == nullptr || shape == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        const auto ov_shape = tensor->object.get_shape();
+        if (ov_shape.size() > sizeof(shape->dims) / sizeof(shape->dims[0])) {
+            return ov_status_e::OV_OUT_OF_BOUNDS;
+        }
+        shape->rank = ov_shape.size();
+        std::copy(ov_shape.begin(), ov_shape.end(), shape->dims);
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_tensor_get_element_type(const ov_tensor_t *tensor, ov_element_type_e *type) {
+    if (tensor == nullptr || type == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        const auto ov_type = tensor->object.get_element_type();
+        const auto it = std::find_if(element_type_map.begin(), element_type_map.end(),
+                                     [&](const std::pair<const ov_element_type_e, ov::element::Type>& item) {
+                                         return item.second == ov_type;
+                                     });
+        if (it == element_type_map.end()) {
+            return ov_status_e::OV_NOT_IMPLEMENTED;
+        }
+        *type = it->first;
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_tensor_get_byte_size(const ov_tensor_t *tensor, size_t *byte_size) {
+    if (tensor == nullptr || byte_size == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        *byte_size = tensor->object.get_byte_size();
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+void ov_infer_request_free(ov_infer_request_t **infer_request) {
+    if (infer_request) {
+        if (*infer_request && !(*infer_request)->pooled) {
+            delete *infer_request;
+        }
+        *infer_request = NULL;
+    }
+}
+
+ov_status_e ov_infer_request_set_tensor(ov_infer_request_t *infer_request, const char *tensor_name, const ov_tensor_t *tensor) {
+    if (infer_request == nullptr || tensor_name == nullptr || tensor == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        infer_request->object.set_tensor(tensor_name, tensor->object);
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_set_input_tensor(ov_infer_request_t *infer_request, size_t index, const ov_tensor_t *tensor) {
+    if (infer_request == nullptr || tensor == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        infer_request->object.set_input_tensor(index, tensor->object);
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_set_output_tensor(ov_infer_request_t *infer_request, size_t index, const ov_tensor_t *tensor) {
+    if (infer_request == nullptr || tensor == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        infer_request->object.set_output_tensor(index, tensor->object);
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_get_tensor(ov_infer_request_t *infer_request, const char *tensor_name, ov_tensor_t **tensor) {
+    if (infer_request == nullptr || tensor_name == nullptr || tensor == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        *tensor = new ov_tensor_t { infer_request->object.get_tensor(tensor_name) };
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_get_output_tensor(ov_infer_request_t *infer_request, size_t index, ov_tensor_t **tensor) {
+    if (infer_request == nullptr || tensor == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        *tensor = new ov_tensor_t { infer_request->object.get_output_tensor(index) };
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_infer(ov_infer_request_t *infer_request) {
+    if (infer_request == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        infer_request->object.infer();
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_start_async(ov_infer_request_t *infer_request) {
+    if (infer_request == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        if (infer_request->has_queue_callback) {
+            // the inference is not submitted to the queue of the previous submission
+            infer_request->object.set_callback([](std::exception_ptr) {});
+            infer_request->has_queue_callback = false;
+        }
+        infer_request->object.start_async();
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_submit(ov_infer_request_t *infer_request, ov_completion_queue_t *queue, void *user_data) {
+    if (infer_request == nullptr || queue == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    auto completions = queue->object;
+    {
+        std::lock_guard<std::mutex> lock(completions->mutex);
+        completions->in_flight++;
+    }
+    try {
+        infer_request->object.set_callback([completions, infer_request, user_data](std::exception_ptr exception) {
+            const ov_completion_t completion = {infer_request, user_data, exception2status(exception)};
+            {
+                std::lock_guard<std::mutex> lock(completions->mutex);
+                completions->completions.push_back(completion);
+            }
+            completions->posted.notify_all();
+        });
+        infer_request->has_queue_callback = true;
+        infer_request->object.start_async();
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(completions->mutex);
+            completions->in_flight--;
+        }
+        return exception2status(std::current_exception());
+    }
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_wait(ov_infer_request_t *infer_request, const int64_t timeout) {
+    if (infer_request == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        if (timeout < 0) {
+            infer_request->object.wait();
+        } else if (!infer_request->object.wait_for(std::chrono::milliseconds(timeout))) {
+            return ov_status_e::OV_RESULT_NOT_READY;
+        }
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_cancel(ov_infer_request_t *infer_request) {
+    if (infer_request == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        infer_request->object.cancel();
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_pool_create(ov_compiled_model_t *compiled_model, size_t size, ov_infer_request_pool_t **pool) {
+    if (compiled_model == nullptr || pool == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        if (size == 0) {
+            size = std::max(1u, compiled_model->object.get_property(ov::optimal_number_of_infer_requests));
+        }
+        std::unique_ptr<ov_infer_request_pool_t> requests_pool(new ov_infer_request_pool_t);
+        for (size_t i = 0; i < size; i++) {
+            requests_pool->requests.emplace_back(new ov_infer_request_t(compiled_model->object.create_infer_request(), true));
+            requests_pool->idle.push_back(requests_pool->requests.back().get());
+        }
+        *pool = requests_pool.release();
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+void ov_infer_request_pool_free(ov_infer_request_pool_t **pool) {
+    if (pool) {
+        delete *pool;
+        *pool = NULL;
+    }
+}
+
+ov_status_e ov_infer_request_pool_size(const ov_infer_request_pool_t *pool, size_t *size) {
+    if (pool == nullptr || size == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    *size = pool->requests.size();
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_pool_acquire(ov_infer_request_pool_t *pool, ov_infer_request_t **infer_request) {
+    if (pool == nullptr || infer_request == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    if (pool->idle.empty()) {
+        return ov_status_e::OV_REQUEST_BUSY;
+    }
+    *infer_request = pool->idle.back();
+    pool->idle.pop_back();
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_infer_request_pool_release(ov_infer_request_pool_t *pool, ov_infer_request_t *infer_request) {
+    if (pool == nullptr || infer_request == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    const bool owned = std::any_of(pool->requests.begin(), pool->requests.end(),
+                                   [&](const std::unique_ptr<ov_infer_request_t>& request) {
+                                       return request.get() == infer_request;
+                                   });
+    if (!owned) {
+        return ov_status_e::OV_NOT_FOUND;
+    }
+    if (std::find(pool->idle.begin(), pool->idle.end(), infer_request) != pool->idle.end()) {
+        // the request is returned twice
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+    pool->idle.push_back(infer_request);
+    return ov_status_e::OV_OK;
+}
+
+ov_status_e ov_completion_queue_create(ov_completion_queue_t **queue) {
+    if (queue == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    try {
+        *queue = new ov_completion_queue_t { std::make_shared<CompletionQueue>() };
+    } CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OV_OK;
+}
+
+void ov_completion_queue_free(ov_completion_queue_t **queue) {
+    if (queue) {
+        delete *queue;
+        *queue = NULL;
+    }
+}
+
+ov_status_e ov_completion_queue_wait(ov_completion_queue_t *queue, const int64_t timeout,
+                                     ov_completion_t *completions, size_t max_count, size_t *count) {
+    if (queue == nullptr || completions == nullptr || max_count == 0 || count == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    auto& object = *queue->object;
+    std::unique_lock<std::mutex> lock(object.mutex);
+    const auto is_posted = [&] { return !object.completions.empty(); };
+    if (timeout < 0) {
+        object.posted.wait(lock, is_posted);
+    } else {
+        object.posted.wait_for(lock, std::chrono::milliseconds(timeout), is_posted);
+    }
+
+    *count = std::min(max_count, object.completions.size());
+    std::copy(object.completions.begin(), object.completions.begin() + *count, completions);
+    object.completions.erase(object.completions.begin(), object.completions.begin() + *count);
+    object.in_flight -= *count;
+    return *count ? ov_status_e::OV_OK : ov_status_e::OV_RESULT_NOT_READY;
+}
+
+ov_status_e ov_completion_queue_in_flight(const ov_completion_queue_t *queue, size_t *count) {
+    if (queue == nullptr || count == nullptr) {
+        return ov_status_e::OV_GENERAL_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(queue->object->mutex);
+    *count = queue->object->in_flight;
+    return ov_status_e::OV_OK;
+}
@@ -0,0 +1,208 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <c_api/ov_c_api.h>
+#include "test_model_repo.hpp"
+
+namespace {
+
+std::string ov_xml_std = TestDataHelpers::generate_model_path("test_model", "test_model_fp32.xml"),
+            ov_bin_std = TestDataHelpers::generate_model_path("test_model", "test_model_fp32.bin");
+
+#define OV_EXPECT_OK(...) EXPECT_EQ(ov_status_e::OV_OK, __VA_ARGS__)
+#define OV_ASSERT_OK(...) ASSERT_EQ(ov_status_e::OV_OK, __VA_ARGS__)
+
+size_t shape_size(const ov_shape_t &shape) {
+    size_t size = 1;
+    for (size_t i = 0; i < shape.rank; ++i) {
+        size *= shape.dims[i];
+    }
+    return size;
+}
+
+class ov_c_api_test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        OV_ASSERT_OK(ov_core_create("", &core));
+        OV_ASSERT_OK(ov_core_read_model(core, ov_xml_std.c_str(), ov_bin_std.c_str(), &model));
+        OV_ASSERT_OK(ov_core_compile_model(core, model, "CPU", nullptr, &compiled_model));
+    }
+
+    void TearDown() override {
+        ov_compiled_model_free(&compiled_model);
+        ov_model_free(&model);
+        ov_core_free(&core);
+    }
+
+    ov_core_t *core = nullptr;
+    ov_model_t *model = nullptr;
+    ov_compiled_model_t *compiled_model = nullptr;
+};
+
+}  // namespace
+
+TEST(ov_tensor_create_from_host_ptr, tensorUsesUserMemory) {
+    std::vector<float> memory(2 * 3 * 4, 1.f);
+    ov_shape_t shape = {3, {2, 3, 4}};
+    ov_tensor_t *tensor = nullptr;
+    OV_ASSERT_OK(ov_tensor_create_from_host_ptr(ov_element_type_e::OV_ELEMENT_F32, &shape, memory.data(), &tensor));
+
+    void *data = nullptr;
+    OV_EXPECT_OK(ov_tensor_data(tensor, &data));
+    EXPECT_EQ(memory.data(), data);
+
+    ov_shape_t tensor_shape;
+    OV_EXPECT_OK(ov_tensor_get_shape(tensor, &tensor_shape));
+    EXPECT_EQ(3, tensor_shape.rank);
+    EXPECT_EQ(4, tensor_shape.dims[2]);
+
+    ov_element_type_e type = ov_element_type_e::OV_ELEMENT_UNDEFINED;
+    OV_EXPECT_OK(ov_tensor_get_element_type(tensor, &type));
+    EXPECT_EQ(ov_element_type_e::OV_ELEMENT_F32, type);
+
+    size_t byte_size = 0;
+    OV_EXPECT_OK(ov_tensor_get_byte_size(tensor, &byte_size));
+    EXPECT_EQ(memory.size() * sizeof(float), byte_size);
+
+    ov_tensor_free(&tensor);
+    EXPECT_EQ(nullptr, tensor);
+}
+
+TEST(ov_tensor_create, tooLargeRankIsRejected) {
+    ov_shape_t shape = {9, {1, 1, 1, 1, 1, 1, 1, 1}};
+    ov_tensor_t *tensor = nullptr;
+    EXPECT_EQ(ov_status_e::OV_OUT_OF_BOUNDS, ov_tensor_create(ov_element_type_e::OV_ELEMENT_F32, &shape, &tensor));
+    EXPECT_EQ(nullptr, tensor);
+}
+
+TEST_F(ov_c_api_test, inferWritesToUserOutputMemory) {
+    ov_infer_request_t *infer_request = nullptr;
+    OV_ASSERT_OK(ov_compiled_model_create_infer_request(compiled_model, &infer_request));
+
+    ov_tensor_t *input = nullptr;
+    OV_ASSERT_OK(ov_infer_request_get_tensor(infer_request, "data", &input));
+    ov_shape_t input_shape;
+    OV_EXPECT_OK(ov_tensor_get_shape(input, &input_shape));
+    std::vector<float> input_memory(shape_size(input_shape), 0.5f);
+    ov_tensor_t *user_input = nullptr;
+    OV_ASSERT_OK(ov_tensor_create_from_host_ptr(ov_element_type_e::OV_ELEMENT_F32, &input_shape, input_memory.data(), &user_input));
+    OV_EXPECT_OK(ov_infer_request_set_input_tensor(infer_request, 0, user_input));
+
+    ov_tensor_t *output = nullptr;
+    OV_ASSERT_OK(ov_infer_request_get_output_tensor(infer_request, 0, &output));
+    ov_shape_t output_shape;
+    OV_EXPECT_OK(ov_tensor_get_shape(output, &output_shape));
+    std::vector<float> output_memory(shape_size(output_shape), -1.f);
+    ov_tensor_t *user_output = nullptr;
+    OV_ASSERT_OK(ov_tensor_create_from_host_ptr(ov_element_type_e::OV_ELEMENT_F32, &output_shape, output_memory.data(), &user_output));
+    OV_EXPECT_OK(ov_infer_request_set_output_tensor(infer_request, 0, user_output));
+
+    OV_EXPECT_OK(ov_infer_request_infer(infer_request));
+
+    ov_tensor_t *result = nullptr;
+    OV_ASSERT_OK(ov_infer_request_get_output_tensor(infer_request, 0, &result));
+    void *result_data = nullptr;
+    OV_EXPECT_OK(ov_tensor_data(result, &result_data));
+    EXPECT_EQ(output_memory.data(), result_data);
+
+    // the request with own tensors gives the same result
+    ov_infer_request_t *reference_request = nullptr;
+    OV_ASSERT_OK(ov_compiled_model_create_infer_request(compiled_model, &reference_request));
+    ov_tensor_t *reference_input = nullptr;
+    OV_ASSERT_OK(ov_infer_request_get_tensor(reference_request, "data", &reference_input));
+    void *reference_input_data = nullptr;
+    OV_EXPECT_OK(ov_tensor_data(reference_input, &reference_input_data));
+    std::copy(input_memory.begin(), input_memory.end(), static_cast<float*>(reference_input_data));
+    OV_EXPECT_OK(ov_infer_request_infer(reference_request));
+    ov_tensor_t *reference_output = nullptr;
+    OV_ASSERT_OK(ov_infer_request_get_output_tensor(reference_request, 0, &reference_output));
+    void *reference_output_data = nullptr;
+    OV_EXPECT_OK(ov_tensor_data(reference_output, &reference_output_data));
+    for (size_t i = 0; i < output_memory.size(); ++i) {
+        EXPECT_NEAR(static_cast<float*>(reference_output_data)[i], output_memory[i], 1.e-5);
+    }
+
+    ov_tensor_free(&reference_output);
+    ov_tensor_free(&reference_input);
+    ov_infer_request_free(&reference_request);
+    ov_tensor_free(&result);
+    ov_tensor_free(&user_output);
+    ov_tensor_free(&output);
+    ov_tensor_free(&user_input);
+    ov_tensor_free(&input);
+    ov_infer_request_free(&infer_request);
+}
+
+TEST_F(ov_c_api_test, reapCompletionsOfPoolRequests) {
+    const size_t requests_num = 4;
+    ov_infer_request_pool_t *pool = nullptr;
+    OV_ASSERT_OK(ov_infer_request_pool_create(compiled_model, requests_num, &pool));
+    size_t pool_size = 0;
+    OV_EXPECT_OK(ov_infer_request_pool_size(pool, &pool_size));
+    EXPECT_EQ(requests_num, pool_size);
+
+    ov_completion_queue_t *queue = nullptr;
+    OV_ASSERT_OK(ov_completion_queue_create(&queue));
+
+    std::vector<int> ids(requests_num);
+    for (size_t i = 0; i < requests_num; ++i) {
+        ov_infer_request_t *infer_request = nullptr;
+        OV_ASSERT_OK(ov_infer_request_pool_acquire(pool, &infer_request));
+        ids[i] = static_cast<int>(i);
+        OV_EXPECT_OK(ov_infer_request_submit(infer_request, queue, &ids[i]));
+    }
+    ov_infer_request_t *extra_request = nullptr;
+    EXPECT_EQ(ov_status_e::OV_REQUEST_BUSY, ov_infer_request_pool_acquire(pool, &extra_request));
+
+    std::vector<bool> completed(requests_num, false);
+    size_t reaped = 0;
+    while (reaped < requests_num) {
+        ov_completion_t completions[requests_num];
+        size_t count = 0;
+        OV_ASSERT_OK(ov_completion_queue_wait(queue, -1, completions, requests_num, &count));
+        for (size_t i = 0; i < count; ++i) {
+            OV_EXPECT_OK(completions[i].status);
+            completed[*static_cast<int*>(completions[i].user_data)] = true;
+            OV_EXPECT_OK(ov_infer_request_pool_release(pool, completions[i].request));
+        }
+        reaped += count;
+    }
+    for (size_t i = 0; i < requests_num; ++i) {
+        EXPECT_TRUE(completed[i]);
+    }
+
+    size_t in_flight = 1;
+    OV_EXPECT_OK(ov_completion_queue_in_flight(queue, &in_flight));
+    EXPECT_EQ(0, in_flight);
+
+    ov_completion_t completion;
+    size_t count = 1;
+    EXPECT_EQ(ov_status_e::OV_RESULT_NOT_READY, ov_completion_queue_wait(queue, 0, &completion, 1, &count));
+    EXPECT_EQ(0, count);
+
+    ov_completion_queue_free(&queue);
+    ov_infer_request_pool_free(&pool);
+}
+
+TEST_F(ov_c_api_test, pooledRequestIsReturnedOnce) {
+    ov_infer_request_pool_t *pool = nullptr;
+    OV_ASSERT_OK(ov_infer_request_pool_create(compiled_model, 1, &pool));
+
+    ov_infer_request_t *infer_request = nullptr;
+    OV_ASSERT_OK(ov_infer_request_pool_acquire(pool, &infer_request));
+    OV_EXPECT_OK(ov_infer_request_pool_release(pool, infer_request));
+    EXPECT_NE(ov_status_e::OV_OK, ov_infer_request_pool_release(pool, infer_request));
+
+    ov_infer_request_t *other_request = nullptr;
+    OV_ASSERT_OK(ov_compiled_model_create_infer_request(compiled_model, &other_request));
+    EXPECT_EQ(ov_status_e::OV_NOT_FOUND, ov_infer_request_pool_release(pool, other_request));
+
+    ov_infer_request_free(&other_request);
+    ov_infer_request_pool_free(&pool);
+}
@@ -11,7 +11,7 @@ static const char kPathSeparator =
         '/';
 #endif
 
-std::string getModelPathNonFatal() noexcept {
+inline std::string getModelPathNonFatal() noexcept {
     if (const auto envVar = std::getenv("MODELS_PATH")) {
         return envVar;
     }
@@ -23,11 +23,11 @@ std::string getModelPathNonFatal() noexcept {
 #endif
 }
 
-std::string get_models_path() {
+inline std::string get_models_path() {
     return getModelPathNonFatal() + kPathSeparator + std::string("models");
 };
 
-std::string get_data_path() {
+inline std::string get_data_path() {
     if (const auto envVar = std::getenv("DATA_PATH")) {
         return envVar;
     }
@@ -39,15 +39,15 @@ std::string get_data_path() {
 #endif
 }
 
-std::string generate_model_path(std::string dir, std::string filename) {
+inline std::string generate_model_path(std::string dir, std::string filename) {
     return get_models_path() + kPathSeparator + dir + kPathSeparator + filename;
 }
 
-std::string generate_image_path(std::string dir, std::string filename) {
+inline std::string generate_image_path(std::string dir, std::string filename) {
     return get_data_path() + kPathSeparator + "validation_set" + kPathSeparator + dir + kPathSeparator + filename;
 }
 
-std::string generate_ieclass_xml_path(std::string filename) {
+inline std::string generate_ieclass_xml_path(std::string filename) {
     return getModelPathNonFatal() + kPathSeparator + "ie_class" + kPathSeparator + filename;
 }
 } // namespace TestDataHelpers
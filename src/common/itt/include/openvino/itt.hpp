@@ -10,6 +10,7 @@
 #pragma once
 #include <openvino/function_name.hpp>
 #include <openvino/util/pp.hpp>
+#include <atomic>
 #include <string>
 #include <utility>
 
@@ -34,6 +35,32 @@ namespace openvino
          */
         typedef struct handle_ {} *handle_t;
 
+        /**
+         * @class TaskListener
+         * @ingroup ie_dev_profiling
+         * @brief Receives the annotated tasks independently of Intel ITT, used by the built-in profilers
+         * @details The listener is set per module (shared library) which links the itt library and
+         * receives the tasks of every thread in the order they begin and end. The task names are
+         * the names of the annotation handles, so they live till the end of the process.
+         * Without Intel ITT the handles are named only while the listener is active, like the ITT string
+         * handles are null while no collector is attached, so the handles created before a profiler
+         * starts give unnamed tasks.
+         */
+        class TaskListener
+        {
+        public:
+            virtual void taskBegin(const char* name) = 0;
+            virtual void taskEnd() = 0;
+            virtual void threadName(const char*) {}
+            /**
+             * @brief Returns true while the listener uses the task names, e.g. while a profiler runs
+             */
+            virtual bool isActive() const { return true; }
+
+        protected:
+            ~TaskListener() = default;
+        };
+
 /**
  * @cond
  */
@@ -44,6 +71,7 @@ namespace openvino
             void taskBegin(domain_t d, handle_t t);
             void taskEnd(domain_t d);
             void threadName(const char* name);
+            void setTaskListener(TaskListener* listener);
         }
 /**
  * @endcond
@@ -65,6 +93,17 @@ namespace openvino
             internal::threadName(name.c_str());
         }
 
+        /**
+         * @fn void setTaskListener(TaskListener* listener)
+         * @ingroup ie_dev_profiling
+         * @brief Sets the listener of the annotated tasks of the current module, nullptr removes the listener.
+         * @param listener [in] The listener, it must outlive the tasks of the module
+         */
+        inline void setTaskListener(TaskListener* listener)
+        {
+            internal::setTaskListener(listener);
+        }
+
         inline handle_t handle(char const *name)
         {
             return internal::handle(name);
@@ -80,13 +119,20 @@ namespace openvino
          * @ingroup ie_dev_profiling
          * @brief Create annotation handle with a given name.
          * @details If template function is instantiated with a tag, the handle is created as a singleton.
+         * The null handle is not cached, so the handle is created once the profiling starts.
          * @param name [in] The annotation name
          */
         template <typename Tag>
         handle_t handle(char const *name)
         {
-            static auto h = internal::handle(name);
-            return h;
+            static std::atomic<handle_t> h {nullptr};
+            auto result = h.load(std::memory_order_acquire);
+            if (!result)
+            {
+                result = internal::handle(name);
+                h.store(result, std::memory_order_release);
+            }
+            return result;
         }
 
         template <typename Tag>
@@ -127,6 +173,41 @@ namespace openvino
             ScopedTask& operator=(const ScopedTask&) = delete;
         };
 
+        /**
+         * @class ConditionalScopedTask
+         * @ingroup ie_dev_profiling
+         * @brief Used to annotate section of code like ScopedTask only if the condition checked at runtime holds
+         * @tparam The @p domain parameter is domain type which shoud be defined with OV_ITT_DOMAIN() macro.
+         */
+        template <domain_t(*domain)()>
+        struct ConditionalScopedTask
+        {
+            /**
+             * @brief Construct ConditionalScopedTask with the condition and the annotation handle
+             */
+            ConditionalScopedTask(bool enabled, handle_t taskHandle) noexcept
+                : _enabled(enabled)
+            {
+                if (_enabled)
+                    internal::taskBegin(domain(), taskHandle);
+            }
+
+            /**
+             * @brief The ConditionalScopedTask destructor ends the task scope if it was begun
+             */
+            ~ConditionalScopedTask() noexcept
+            {
+                if (_enabled)
+                    internal::taskEnd(domain());
+            }
+
+            ConditionalScopedTask(const ConditionalScopedTask&) = delete;
+            ConditionalScopedTask& operator=(const ConditionalScopedTask&) = delete;
+
+        private:
+            const bool _enabled;
+        };
+
         /**
          * @class TaskChain
          * @ingroup ie_dev_profiling
@@ -282,6 +363,34 @@ inline openvino::itt::domain_t domainName() noexcept
  */
 #define OV_ITT_SCOPED_TASK(...) OV_ITT_SCOPE(ALL, __VA_ARGS__)
 
+/**
+ * @def OV_ITT_SCOPED_TASK_IF(condition, domain, handle)
+ * @ingroup ie_dev_profiling
+ * @brief Annotate section of code till scope exit like OV_ITT_SCOPED_TASK in the builds with all the counters.
+ * @details The other builds keep the annotation too, but record it only if the condition holds at the scope begin,
+ *          so the section costs a branch while nothing is profiled. The condition is evaluated before the handle.
+ * @param condition [in] Runtime condition to record the section, not evaluated in the builds with all the counters.
+ * @param domainName [in] Known at compile time name of module or library (the domain name).
+ * @param handle [in] The annotation handle for section of code.
+ */
+#define OV_ITT_SCOPED_TASK_IF(condition, domain, handle)                                            \
+    OV_PP_CAT(OV_ITT_SCOPED_TASK_IF_IMPL_, OV_PP_IS_ENABLED(OV_ITT_GROUP(ALL)))(condition, domain, handle)
+
+/**
+ * @cond
+ */
+
+#define OV_ITT_SCOPED_TASK_IF_IMPL_1(condition, domain, handle)                                     \
+        openvino::itt::ScopedTask<domain> OV_PP_CAT(ittScopedTask, __LINE__)(handle);
+
+// the list initialization evaluates the condition first
+#define OV_ITT_SCOPED_TASK_IF_IMPL_0(condition, domain, handle)                                     \
+        openvino::itt::ConditionalScopedTask<domain> OV_PP_CAT(ittScopedTask, __LINE__){condition, handle};
+
+/**
+ * @endcond
+ */
+
 /**
  * @def OV_ITT_TASK_CHAIN(chainId, domain, prefix, taskName)
  * @ingroup ie_dev_profiling
@@ -3,16 +3,26 @@
 //
 
 #include <openvino/itt.hpp>
+#include <atomic>
 #include <cstdlib>
 
 #ifdef ENABLE_PROFILING_ITT
 #include <ittnotify.h>
+#else
+#include <mutex>
+#include <unordered_set>
 #endif
 
 namespace openvino {
 namespace itt {
 namespace internal {
 
+static std::atomic<TaskListener*> taskListener{nullptr};
+
+void setTaskListener(TaskListener* listener) {
+    taskListener.store(listener, std::memory_order_release);
+}
+
 #ifdef ENABLE_PROFILING_ITT
 
 static size_t callStackDepth() {
@@ -23,6 +33,11 @@ static size_t callStackDepth() {
 
 static thread_local uint32_t call_stack_depth = 0;
 
+static const char* handleName(handle_t t) {
+    auto h = reinterpret_cast<__itt_string_handle*>(t);
+    return h && h->strA ? h->strA : "";
+}
+
 domain_t domain(char const* name) {
     return reinterpret_cast<domain_t>(__itt_domain_create(name));
 }
@@ -32,6 +47,8 @@ handle_t handle(char const* name) {
 }
 
 void taskBegin(domain_t d, handle_t t) {
+    if (auto listener = taskListener.load(std::memory_order_acquire))
+        listener->taskBegin(handleName(t));
     if (!callStackDepth() || call_stack_depth++ < callStackDepth())
         __itt_task_begin(reinterpret_cast<__itt_domain*>(d),
                         __itt_null,
@@ -42,23 +59,47 @@ void taskBegin(domain_t d, handle_t t) {
 void taskEnd(domain_t d) {
     if (!callStackDepth() || --call_stack_depth < callStackDepth())
         __itt_task_end(reinterpret_cast<__itt_domain*>(d));
+    if (auto listener = taskListener.load(std::memory_order_acquire))
+        listener->taskEnd();
 }
 
 void threadName(const char* name) {
     __itt_thread_set_name(name);
+    if (auto listener = taskListener.load(std::memory_order_acquire))
+        listener->threadName(name);
 }
 
 #else
 
 domain_t domain(char const *) { return nullptr; }
 
-handle_t handle(char const *) { return nullptr; }
+// Like the ITT string handles, the handle is the interned task name which lives till the end of the process.
+// The names are interned only while the listener is active, otherwise the handle is null like the ITT string
+// handle without a collector, so the annotated code neither locks nor allocates when nothing is profiled.
+handle_t handle(char const *name) {
+    auto listener = taskListener.load(std::memory_order_acquire);
+    if (!listener || !listener->isActive())
+        return nullptr;
+    static std::mutex mutex;
+    static auto names = new std::unordered_set<std::string>();
+    std::lock_guard<std::mutex> lock(mutex);
+    return reinterpret_cast<handle_t>(const_cast<char*>(names->emplace(name).first->c_str()));
+}
 
-void taskBegin(domain_t, handle_t) { }
+void taskBegin(domain_t, handle_t t) {
+    if (auto listener = taskListener.load(std::memory_order_acquire))
+        listener->taskBegin(t ? reinterpret_cast<const char*>(t) : "");
+}
 
-void taskEnd(domain_t) { }
+void taskEnd(domain_t) {
+    if (auto listener = taskListener.load(std::memory_order_acquire))
+        listener->taskEnd();
+}
 
-void threadName(const char *) { }
+void threadName(const char *name) {
+    if (auto listener = taskListener.load(std::memory_order_acquire))
+        listener->threadName(name);
+}
 
 #endif  // ENABLE_PROFILING_ITT
 
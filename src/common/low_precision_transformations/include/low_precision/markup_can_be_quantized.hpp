@@ -33,6 +33,10 @@ public:
     NGRAPH_RTTI_DECLARATION;
     MarkupCanBeQuantized(const std::vector<ngraph::element::Type> defaultPrecisions = { ngraph::element::u8, ngraph::element::i8 });
     bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
+    /**
+     * @brief Marks up one operation. It allows to run several markups in one traversal of the model.
+     */
+    void markupNode(const std::shared_ptr<ngraph::Node>& node);
 private:
     const std::vector<ngraph::element::Type> defaultPrecisions;
 };
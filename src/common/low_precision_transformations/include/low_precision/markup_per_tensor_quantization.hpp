@@ -47,6 +47,10 @@ public:
     NGRAPH_RTTI_DECLARATION;
     explicit MarkupPerTensorQuantization(const std::vector<OperationPerTensorQuantizationRestriction>& restrictions = {});
     bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
+    /**
+     * @brief Marks up one operation. It allows to run several markups in one traversal of the model.
+     */
+    void markupNode(const std::shared_ptr<ngraph::Node>& node);
 
 private:
     std::unordered_map<std::string, PerTensorQuantization> restrictionsByOperation;
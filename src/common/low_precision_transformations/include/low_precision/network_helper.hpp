@@ -146,7 +146,7 @@ public:
     static bool isQuantizeSupported(const std::shared_ptr<opset1::FakeQuantize>& fakeQuantize);
 
     static FakeQuantizeDequantization getDequantization(const std::shared_ptr<const Node>& node,
-        const std::vector<ngraph::element::Type> _defaultPrecisions = precision_set::int8_support,
+        const std::vector<ngraph::element::Type>& _defaultPrecisions = precision_set::int8_support,
         const size_t parentIndex = 0ul,
         const bool inPlace = false);
 
@@ -336,10 +336,18 @@ std::shared_ptr<Node> fold_reshape(Args&&... args) {
     return node;
 }
 
+// The runtime info is keyed by the string built from the attribute type info. The key is built once per attribute type,
+// since the attributes are looked up for each operation by each markup and transformation.
+template <typename T>
+const std::string& getAttributeKey() {
+    static const std::string key = T::get_type_info_static();
+    return key;
+}
+
 template <typename T>
 ov::Any getAttribute(const std::shared_ptr<Node>& node) {
     auto& rt = node->get_rt_info();
-    auto it = rt.find(T::get_type_info_static());
+    auto it = rt.find(getAttributeKey<T>());
     if (it == rt.end()) {
         return {};
     }
@@ -349,7 +357,7 @@ ov::Any getAttribute(const std::shared_ptr<Node>& node) {
 template <typename T>
 ov::Any getAttribute(const Input<Node>& input) {
     auto& rt = input.get_rt_info();
-    auto it = rt.find(T::get_type_info_static());
+    auto it = rt.find(getAttributeKey<T>());
     if (it == rt.end()) {
         return {};
     }
@@ -359,7 +367,7 @@ ov::Any getAttribute(const Input<Node>& input) {
 template <typename T>
 ov::Any getAttributeFromOutput(const Output<Node>& output) {
     auto& rt = output.get_rt_info();
-    auto it = rt.find(T::get_type_info_static());
+    auto it = rt.find(getAttributeKey<T>());
     if (it == rt.end()) {
         return {};
     }
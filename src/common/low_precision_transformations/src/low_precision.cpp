@@ -9,6 +9,7 @@
 #include <ngraph/ngraph.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <ngraph/pass/constant_folding.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph_ops/type_relaxed.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset4.hpp>
@@ -29,6 +30,7 @@
 #include "low_precision/fold_convert.hpp"
 #include "low_precision/pull_reshape_through_dequantization.hpp"
 #include "low_precision/pull_transpose_through_dequantization.hpp"
+#include "low_precision/network_helper.hpp"
 #include "low_precision/rt_info/precisions_attribute.hpp"
 
 // branch specific transformations
@@ -95,11 +97,8 @@ template <typename BaseOp>
 void make_matcher_type_relaxed(ngraph::pass::GraphRewrite* transformation) {
     using namespace ngraph;
 
-    auto is_op_type = [](std::shared_ptr<Node> n) {
-        return !!ov::as_type_ptr<BaseOp>(n);
-    };
-
-    auto p_node = std::make_shared<pattern::op::Label>(element::f32, Shape{}, is_op_type);
+    // the typed root allows GraphRewrite to run the matcher only for the operations of the type
+    auto p_node = pattern::wrap_type<BaseOp>();
 
     ngraph::graph_rewrite_callback callback = [](ngraph::pattern::Matcher& m) {
         auto l_node = std::dynamic_pointer_cast<BaseOp>(m.get_match_root());
@@ -168,25 +167,94 @@ MarkupOptimizations::MarkupOptimizations(
     quantizationRestrictions(quantizationRestrictions),
     params(params) {}
 
+namespace {
+// The FakeQuantize operation is decomposed, if its consumers can be transformed to low precision. Otherwise the
+// dequantization operations are fused back to FakeQuantize by the cleanup transformations.
+bool dequantizationCanBeConsumed(const std::shared_ptr<ngraph::opset1::FakeQuantize>& fakeQuantize) {
+    for (const auto& input : fakeQuantize->output(0).get_target_inputs()) {
+        const auto consumer = input.get_node()->shared_from_this();
+        if (ov::is_type<ngraph::opset1::Result>(consumer)) {
+            continue;
+        }
+
+        if (NetworkHelper::isPrecisionPreserved(consumer)) {
+            return true;
+        }
+
+        const auto precisions = getAttribute<ngraph::PrecisionsAttribute>(input);
+        if (precisions.empty() || !precisions.as<ngraph::PrecisionsAttribute>().value().empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
 bool ngraph::pass::low_precision::MarkupOptimizations::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
-    ngraph::pass::Manager markup(get_pass_config());
-    markup.set_per_pass_validation(false);
-    markup.register_pass<low_precision::MarkupCanBeQuantized>(params.defaultPrecisions);
-    if (!precisionRestrictions.empty()) {
-        markup.register_pass<low_precision::MarkupPrecisions>(precisionRestrictions, params.defaultPrecisions);
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::LPT_LT, "MarkupOptimizations");
+
+    const auto passConfig = get_pass_config();
+    std::shared_ptr<low_precision::MarkupCanBeQuantized> canBeQuantized;
+    if (!passConfig->is_disabled<low_precision::MarkupCanBeQuantized>()) {
+        canBeQuantized = std::make_shared<low_precision::MarkupCanBeQuantized>(params.defaultPrecisions);
+        canBeQuantized->set_pass_config(passConfig);
+    }
+    std::shared_ptr<low_precision::MarkupPrecisions> precisions;
+    if (!precisionRestrictions.empty() && !passConfig->is_disabled<low_precision::MarkupPrecisions>()) {
+        precisions = std::make_shared<low_precision::MarkupPrecisions>(precisionRestrictions, params.defaultPrecisions);
+        precisions->set_pass_config(passConfig);
     }
-    if (!quantizationRestrictions.empty()) {
-        markup.register_pass<low_precision::MarkupPerTensorQuantization>(quantizationRestrictions);
+    std::shared_ptr<low_precision::MarkupPerTensorQuantization> perTensorQuantization;
+    if (!quantizationRestrictions.empty() && !passConfig->is_disabled<low_precision::MarkupPerTensorQuantization>()) {
+        perTensorQuantization = std::make_shared<low_precision::MarkupPerTensorQuantization>(quantizationRestrictions);
+        perTensorQuantization->set_pass_config(passConfig);
     }
-    if (ngraph::op::util::has_op_with_type<ngraph::opset1::AvgPool>(f)) {
+
+    // the node markups don't depend on the other nodes, so they are applied in one traversal of the model
+    bool hasAvgPool = false;
+    bool hasConcat = false;
+    std::vector<std::shared_ptr<opset1::FakeQuantize>> fakeQuantizes;
+    for (const auto& node : f->get_ordered_ops()) {
+        if (canBeQuantized) {
+            canBeQuantized->markupNode(node);
+        }
+        if (precisions) {
+            precisions->markupNode(node);
+        }
+        if (perTensorQuantization) {
+            perTensorQuantization->markupNode(node);
+        }
+
+        hasAvgPool = hasAvgPool || ov::is_type<ngraph::opset1::AvgPool>(node);
+        hasConcat = hasConcat || ov::is_type<ngraph::opset1::Concat>(node);
+        if (const auto fakeQuantize = ov::as_type_ptr<opset1::FakeQuantize>(node)) {
+            fakeQuantizes.push_back(fakeQuantize);
+        }
+    }
+
+    ngraph::pass::Manager markup(passConfig);
+    markup.set_per_pass_validation(false);
+    if (hasAvgPool) {
         markup.register_pass<low_precision::MarkupAvgPoolPrecisionPreserved>(params.defaultPrecisions);
     }
     markup.register_pass<low_precision::PropagatePrecisions>(params);
-    if (ngraph::op::util::has_op_with_type<ngraph::opset1::Concat>(f)) {
+    if (hasConcat) {
         markup.register_pass<low_precision::AlignQuantizationIntervals>(params.defaultPrecisions);
         markup.register_pass<low_precision::AlignQuantizationParameters>(params.defaultPrecisions);
     }
     markup.run_passes(f);
+
+    // avoid the decomposition of FakeQuantize operations which is reverted by the cleanup transformations
+    for (const auto& fakeQuantize : fakeQuantizes) {
+        if (dequantizationCanBeConsumed(fakeQuantize)) {
+            continue;
+        }
+
+        auto attribute = getAttributeFromOutput<PrecisionsAttribute>(fakeQuantize->output(0));
+        if (!attribute.empty()) {
+            attribute.as<PrecisionsAttribute>().value().clear();
+        }
+    }
     return false;
 }
 
@@ -22,6 +22,13 @@ ngraph::pass::low_precision::MarkupCanBeQuantized::MarkupCanBeQuantized(const st
     : defaultPrecisions(defaultPrecisions) {}
 
 bool ngraph::pass::low_precision::MarkupCanBeQuantized::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
+    for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
+        markupNode(node);
+    }
+    return true;
+}
+
+void ngraph::pass::low_precision::MarkupCanBeQuantized::markupNode(const std::shared_ptr<ngraph::Node>& node) {
     auto setEmptyPrecisions = [](const std::shared_ptr<ngraph::Node>& node) {
         for (auto& input : node->inputs()) {
             auto& rt = input.get_rt_info();
@@ -31,35 +38,32 @@ bool ngraph::pass::low_precision::MarkupCanBeQuantized::run_on_model(const std::
         }
     };
 
-    for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
-        if (node->get_input_size() == 0 || transformation_callback(node)) {
-            continue;
-        }
+    if (node->get_input_size() == 0 || transformation_callback(node)) {
+        return;
+    }
 
-        if (const auto convolution = std::dynamic_pointer_cast<ngraph::opset1::Convolution>(node)) {
-            if (!ConvolutionTransformation::isQuantizedStatic(convolution, defaultPrecisions)) {
-                setEmptyPrecisions(convolution);
-            }
-            continue;
+    if (const auto convolution = std::dynamic_pointer_cast<ngraph::opset1::Convolution>(node)) {
+        if (!ConvolutionTransformation::isQuantizedStatic(convolution, defaultPrecisions)) {
+            setEmptyPrecisions(convolution);
         }
-        if (const auto convolutionBackpropData = std::dynamic_pointer_cast<ngraph::opset1::ConvolutionBackpropData>(node)) {
-            if (!ConvolutionBackpropDataTransformation::isQuantizedStatic(convolutionBackpropData, defaultPrecisions)) {
-                setEmptyPrecisions(convolutionBackpropData);
-            }
-            continue;
+        return;
+    }
+    if (const auto convolutionBackpropData = std::dynamic_pointer_cast<ngraph::opset1::ConvolutionBackpropData>(node)) {
+        if (!ConvolutionBackpropDataTransformation::isQuantizedStatic(convolutionBackpropData, defaultPrecisions)) {
+            setEmptyPrecisions(convolutionBackpropData);
         }
-        if (const auto groupConvolution = std::dynamic_pointer_cast<ngraph::opset1::GroupConvolution>(node)) {
-            if (!GroupConvolutionTransformation::isQuantizedStatic(groupConvolution, defaultPrecisions)) {
-                setEmptyPrecisions(groupConvolution);
-            }
-            continue;
+        return;
+    }
+    if (const auto groupConvolution = std::dynamic_pointer_cast<ngraph::opset1::GroupConvolution>(node)) {
+        if (!GroupConvolutionTransformation::isQuantizedStatic(groupConvolution, defaultPrecisions)) {
+            setEmptyPrecisions(groupConvolution);
         }
-        if (const auto concat = std::dynamic_pointer_cast<ngraph::opset1::Concat>(node)) {
-            if (!ConcatTransformation::isQuantizedStatic(concat)) {
-                setEmptyPrecisions(concat);
-            }
-            continue;
+        return;
+    }
+    if (const auto concat = std::dynamic_pointer_cast<ngraph::opset1::Concat>(node)) {
+        if (!ConcatTransformation::isQuantizedStatic(concat)) {
+            setEmptyPrecisions(concat);
         }
+        return;
     }
-    return true;
 }
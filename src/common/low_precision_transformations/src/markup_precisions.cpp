@@ -65,51 +65,55 @@ void setRestriction(
 
 bool ngraph::pass::low_precision::MarkupPrecisions::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
     for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
-        if (node->get_input_size() == 0) {
-            continue;
-        }
+        markupNode(node);
+    }
+    return true;
+}
 
-        if (transformation_callback(node)) {
-            continue;
-        }
+void ngraph::pass::low_precision::MarkupPrecisions::markupNode(const std::shared_ptr<ngraph::Node>& node) {
+    if (node->get_input_size() == 0) {
+        return;
+    }
 
-        // TODO: don't need to set restrictions for not supported operations
-        // if don't set restrictions for not supported operations then accuracy drop appears, issue #59197
-        const bool supported = ov::is_type<opset1::Result>(node) || isSupported(node);
-        if (!supported || !LayerTransformation::canBeTransformedStatic(node, defaultPrecisions)) {
-            setRestriction(node, std::vector<std::pair<size_t, std::vector<ngraph::element::Type>>> { {0ul, {}}});
-            continue;
-        }
+    if (transformation_callback(node)) {
+        return;
+    }
 
-        const bool precisionPreserved = isPrecisionPreserved(node);
-        if (precisionPreserved) {
-            auto& rt = node->get_rt_info();
-            rt.emplace(
-                PrecisionPreservedAttribute::get_type_info_static(),
-                PrecisionPreservedAttribute(precisionPreserved));
-        }
+    // TODO: don't need to set restrictions for not supported operations
+    // if don't set restrictions for not supported operations then accuracy drop appears, issue #59197
+    const bool supported = ov::is_type<opset1::Result>(node) || isSupported(node);
+    if (!supported || !LayerTransformation::canBeTransformedStatic(node, defaultPrecisions)) {
+        setRestriction(node, std::vector<std::pair<size_t, std::vector<ngraph::element::Type>>> { {0ul, {}}});
+        return;
+    }
 
-        const auto& typeInfo = node->get_type_info();
-        auto it = restrictionsByOperation.find(typeInfo.name);
-        if (it != restrictionsByOperation.end()) {
-            const Restriction& r = it->second;
-            if (r.versionIsRequired) {
-                const auto it2 = r.precisionsByVersion.find(typeInfo.version);
-                if (it2 == r.precisionsByVersion.end()) {
-                    continue;
-                }
-
-                const std::vector<std::pair<size_t, std::vector<ngraph::element::Type>>>& precisionsByPort = it2->second;
-                setRestriction(node, precisionsByPort);
-            } else {
-                assert(r.precisionsByVersion.size() == 1ul);
-
-                const std::vector<std::pair<size_t, std::vector<ngraph::element::Type>>>& precisionsByPort = r.precisionsByVersion.begin()->second;
-                setRestriction(node, precisionsByPort);
+    const bool precisionPreserved = isPrecisionPreserved(node);
+    if (precisionPreserved) {
+        auto& rt = node->get_rt_info();
+        rt.emplace(
+            PrecisionPreservedAttribute::get_type_info_static(),
+            PrecisionPreservedAttribute(precisionPreserved));
+    }
+
+    const auto& typeInfo = node->get_type_info();
+    auto it = restrictionsByOperation.find(typeInfo.name);
+    if (it != restrictionsByOperation.end()) {
+        const Restriction& r = it->second;
+        if (r.versionIsRequired) {
+            const auto it2 = r.precisionsByVersion.find(typeInfo.version);
+            if (it2 == r.precisionsByVersion.end()) {
+                return;
             }
+
+            const std::vector<std::pair<size_t, std::vector<ngraph::element::Type>>>& precisionsByPort = it2->second;
+            setRestriction(node, precisionsByPort);
+        } else {
+            assert(r.precisionsByVersion.size() == 1ul);
+
+            const std::vector<std::pair<size_t, std::vector<ngraph::element::Type>>>& precisionsByPort = r.precisionsByVersion.begin()->second;
+            setRestriction(node, precisionsByPort);
         }
     }
-    return true;
 }
 
 template <class Operation>
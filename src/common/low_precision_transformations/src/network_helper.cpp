@@ -672,7 +672,7 @@ std::shared_ptr<opset1::FakeQuantize> NetworkHelper::fuseConvert(const std::shar
 
 bool NetworkHelper::isPrecisionPreserved(const std::shared_ptr<ngraph::Node>& node) {
     auto& rt = node->get_rt_info();
-    auto it = rt.find(PrecisionPreservedAttribute::get_type_info_static());
+    auto it = rt.find(getAttributeKey<PrecisionPreservedAttribute>());
     if (it == rt.end()) {
         return false;
     }
@@ -1300,7 +1300,7 @@ bool NetworkHelper::isQuantizeSupported(const std::shared_ptr<opset1::FakeQuanti
 }
 
 FakeQuantizeDequantization NetworkHelper::getDequantization(const std::shared_ptr<const Node>& node,
-    const std::vector<ngraph::element::Type> defaultPrecisions,
+    const std::vector<ngraph::element::Type>& defaultPrecisions,
     const size_t parentIndex,
     const bool inPlace) {
     auto getDataIndex = [](const std::shared_ptr<ngraph::Node>& node) {
@@ -10,6 +10,8 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <memory>
+#include <mutex>
 
 // Careful reader, don't worry -- it is not the whole OpenCV,
 // it is just a single stand-alone component of it
@@ -686,25 +688,18 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
-
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
-    // 0. This is the first call ever
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    std::tie(last_in, last_out, last_algo) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
@@ -759,6 +754,97 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     return Update::NOTHING;
 }
 
+// Process-wide cache of the compiled slices. A call takes the free slices compiled for the most
+// similar call, so only the concurrently running infer requests need own compiled slices and the
+// requests of the same model don't compile the same computation again.
+class PreprocEngine::CompiledCache {
+    // the number of the idle entries kept for the calls of the different shapes and formats
+    static constexpr size_t capacity = 64;
+
+    std::mutex _mutex;
+    std::vector<std::shared_ptr<CompiledSlices>> _entries;
+    uint64_t _useCounter = 0;
+
+    std::shared_ptr<CompiledSlices> acquire(const CallDesc &call, size_t slices_num, Update &update) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::shared_ptr<CompiledSlices> found;
+        update = Update::REBUILD;
+        for (const auto& entry : _entries) {
+            if (entry->busy || entry->slices.size() != slices_num) {
+                continue;
+            }
+            const auto entryUpdate = needUpdate(entry->call, call);
+            if (entryUpdate == Update::NOTHING) {
+                found = entry;
+                update = Update::NOTHING;
+                break;
+            }
+            if (entryUpdate == Update::RESHAPE && !found) {
+                found = entry;
+                update = Update::RESHAPE;
+            }
+        }
+        if (!found) {
+            found = std::make_shared<CompiledSlices>();
+            found->slices.resize(slices_num);
+            _entries.push_back(found);
+        }
+        found->call = call;
+        found->busy = true;
+        found->lastUse = ++_useCounter;
+        return found;
+    }
+
+    void release(const std::shared_ptr<CompiledSlices> &entry, bool compiled) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        entry->busy = false;
+        if (!compiled) {
+            // the slices may be partially compiled or reshaped if the compilation has failed
+            _entries.erase(std::remove(_entries.begin(), _entries.end(), entry), _entries.end());
+        }
+        while (_entries.size() > capacity) {
+            auto lru = _entries.end();
+            for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+                if (!(*it)->busy && (lru == _entries.end() || (*it)->lastUse < (*lru)->lastUse)) {
+                    lru = it;
+                }
+            }
+            if (lru == _entries.end()) {
+                break;  // all the entries are used by the running calls
+            }
+            _entries.erase(lru);
+        }
+    }
+
+public:
+    static CompiledCache& instance() {
+        static CompiledCache cache;
+        return cache;
+    }
+
+    // Holds the slices taken from the cache for the duration of a call
+    class Lease {
+        CompiledCache &_cache;
+        Update _update = Update::REBUILD;
+        std::shared_ptr<CompiledSlices> _entry;
+        bool _compiled = false;
+
+    public:
+        // the slices taken without an update are compiled already, the other ones are compiled or
+        // reshaped by the call
+        Lease(CompiledCache &cache, const CallDesc &call, size_t slices_num)
+            : _cache(cache), _entry(cache.acquire(call, slices_num, _update)),
+              _compiled(Update::NOTHING == _update) {}
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease() { _cache.release(_entry, _compiled); }
+
+        Update update() const { return _update; }
+        std::vector<cv::GCompiled>& slices() { return _entry->slices; }
+        void setCompiled() { _compiled = true; }
+    };
+};
+
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
@@ -815,72 +901,72 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     return batch;
 }
 
-void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+void PreprocEngine::compileGraph(Opt<cv::GComputation>& lastComputation,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
-    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
-    Update update) {
-
-    const int thread_num =
-#if IE_THREAD == IE_THREAD_OMP
-        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
-#endif
-        0;                  // use all available threads
-
-    // to suppress unused warnings
-    (void)(omp_serial);
-
+    const std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats,
+    std::vector<cv::GCompiled>& compiled_slices, Update update) {
     // Split the whole graph into `total_slices` slices, where
-    // `total_slices` is provided by the parallel runtime and assumed
-    // to be number of threads used.  However it is not guaranteed
+    // `total_slices` is the number of the compiled slices, i.e. the number
+    // of threads of the caller's arena.  However it is not guaranteed
     // that an actual number of threads will be as assumed, so it
     // possible that all slices are processed by the same thread.
     //
-    parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
-        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
+    parallel_nt_static(static_cast<int>(compiled_slices.size()), [&, this](int slice_n, const int total_slices) {
+        //  need to compile (or reshape) own object for a particular ROI
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
 
-        auto& compiled = _lastComp[slice_n];
-        if (Update::REBUILD == update || Update::RESHAPE == update) {
-            //  need to compile (or reshape) own object for a particular ROI
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
-
-            using cv::gapi::own::Rect;
-
-            // current design implies all images in batch are equal
-            const auto& input_plane_mats = batched_input_plane_mats[0];
-            const auto& output_plane_mats = batched_output_plane_mats[0];
-
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
-
-            // remainder shows how many threads must calculate 1 additional row. now these additions
-            // must also be addressed in rect's Y coordinate:
-            int roi_y = 0;
-            if (slice_n < remainder) {
-                lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
-            } else {
-                // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
-                roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
-            }
+        using cv::gapi::own::Rect;
 
-            if (lines_per_thread <= 0) return;  // no job for current thread
+        auto& compiled = compiled_slices[slice_n];
 
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
-            std::vector<Rect> rois(output_plane_mats.size(), roi);
+        // current design implies all images in batch are equal
+        const auto& input_plane_mats = batched_input_plane_mats[0];
+        const auto& output_plane_mats = batched_output_plane_mats[0];
 
-            // TODO: make a ROI a runtime argument to avoid
-            // recompilations
-            auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
-            if (Update::REBUILD == update) {
-                auto& computation = lastComputation.value();
-                compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
-            } else {
-                IE_ASSERT(compiled);
-                compiled.reshape(descrs_of(input_plane_mats), std::move(args));
-            }
+        auto lines_per_thread = output_plane_mats[0].rows / total_slices;
+        const auto remainder = output_plane_mats[0].rows % total_slices;
+
+        // remainder shows how many threads must calculate 1 additional row. now these additions
+        // must also be addressed in rect's Y coordinate:
+        int roi_y = 0;
+        if (slice_n < remainder) {
+            lines_per_thread++;  // 1 additional row
+            roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
+        } else {
+            // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
+            roi_y =
+                remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
         }
 
+        if (lines_per_thread <= 0) return;  // no job for current thread
+
+        auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
+        std::vector<Rect> rois(output_plane_mats.size(), roi);
+
+        // TODO: make a ROI a runtime argument to avoid
+        // recompilations
+        auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
+        if (Update::REBUILD == update) {
+            auto& computation = lastComputation.value();
+            compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
+        } else {
+            IE_ASSERT(compiled);
+            compiled.reshape(descrs_of(input_plane_mats), std::move(args));
+        }
+    });
+}
+
+void PreprocEngine::executeGraph(const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
+    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats,
+    std::vector<cv::GCompiled>& compiled_slices, int batch_size) {
+    parallel_nt_static(static_cast<int>(compiled_slices.size()), [&, this](int slice_n, const int) {
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
+
+        // the slices without rows are not compiled, see compileGraph()
+        if (slice_n >= batched_output_plane_mats[0][0].rows) return;  // no job for current thread
+
+        auto& compiled = compiled_slices[slice_n];
+
         for (int i = 0; i < batch_size; ++i) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
@@ -948,33 +1034,45 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
         IE_THROW()  << "No job to do in the PreProcessing ?";
     }
 
-    const Update update = needUpdate(thisCall);
+    // The rows are tiled between the threads of the arena the request is executed in (i.e. of the
+    // stream), the compiled slices are taken from the cache by their number
+    const int slices_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        std::max(1, parallel_get_max_threads());
 
-    Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
+    // to suppress unused warnings
+    (void)(omp_serial);
 
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
-            // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
-            auto custom_desc = getGDesc(in_desc, inBlob);
-            _lastComputation = cv::util::make_optional(
-                buildGraph(custom_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt));
-        }
+    CompiledCache::Lease compiled(CompiledCache::instance(), thisCall, slices_num);
+    const Update update = compiled.update();
+
+    Opt<cv::GComputation> _lastComputation;
+    if (Update::REBUILD == update) {
+        //  rebuild the graph
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+        // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
+        auto custom_desc = getGDesc(in_desc, inBlob);
+        _lastComputation = cv::util::make_optional(
+            buildGraph(custom_desc,
+                       out_desc,
+                       in_layout,
+                       out_layout,
+                       algorithm,
+                       in_fmt,
+                       out_fmt));
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    if (Update::NOTHING != update) {
+        compileGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, compiled.slices(),
+            update);
+        compiled.setCompiled();
+    }
+    executeGraph(batched_input_plane_mats, batched_output_plane_mats, compiled.slices(), batch_size);
 }
 
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
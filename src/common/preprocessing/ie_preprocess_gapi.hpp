@@ -8,6 +8,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <cstdint>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
@@ -25,31 +26,41 @@ class PreprocEngine {
     using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
-
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
     openvino::itt::handle_t _perf_exec_graph = openvino::itt::handle("Preproc Exec Graph");
     openvino::itt::handle_t _perf_graph_compiling = openvino::itt::handle("Preproc Graph compiling");
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
+
+    // Computation compiled for the row slices of a call. The slices are shared by the engines of
+    // all the infer requests through the process-wide cache and used by one call at a time.
+    struct CompiledSlices {
+        CallDesc call;
+        std::vector<cv::GCompiled> slices;
+        bool busy = false;
+        uint64_t lastUse = 0;
+    };
+    class CompiledCache;
 
-    void executeGraph(Opt<cv::GComputation>& lastComputation,
+    void compileGraph(Opt<cv::GComputation>& lastComputation,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
-                      std::vector<std::vector<cv::gapi::own::Mat>>& dst,
-                      int batch_size,
-                      bool omp_serial,
+                      const std::vector<std::vector<cv::gapi::own::Mat>>& dst,
+                      std::vector<cv::GCompiled>& compiled,
                       Update update);
 
+    void executeGraph(const std::vector<std::vector<cv::gapi::own::Mat>>& src,
+                      std::vector<std::vector<cv::gapi::own::Mat>>& dst,
+                      std::vector<cv::GCompiled>& compiled,
+                      int batch_size);
+
     template<typename BlobTypePtr>
     void preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
         int batch_size);
 
 public:
-    PreprocEngine();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
@@ -61,7 +61,8 @@ using isas_set = typelist<
     //as the search for supported ISA is performed until first match
     scalar_tag>;
 #ifdef HAVE_AVX512
-    inline bool is_present(avx512_tag) { return with_cpu_x86_avx512f(); }
+    // the AVX512 kernels are compiled with AVX512BW and AVX512DQ for the 8-bit lanes
+    inline bool is_present(avx512_tag) { return with_cpu_x86_avx512_core(); }
 #endif  // HAVE_AVX512
 
 #ifdef HAVE_AVX2
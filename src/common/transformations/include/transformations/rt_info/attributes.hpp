@@ -22,6 +22,7 @@
 #include <transformations/rt_info/strides_property.hpp>
 #include <transformations/rt_info/preprocessing_attribute.hpp>
 #include <transformations/rt_info/decompression.hpp>
+#include <transformations/rt_info/keep_const_precision.hpp>
 #include <transformations_visibility.hpp>
 #include <utility>
 
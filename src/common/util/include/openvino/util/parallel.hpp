@@ -0,0 +1,20 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ov {
+namespace util {
+/// \brief Calls the function for each index of [0, work_amount) using up to the hardware concurrency threads.
+///        The calling thread takes part in the work, so no threads are started for a single index.
+///        It is intended for the components which do not depend on the threading of the inference runtime.
+/// \param work_amount The number of indexes.
+/// \param func The function to call, it is called once for each index.
+/// \throw The first exception thrown by the function is rethrown after all the threads are finished.
+void parallel_for(size_t work_amount, const std::function<void(size_t)>& func);
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+void ov::util::parallel_for(size_t work_amount, const std::function<void(size_t)>& func) {
+    std::atomic<size_t> next_idx{0};
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    auto worker = [&] {
+        for (size_t idx = next_idx++; idx < work_amount; idx = next_idx++) {
+            try {
+                func(idx);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+    };
+
+    const size_t threads_num =
+        std::min(work_amount, static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)));
+    std::vector<std::thread> threads;
+    threads.reserve(threads_num > 0 ? threads_num - 1 : 0);
+    for (size_t thread_idx = 1; thread_idx < threads_num; ++thread_idx) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
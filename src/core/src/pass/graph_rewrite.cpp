@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <deque>
 #include <iostream>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <regex>
 #include <unordered_set>
@@ -57,6 +58,37 @@ PerfCounters& perf_counters_graph_rewrite() {
     static PerfCounters counters;
     return counters;
 }
+
+// Collects the types of the operations which can be matched by the pattern root.
+// Returns false if the root can match an operation of any type.
+bool collect_root_types(std::shared_ptr<Node> root, std::vector<NodeTypeInfo>& root_types) {
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and to gen actual root node we need to take it's parent.
+    if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
+        root = any_type->input_value(0).get_node_shared_ptr();
+    }
+
+    if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
+        if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
+            const auto& wrapped_types = any_type->get_wrapped_types();
+            root_types.insert(root_types.end(), wrapped_types.begin(), wrapped_types.end());
+            return true;
+        }
+        // the alternatives of Or are typed if all of them are typed
+        if (std::dynamic_pointer_cast<pattern::op::Or>(p)) {
+            for (const auto& alternative : p->input_values()) {
+                if (!collect_root_types(alternative.get_node_shared_ptr(), root_types)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    root_types.push_back(root->get_type_info());
+    return true;
+}
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -89,6 +121,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     // Check that all Matchers in MatcherPasses has type bases root node
     bool all_roots_has_type = true;
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<NodeTypeInfo> root_types;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
@@ -100,28 +133,21 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
             break;
         }
 
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
-        }
-
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
+        // if root is an operation from opset, has pattern::op::WrapType type or is pattern::op::Or of
+        // such roots then we can extract it's types
+        // and use them in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
         // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
+        root_types.clear();
+        if (!collect_root_types(matcher->get_pattern_value().get_node_shared_ptr(), root_types)) {
+            all_roots_has_type = false;
+            break;
+        }
+        for (const auto& root_type_info : root_types) {
+            auto& matchers = type_to_matcher[root_type_info];
+            // the alternatives of Or may have the same type
+            if (matchers.empty() || matchers.back() != matcher_index) {
+                matchers.push_back(matcher_index);
             }
-        } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
 
         // TODO: traverse parents for root_type_info in order to register complete list of matchers
@@ -160,8 +186,8 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
+    // list of matchers to run for a node type, collected once for all the nodes of the type
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> node_type_to_matchers;
 
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
@@ -186,27 +212,32 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // If all Matchers in MatcherPasses has type based root node then we apply efficient
         // algorithm for finding matchers
         if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+            const auto& node_type_info = node->get_type_info();
+            auto matcher_passes_to_run = node_type_to_matchers.find(node_type_info);
+            if (matcher_passes_to_run == node_type_to_matchers.end()) {
+                std::vector<size_t> matchers_for_type;
+                const DiscreteTypeInfo* type_info = &node_type_info;
+                while (type_info) {
+                    auto matchers = type_to_matcher.find(*type_info);
+                    if (matchers != type_to_matcher.end()) {
+                        // collect the matchers for the type and its parents and sort them in order of the
+                        // registration
+                        matchers_for_type.insert(matchers_for_type.end(),
                                                  matchers->second.begin(),
                                                  matchers->second.end());
+                    }
+                    type_info = type_info->parent;
                 }
-                node_type_info = node_type_info->parent;
-            }
 
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
+                std::sort(matchers_for_type.begin(), matchers_for_type.end());
+                // the matcher is found twice if it is registered for the type and for its parent
+                matchers_for_type.erase(std::unique(matchers_for_type.begin(), matchers_for_type.end()),
+                                        matchers_for_type.end());
+                matcher_passes_to_run =
+                    node_type_to_matchers.emplace(node_type_info, std::move(matchers_for_type)).first;
+            }
 
-            for (size_t matcher_index : matcher_passes_to_run) {
+            for (size_t matcher_index : matcher_passes_to_run->second) {
                 if (run_matcher_pass(m_matchers[matcher_index], node)) {
                     rewritten = true;
                     break;
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <typeinfo>
 #include <unordered_map>
 
 #include "ie_allocator.hpp"  // IE public header
@@ -46,7 +47,7 @@ struct BlobAllocator : public IAllocator {
 
 namespace ov {
 struct BlobAllocator : public runtime::AllocatorImpl {
-    BlobAllocator(const std::shared_ptr<ie::IAllocator>& impl = std::make_shared<ie::SystemMemoryAllocator>())
+    BlobAllocator(const std::shared_ptr<ie::IAllocator>& impl = std::make_shared<ie::PooledMemoryAllocator>())
         : _impl{impl} {}
 
     void* allocate(const size_t bytes, const size_t alignment) override {
@@ -76,8 +77,9 @@ struct BlobAllocator : public runtime::AllocatorImpl {
         auto other_system_memory_allocator =
             dynamic_cast<const ie::SystemMemoryAllocator*>(other_blob_allocator->_impl.get());
         auto system_allocator = dynamic_cast<const ie::SystemMemoryAllocator*>(_impl.get());
+        // the pooled allocator can't free the memory of the plain system allocator and vice versa
         if (system_allocator != nullptr && other_system_memory_allocator != nullptr)
-            return true;
+            return typeid(*system_allocator) == typeid(*other_system_memory_allocator);
         return false;
     }
 
@@ -72,3 +72,32 @@ TEST_P(FrontEndConvertModelTest, test_decode_convert_equal_convert) {
     const FunctionsComparator::Result res = func_comparator(function, function_ref);
     ASSERT_TRUE(res.valid) << res.message;
 }
+
+TEST_P(FrontEndConvertModelTest, test_convert_twice_equal_convert) {
+    ASSERT_NO_THROW(doLoadFromFile());
+    std::shared_ptr<ngraph::Function> function_ref;
+    ASSERT_NO_THROW(function_ref = m_frontEnd->convert(m_inputModel));
+    ASSERT_NE(function_ref, nullptr);
+    std::shared_ptr<ngraph::Function> function;
+    ASSERT_NO_THROW(function = m_frontEnd->convert(m_inputModel));
+    ASSERT_NE(function, nullptr);
+
+    // independent operations are translated concurrently, the names must not depend on the scheduling
+    FunctionsComparator func_comparator = FunctionsComparator::with_default();
+    func_comparator.enable(FunctionsComparator::NAMES);
+    func_comparator.enable(FunctionsComparator::CONST_VALUES);
+    const FunctionsComparator::Result res = func_comparator(function, function_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+
+    // the comparator checks the names of output nodes only, the names of all the named nodes are checked here
+    const auto ops = function->get_ordered_ops();
+    const auto ops_ref = function_ref->get_ordered_ops();
+    ASSERT_EQ(ops.size(), ops_ref.size());
+    for (size_t idx = 0; idx < ops.size(); ++idx) {
+        // the default names are based on the global instance counter, so they differ between conversions
+        if (ops_ref[idx]->get_friendly_name() == ops_ref[idx]->get_name()) {
+            continue;
+        }
+        EXPECT_EQ(ops[idx]->get_friendly_name(), ops_ref[idx]->get_friendly_name());
+    }
+}
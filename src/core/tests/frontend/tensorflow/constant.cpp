@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <numeric>
+#include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "tf_utils.hpp"
+#include "utils.hpp"
+
+using namespace ov::frontend;
+
+TEST(FrontEndConvertModelTest, test_constant_outlives_input_model) {
+    std::shared_ptr<ov::Model> model;
+    {
+        FrontEndManager fem;
+        FrontEnd::Ptr frontEnd;
+        InputModel::Ptr inputModel;
+        ASSERT_NO_THROW(frontEnd = fem.load_by_framework(TF_FE));
+        ASSERT_NE(frontEnd, nullptr);
+        auto model_filename = FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                                                 std::string("shared_constant/shared_constant.pb"));
+        ASSERT_NO_THROW(inputModel = frontEnd->load(model_filename));
+        ASSERT_NE(inputModel, nullptr);
+        ASSERT_NO_THROW(model = frontEnd->convert(inputModel));
+        ASSERT_NE(model, nullptr);
+    }
+
+    // Constant data may reference the parsed model in place, it must stay valid after the input model is released
+    std::vector<float> expected(24);
+    std::iota(expected.begin(), expected.end(), 0.f);
+    size_t num_constants = 0;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(node)) {
+            if (constant->get_friendly_name() != "const1")
+                continue;
+            EXPECT_EQ(constant->get_shape(), (ov::Shape{2, 3, 4}));
+            EXPECT_EQ(constant->cast_vector<float>(), expected);
+            num_constants++;
+        }
+    }
+    EXPECT_EQ(num_constants, 1);
+}
+
+TEST(FrontEndConvertModelTest, test_constant_references_model_data) {
+    FrontEndManager fem;
+    FrontEnd::Ptr frontEnd;
+    InputModel::Ptr inputModel;
+    ASSERT_NO_THROW(frontEnd = fem.load_by_framework(TF_FE));
+    ASSERT_NE(frontEnd, nullptr);
+    auto model_filename = FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                                             std::string("shared_constant/shared_constant.pb"));
+    ASSERT_NO_THROW(inputModel = frontEnd->load(model_filename));
+    ASSERT_NE(inputModel, nullptr);
+
+    auto get_constant_data = [&]() -> const void* {
+        std::shared_ptr<ov::Model> model;
+        EXPECT_NO_THROW(model = frontEnd->convert(inputModel));
+        for (const auto& node : model->get_ordered_ops()) {
+            auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(node);
+            if (constant && constant->get_friendly_name() == "const1") {
+                return constant->get_data_ptr();
+            }
+        }
+        return nullptr;
+    };
+
+    // Both conversions see the tensor content of the same parsed model, the copies would have different addresses
+    const auto data1 = get_constant_data();
+    const auto data2 = get_constant_data();
+    ASSERT_NE(data1, nullptr);
+    EXPECT_EQ(data1, data2);
+}
@@ -0,0 +1,22 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import os
+import sys
+import tensorflow as tf
+
+tf.compat.v1.reset_default_graph()
+
+# Create the graph and model
+with tf.compat.v1.Session() as sess:
+    input1 = tf.compat.v1.placeholder(tf.float32, [2, 3, 4], 'inputX1')
+
+    const1 = tf.constant(np.arange(24).reshape(2, 3, 4), dtype=tf.float32, name="const1")
+
+    tf.add(input1, const1, name="add1")
+
+    tf.compat.v1.global_variables_initializer()
+    tf_net = sess.graph_def
+
+tf.io.write_graph(tf_net, os.path.join(sys.argv[1], "shared_constant"), 'shared_constant.pb', False)
@@ -7,6 +7,8 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -265,6 +267,59 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedMatcherPassOrderForSeveralNodes) {
+    auto data = std::make_shared<opset3::Parameter>(element::f32, Shape{3, 1, 2});
+    auto constant = opset3::Constant::create(element::f32, Shape{1}, {1.5});
+    auto divide1 = std::make_shared<PrivateDivide>(data, constant);
+    auto divide2 = std::make_shared<opset3::Divide>(divide1, constant);
+    auto divide3 = std::make_shared<PrivateDivide>(divide2, constant);
+    auto f = std::make_shared<Function>(NodeVector{divide3}, ParameterVector{data});
+
+    // the matchers collected for the node type are reused for the next nodes of the same type only
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 2);
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+}
+
+class OrBasedTestPass : public ngraph::pass::MatcherPass {
+public:
+    OrBasedTestPass() : MatcherPass() {
+        auto divide = pattern::wrap_type<opset3::Divide>();
+        auto multiply = pattern::wrap_type<opset3::Multiply>();
+        auto root = std::make_shared<pattern::op::Or>(OutputVector{divide, multiply});
+        ngraph::graph_rewrite_callback callback = [](pattern::Matcher& m) {
+            auto relu = std::make_shared<ngraph::opset3::Relu>(m.get_match_root()->input_value(0));
+            ngraph::replace_node(m.get_match_root(), relu);
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(root, "TestMatcher");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, TypeBasedMatcherPassOr) {
+    auto data = std::make_shared<opset3::Parameter>(element::f32, Shape{3, 1, 2});
+    auto constant = opset3::Constant::create(element::f32, Shape{1}, {1.5});
+    auto divide = std::make_shared<PrivateDivide>(data, constant);
+    auto multiply = std::make_shared<opset3::Multiply>(divide, constant);
+    auto add = std::make_shared<opset3::Add>(multiply, constant);
+    auto f = std::make_shared<Function>(NodeVector{add}, ParameterVector{data});
+
+    // the alternatives of Or are registered by their types, the derived Divide is matched by the Divide type
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPass>();
+    anchor.add_matcher<OrBasedTestPass>();
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 2);
+    ASSERT_EQ(count_ops_of_type<opset3::Add>(f), 1);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_function();
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <mutex>
 #include <queue>
@@ -16,6 +17,7 @@
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_vector.hpp"
 #include "openvino/opsets/opset8.hpp"
+#include "openvino/util/parallel.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -182,3 +184,32 @@ TEST(threading, clone_with_new_inputs) {
         th.join();
     }
 }
+
+TEST(threading, util_parallel_for) {
+    const size_t work_amount = 1000;
+    std::vector<std::atomic<size_t>> calls(work_amount);
+    for (auto& call : calls) {
+        call = 0;
+    }
+    ov::util::parallel_for(work_amount, [&](size_t idx) {
+        calls[idx]++;
+    });
+    for (const auto& call : calls) {
+        ASSERT_EQ(call.load(), 1u);
+    }
+
+    std::atomic<size_t> finished{0};
+    EXPECT_THROW(ov::util::parallel_for(work_amount,
+                                        [&](size_t idx) {
+                                            if (idx == work_amount / 2) {
+                                                throw std::runtime_error("error");
+                                            }
+                                            finished++;
+                                        }),
+                 std::runtime_error);
+    ASSERT_EQ(finished.load(), work_amount - 1);
+
+    ov::util::parallel_for(0, [](size_t) {
+        FAIL();
+    });
+}
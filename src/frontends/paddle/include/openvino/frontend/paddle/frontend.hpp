@@ -72,10 +72,14 @@ protected:
     InputModel::Ptr load_impl(const std::vector<ov::Any>& params) const override;
 
 protected:
+    /// \brief Converts operations of the model using func
+    /// \param parallel_translation Translate independent operations consuming only Constants and Parameters
+    ///        concurrently, func must be thread-safe
     static std::shared_ptr<Model> convert_each_node(
         const std::shared_ptr<InputModel>& frontend_model,
         std::function<std::map<std::string, OutputVector>(const std::map<std::string, Output<Node>>&,
-                                                          const std::shared_ptr<OpPlace>&)> func);
+                                                          const std::shared_ptr<OpPlace>&)> func,
+        bool parallel_translation = false);
 
     // m_extensions should be the first member here,
     // m_extensions can contain SO Extension (holder for other Extensions),
@@ -4,6 +4,8 @@
 
 #include "openvino/frontend/paddle/frontend.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <map>
 #include <string>
@@ -17,6 +19,8 @@
 #include "openvino/frontend/paddle/node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/log.hpp"
+#include "openvino/util/parallel.hpp"
 #include "paddle_fw_node.hpp"
 #include "paddle_utils.hpp"
 #include "place.hpp"
@@ -117,6 +121,127 @@ bool normalize_framework_node(const std::shared_ptr<FrameworkNode>& node,
     return true;
 }
 
+// Groups operations by the length of the longest path from the model inputs:
+// operations of the same level do not depend on each other. The original order is kept inside a level.
+// Each operation gets its own level (sequential translation) if parallel translation is disabled or some tensor is
+// produced by several operations, since the first producer in the original order must be registered.
+std::vector<std::vector<size_t>> get_operation_levels(const std::vector<std::shared_ptr<OpPlace>>& op_places,
+                                                      bool parallel_translation) {
+    std::vector<size_t> op_indices;
+    for (size_t op_idx = 0; op_idx < op_places.size(); ++op_idx) {
+        const auto& op_type = op_places[op_idx]->get_desc().type();
+        // inputs and outputs are stored in the model already
+        if (op_type != "feed" && op_type != "fetch") {
+            op_indices.push_back(op_idx);
+        }
+    }
+
+    std::vector<std::vector<size_t>> levels;
+    auto sequential_levels = [&]() {
+        levels.clear();
+        for (const auto op_idx : op_indices) {
+            levels.push_back({op_idx});
+        }
+        return levels;
+    };
+    if (!parallel_translation) {
+        return sequential_levels();
+    }
+
+    std::unordered_map<std::string, size_t> tensor_levels;
+    for (const auto op_idx : op_indices) {
+        const auto& op_desc = op_places[op_idx]->get_desc();
+        size_t level = 0;
+        for (const auto& input_port : op_desc.inputs()) {
+            for (const auto& in_tensor_name : input_port.arguments()) {
+                auto tensor_level = tensor_levels.find(in_tensor_name);
+                if (tensor_level != tensor_levels.end()) {
+                    level = std::max(level, tensor_level->second + 1);
+                }
+            }
+        }
+        for (const auto& output_port : op_desc.outputs()) {
+            for (const auto& out_tensor_name : output_port.arguments()) {
+                if (!tensor_levels.emplace(out_tensor_name, level).second) {
+                    return sequential_levels();
+                }
+            }
+        }
+        if (levels.size() <= level) {
+            levels.resize(level + 1);
+        }
+        levels[level].push_back(op_idx);
+    }
+    return levels;
+}
+
+// Translation state of a single operation.
+// In case of concurrent translation, the operation is translated over placeholders of its inputs, so translators
+// of the same level do not modify the shared producers. Only operations consuming Constants and Parameters are
+// translated concurrently: Constants are copied (the data is shared) and Parameters are represented by Parameters
+// of the same type and shape, so the placeholders give translators the same shapes and values as the producers
+// and the translated nodes stay valid once connected to the producers.
+struct OperationTranslation {
+    OperationTranslation(const std::shared_ptr<OpPlace>& place, const std::map<TensorName, Output<Node>>& nodes)
+        : place(place) {
+        for (const auto& input_port : place->get_desc().inputs()) {
+            for (const auto& in_tensor_name : input_port.arguments()) {
+                auto node_it = nodes.find(in_tensor_name);
+                // missing inputs are reported by the translation
+                if (node_it != nodes.end()) {
+                    inputs.insert(*node_it);
+                }
+            }
+        }
+    }
+
+    bool has_placeholder_inputs() const {
+        return std::all_of(inputs.begin(), inputs.end(), [](const std::pair<const TensorName, Output<Node>>& input) {
+            return ov::is_type<Constant>(input.second.get_node()) || ov::is_type<Parameter>(input.second.get_node());
+        });
+    }
+
+    void make_placeholders() {
+        for (const auto& input : inputs) {
+            const auto& output = input.second;
+            std::shared_ptr<Node> placeholder;
+            if (auto constant = std::dynamic_pointer_cast<Constant>(output.get_node_shared_ptr())) {
+                placeholder = std::make_shared<Constant>(*constant);
+            } else {
+                placeholder = std::make_shared<Parameter>(output.get_element_type(), output.get_partial_shape());
+            }
+            placeholder->set_friendly_name(output.get_node()->get_friendly_name());
+            placeholder->output(0).get_tensor().set_names(output.get_names());
+            placeholders[input.first] = placeholder;
+        }
+        concurrent = true;
+    }
+
+    void connect_placeholders() {
+        for (const auto& placeholder : placeholders) {
+            const auto& input = inputs.at(placeholder.first);
+            for (auto& target_input : placeholder.second.get_target_inputs()) {
+                target_input.replace_source_output(input);
+            }
+            input.get_tensor().add_names(placeholder.second.get_tensor().get_names());
+            for (auto& named_output : outputs) {
+                for (auto& output : named_output.second) {
+                    if (output == placeholder.second) {
+                        output = input;
+                    }
+                }
+            }
+        }
+    }
+
+    std::shared_ptr<OpPlace> place;
+    std::map<TensorName, Output<Node>> inputs;
+    std::map<TensorName, Output<Node>> placeholders;
+    NamedOutputs outputs;
+    bool concurrent = false;
+    std::exception_ptr exception;
+};
+
 std::istream* variant_to_stream_ptr(const ov::Any& variant, std::ifstream& ext_stream) {
     if (variant.is<std::istream*>()) {
         return variant.as<std::istream*>();
@@ -140,7 +265,8 @@ FrontEnd::FrontEnd() : m_op_translators(paddle::get_supported_ops()) {}
 std::shared_ptr<ov::Model> FrontEnd::convert_each_node(
     const std::shared_ptr<ov::frontend::InputModel>& frontend_model,
     std::function<std::map<std::string, OutputVector>(const std::map<std::string, Output<Node>>&,
-                                                      const std::shared_ptr<OpPlace>&)> func) {
+                                                      const std::shared_ptr<OpPlace>&)> func,
+    bool parallel_translation) {
     auto model = std::dynamic_pointer_cast<InputModel>(frontend_model);
     FRONT_END_GENERAL_CHECK(model, "Invalid input model");
     auto nodes_dict(model->get_tensor_values());
@@ -159,15 +285,51 @@ std::shared_ptr<ov::Model> FrontEnd::convert_each_node(
         parameter_nodes.push_back(param);
     }
 
+    // operations are translated level by level: operations of the same level do not depend on each other,
+    // so the ones consuming only Constants and Parameters are translated concurrently, the others are translated
+    // in the original order while the concurrent ones are wired up
     const auto& op_places = model->get_op_places();
-    for (const auto& op_place : op_places) {
-        const auto& op_desc = op_place->get_desc();
-        if (op_desc.type() == "feed" || op_desc.type() == "fetch") {
-            // inputs and outputs are stored in the model already
-            continue;
-        } else {
-            paddle::NamedOutputs named_outputs = func(nodes_dict, op_place);
+    const auto translation_start = std::chrono::steady_clock::now();
+    const auto op_levels = paddle::get_operation_levels(op_places, parallel_translation);
+    size_t translated_ops = 0;
+    for (const auto& level : op_levels) {
+        std::vector<paddle::OperationTranslation> translations;
+        for (const auto op_idx : level) {
+            translations.emplace_back(op_places[op_idx], nodes_dict);
+        }
+
+        std::vector<paddle::OperationTranslation*> concurrent_translations;
+        for (auto& translation : translations) {
+            if (translation.has_placeholder_inputs()) {
+                concurrent_translations.push_back(&translation);
+            }
+        }
+        if (concurrent_translations.size() > 1) {
+            for (auto translation : concurrent_translations) {
+                translation->make_placeholders();
+            }
+            ov::util::parallel_for(concurrent_translations.size(), [&](size_t idx) {
+                auto& translation = *concurrent_translations[idx];
+                try {
+                    translation.outputs = func(translation.placeholders, translation.place);
+                } catch (...) {
+                    translation.exception = std::current_exception();
+                }
+            });
+        }
+
+        for (auto& translation : translations) {
+            if (translation.exception) {
+                std::rethrow_exception(translation.exception);
+            }
+            if (translation.concurrent) {
+                translation.connect_placeholders();
+            } else {
+                translation.outputs = func(nodes_dict, translation.place);
+            }
 
+            const auto& op_desc = translation.place->get_desc();
+            const auto& named_outputs = translation.outputs;
             if (!named_outputs.empty()) {
                 if (!op_desc.outputs().begin()->arguments().empty()) {
                     const auto& tensor_name = op_desc.outputs().begin()->arguments()[0];
@@ -195,7 +357,14 @@ std::shared_ptr<ov::Model> FrontEnd::convert_each_node(
                 }
             }
         }
+        translated_ops += translations.size();
     }
+    const auto translation_time = std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+                                      std::chrono::steady_clock::now() - translation_start)
+                                      .count();
+    OPENVINO_DEBUG << "Translated " << translated_ops << " operations in " << op_levels.size() << " levels for "
+                   << translation_time << " ms ("
+                   << (translation_time > 0 ? translated_ops * 1000.0 / translation_time : 0.0) << " operations/s)";
 
     for (const auto& _outp_place : model->get_outputs()) {
         const auto& outp_place = std::dynamic_pointer_cast<TensorPlace>(_outp_place);
@@ -301,7 +470,8 @@ std::shared_ptr<ov::Model> FrontEnd::convert(const InputModel::Ptr& model) const
         paddle_model,
         [&](const std::map<std::string, Output<Node>>& nodes_dict, const std::shared_ptr<OpPlace>& op_place) {
             return paddle::make_ng_node(nodes_dict, op_place, m_op_translators);
-        });
+        },
+        m_conversion_extensions.empty());
     return f;
 }
 
@@ -342,7 +512,8 @@ std::shared_ptr<ov::Model> FrontEnd::convert_partially(const InputModel::Ptr& mo
                 named_outputs = paddle::make_framework_node(nodes_dict, op_place);
             }
             return named_outputs;
-        });
+        },
+        m_conversion_extensions.empty());
     return f;
 }
 
@@ -350,7 +521,7 @@ std::shared_ptr<ov::Model> FrontEnd::decode(const InputModel::Ptr& model) const
     auto paddle_model = std::dynamic_pointer_cast<InputModel>(model);
     FRONT_END_GENERAL_CHECK(paddle_model != nullptr, "Invalid input model");
 
-    auto f = convert_each_node(paddle_model, paddle::make_framework_node);
+    auto f = convert_each_node(paddle_model, paddle::make_framework_node, true);
     return f;
 }
 
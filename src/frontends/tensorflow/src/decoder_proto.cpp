@@ -43,6 +43,18 @@ ov::Any DecoderProto::get_native_attribute(const std::string& name) const {
     }
 }
 
+std::shared_ptr<const ::tensorflow::TensorProto> DecoderProto::get_tensor_attribute(const std::string& name) const {
+    if (!m_owner) {
+        return nullptr;
+    }
+    const auto& attr_map = m_node_def->attr();
+    auto it = attr_map.find(name);
+    if (it == attr_map.end() || it->second.value_case() != ::tensorflow::AttrValue::ValueCase::kTensor) {
+        return nullptr;
+    }
+    return std::shared_ptr<const ::tensorflow::TensorProto>(m_owner, &it->second.tensor());
+}
+
 ov::Any DecoderProto::get_attribute(const std::string& name) const {
     auto attrs = decode_attribute_helper(name);
     if (attrs.empty()) {
@@ -168,10 +180,10 @@ const std::string& DecoderProto::get_op_name() const {
 }
 
 std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
-    if (attr_map.contains(name)) {
-        auto value = m_node_def->attr().at(name);
-        return {value};
+    const auto& attr_map = m_node_def->attr();
+    auto it = attr_map.find(name);
+    if (it != attr_map.end()) {
+        return {it->second};
     } else {
         return {};
     }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -20,10 +21,20 @@ class DecoderProto : public ov::frontend::tensorflow::DecoderBase {
 public:
     explicit DecoderProto(const ::tensorflow::NodeDef* node_def) : m_node_def(node_def) {}
 
+    /// \brief Creates decoder that shares the ownership of the model that contains node_def
+    /// Tensor attributes can be accessed in place by get_tensor_attribute without copying the tensor content.
+    DecoderProto(const ::tensorflow::NodeDef* node_def, const std::shared_ptr<const void>& owner)
+        : m_node_def(node_def),
+          m_owner(owner) {}
+
     ov::Any get_attribute(const std::string& name) const override;
 
     ov::Any get_native_attribute(const std::string& name) const override;
 
+    /// \brief Returns the tensor attribute referencing the model data in place and keeping the model alive
+    /// Returns nullptr if the decoder doesn't share the ownership of the model or the attribute is not a tensor
+    std::shared_ptr<const ::tensorflow::TensorProto> get_tensor_attribute(const std::string& name) const;
+
     size_t get_input_size() const override;
 
     void get_input_node(size_t input_port_idx,
@@ -37,6 +48,7 @@ public:
 private:
     std::vector<::tensorflow::AttrValue> decode_attribute_helper(const std::string& name) const;
     const ::tensorflow::NodeDef* m_node_def;
+    std::shared_ptr<const void> m_owner;
 };
 }  // namespace tensorflow
 }  // namespace frontend
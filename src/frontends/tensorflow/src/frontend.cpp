@@ -4,12 +4,16 @@
 
 #include "openvino/frontend/tensorflow/frontend.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 #include "input_model.hpp"
 #include "op_table.hpp"
 #include "openvino/frontend/tensorflow/extension/conversion.hpp"
 #include "openvino/frontend/tensorflow/graph_iterator.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/parallel.hpp"
 #include "pass/transpose_sinking.hpp"
 #include "so_extension.hpp"
 #include "tf_framework_node.hpp"
@@ -38,6 +42,100 @@ void translate_framework_node(const std::shared_ptr<FrameworkNode>& node,
         old_output->replace(*new_output);
     }
 }
+
+// Groups operations by the length of the longest path from the model inputs:
+// operations of the same level do not depend on each other. The original order is kept inside a level.
+std::vector<std::vector<size_t>> get_operation_levels(const std::vector<std::shared_ptr<OpPlace>>& operation_places) {
+    std::unordered_map<std::string, size_t> place_levels;
+    std::vector<std::vector<size_t>> levels;
+    for (size_t place_idx = 0; place_idx < operation_places.size(); ++place_idx) {
+        const auto& operation_place = operation_places[place_idx];
+        const auto& operation_decoder = operation_place->get_decoder();
+        size_t level = 0;
+        // Constants with input edges are translated without inputs
+        if (operation_decoder->get_op_type() != "Const") {
+            for (size_t input_port_idx = 0; input_port_idx < operation_decoder->get_input_size(); ++input_port_idx) {
+                std::string producer_name;
+                size_t producer_port_idx;
+                try {
+                    operation_decoder->get_input_node(input_port_idx, producer_name, producer_port_idx);
+                } catch (const std::exception&) {
+                    // the error is reported during the translation
+                    continue;
+                }
+                auto producer_level = place_levels.find(producer_name);
+                if (producer_level != place_levels.end()) {
+                    level = std::max(level, producer_level->second + 1);
+                }
+            }
+        }
+        place_levels[operation_place->get_names()[0]] = level;
+        if (levels.size() <= level) {
+            levels.resize(level + 1);
+        }
+        levels[level].push_back(place_idx);
+    }
+    return levels;
+}
+
+// Translation state of a single operation.
+// In case of concurrent translation, the operation is translated over placeholders of its inputs, so translators
+// of the same level do not modify the shared producers. Only operations consuming Constants and Parameters are
+// translated concurrently: Constants are copied (the data is shared) and Parameters are represented by Parameters
+// of the same type and shape, so the placeholders give translators the same shapes and values as the producers
+// and the translated nodes stay valid once connected to the producers.
+struct OperationTranslation {
+    OperationTranslation(size_t place_idx, const std::shared_ptr<OpPlace>& place, ov::OutputVector&& inputs)
+        : place_idx(place_idx),
+          place(place),
+          inputs(std::move(inputs)) {}
+
+    bool has_placeholder_inputs() const {
+        return std::all_of(inputs.begin(), inputs.end(), [](const ov::Output<ov::Node>& input) {
+            return ov::is_type<ov::opset8::Constant>(input.get_node()) ||
+                   ov::is_type<ov::opset8::Parameter>(input.get_node());
+        });
+    }
+
+    void make_placeholders() {
+        placeholders.reserve(inputs.size());
+        for (const auto& input : inputs) {
+            std::shared_ptr<ov::Node> placeholder;
+            if (auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(input.get_node_shared_ptr())) {
+                placeholder = std::make_shared<ov::opset8::Constant>(*constant);
+            } else {
+                placeholder =
+                    std::make_shared<ov::opset8::Parameter>(input.get_element_type(), input.get_partial_shape());
+            }
+            placeholder->set_friendly_name(input.get_node()->get_friendly_name());
+            placeholder->output(0).get_tensor().set_names(input.get_names());
+            placeholders.push_back(placeholder);
+        }
+        concurrent = true;
+    }
+
+    void connect_placeholders() {
+        for (size_t idx = 0; idx < placeholders.size(); ++idx) {
+            for (auto& target_input : placeholders[idx].get_target_inputs()) {
+                target_input.replace_source_output(inputs[idx]);
+            }
+            inputs[idx].get_tensor().add_names(placeholders[idx].get_tensor().get_names());
+            for (auto& output : outputs) {
+                if (output == placeholders[idx]) {
+                    output = inputs[idx];
+                }
+            }
+        }
+    }
+
+    size_t place_idx;
+    std::shared_ptr<OpPlace> place;
+    ov::OutputVector inputs;
+    ov::OutputVector placeholders;
+    ov::OutputVector outputs;
+    bool concurrent = false;
+    std::exception_ptr exception;
+};
 }  // namespace
 
 FrontEnd::FrontEnd() : m_op_translators(tensorflow::op::get_supported_ops()) {}
@@ -97,99 +195,168 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
     }
 
     // create the OV ops from TensorFlow ops
-    for (const auto& operation_place : operation_places) {
-        auto operation_decoder = operation_place->get_decoder();
-        auto operation_name = operation_place->get_names()[0];
-        // output for parameter nodes has been already generated
-        if (ng_op_map.count(operation_name)) {
-            continue;
-        }
+    // operations are translated level by level: operations of the same level do not depend on each other,
+    // so the ones consuming only Constants and Parameters are translated concurrently, the others are translated
+    // in the original order while the concurrent ones are wired up
+    // custom translators from conversion extensions are not guaranteed to be thread-safe
+    const bool parallel_translation = m_conversion_extensions.empty();
+    const auto translation_start = std::chrono::steady_clock::now();
+    const auto operation_levels = get_operation_levels(operation_places);
+    size_t translated_operations = 0;
+    // Parameters and Results produced by operations are collected in the original order of operations
+    std::map<size_t, ov::ParameterVector> operation_params;
+    std::map<size_t, ov::ResultVector> operation_results;
+    for (const auto& level : operation_levels) {
+        std::vector<OperationTranslation> translations;
+        for (const auto place_idx : level) {
+            const auto& operation_place = operation_places[place_idx];
+            auto operation_decoder = operation_place->get_decoder();
+            auto operation_name = operation_place->get_names()[0];
+            // output for parameter nodes has been already generated
+            if (ng_op_map.count(operation_name)) {
+                continue;
+            }
 
-        // prepare a list of OV node inputs for each node
-        ov::OutputVector ng_inputs;
-        for (size_t input_port_idx = 0; input_port_idx < operation_decoder->get_input_size(); ++input_port_idx) {
-            // TODO: Implement more general approach. Skipping Constants that have input edges
-            if (operation_decoder->get_op_type() == "Const") {
-                break;
+            // prepare a list of OV node inputs for each node
+            ov::OutputVector ng_inputs;
+            for (size_t input_port_idx = 0; input_port_idx < operation_decoder->get_input_size(); ++input_port_idx) {
+                // TODO: Implement more general approach. Skipping Constants that have input edges
+                if (operation_decoder->get_op_type() == "Const") {
+                    break;
+                }
+                std::string producer_name;
+                size_t producer_port_idx;
+                try {
+                    operation_decoder->get_input_node(input_port_idx, producer_name, producer_port_idx);
+                } catch (const std::exception& e) {
+                    FRONT_END_THROW("[ ERROR ] Exception happened when preparing input " +
+                                    std::to_string(input_port_idx) + " for op '" + operation_decoder->get_op_name() +
+                                    "', expected input name: '" + producer_name +
+                                    "', expected input port index: " + std::to_string(producer_port_idx) + '\n');
+                }
+                // TODO: re-implement the logic below once Place graph structure is implemented
+                // Using Place graph structure (OpPlace, In/OutPortPlace places and their connections) can give
+                // names of ports and operations that can be used for further check about existence in ng_op_map
+
+                // check if output vector for places have been already defined and the order of this check is
+                // important it moves from places corresponding to input port of the current operation node to
+                // output port of original producers
+                if (ng_op_map.count(std::to_string(input_port_idx) + ":" + operation_name)) {
+                    const auto& input_outputs_vector =
+                        ng_op_map.at(std::to_string(input_port_idx) + ":" + operation_name);
+                    FRONT_END_GENERAL_CHECK(input_outputs_vector.size() == 1,
+                                            "Input created with pruning must have one output");
+                    ng_inputs.push_back(input_outputs_vector.at(0));
+                } else if (ng_op_map.count(producer_name + ":" + std::to_string(producer_port_idx))) {
+                    const auto& input_outputs_vector =
+                        ng_op_map.at(producer_name + ":" + std::to_string(producer_port_idx));
+                    FRONT_END_GENERAL_CHECK(input_outputs_vector.size() == 1,
+                                            "Input created with pruning must have one output");
+                    ng_inputs.push_back(input_outputs_vector.at(0));
+                } else if (ng_op_map.count(producer_name)) {
+                    const auto& input_outputs_vector = ng_op_map.at(producer_name);
+                    FRONT_END_GENERAL_CHECK(input_outputs_vector.size() > producer_port_idx,
+                                            "Input created with pruning must have one output");
+                    ng_inputs.push_back(input_outputs_vector.at(producer_port_idx));
+                } else {
+                    FRONT_END_GENERAL_CHECK(false,
+                                            "No input is found for node \"" + operation_name + "\" by port " +
+                                                std::to_string(producer_port_idx));
+                }
             }
-            std::string producer_name;
-            size_t producer_port_idx;
+            translations.emplace_back(place_idx, operation_place, std::move(ng_inputs));
+        }
+
+        auto translate = [&](OperationTranslation& translation) {
+            const auto& operation_decoder = translation.place->get_decoder();
+            const auto& ng_inputs = translation.concurrent ? translation.placeholders : translation.inputs;
+            // generate OV node output vector for the current operation node
             try {
-                operation_decoder->get_input_node(input_port_idx, producer_name, producer_port_idx);
-            } catch (const std::exception& e) {
-                FRONT_END_THROW("[ ERROR ] Exception happened when preparing input " + std::to_string(input_port_idx) +
-                                " for op '" + operation_decoder->get_op_name() + "', expected input name: '" +
-                                producer_name + "', expected input port index: " + std::to_string(producer_port_idx) +
-                                '\n');
+                auto op_fun = translate_map.find(operation_decoder->get_op_type());
+                FRONT_END_OP_CONVERSION_CHECK(op_fun != translate_map.end(),
+                                              "No translator found for " + operation_decoder->get_op_type() +
+                                                  " node.");
+                // NodeContext node_context(ng_inputs, operation_decoder, model_inputs);
+                // TODO: Check why NodeContextNew doesn't have ngOutputVector ng_inputs input in constructor
+                NodeContext node_context(*operation_decoder, ng_inputs);
+                // generate OV node output vector using translator for given operation type
+                translation.outputs = op_fun->second(node_context);
+            } catch (...) {
+                if (fail_fast) {
+                    // re-throw any exception
+                    throw;
+                } else {
+                    auto ng_node = std::make_shared<FrameworkNode>(operation_decoder,
+                                                                   ng_inputs,
+                                                                   translation.place->get_output_ports().size());
+                    set_node_name(translation.place->get_names()[0], ng_node);
+                    translation.outputs = ng_node->outputs();
+                }
             }
-            // TODO: re-implement the logic below once Place graph structure is implemented
-            // Using Place graph structure (OpPlace, In/OutPortPlace places and their connections) can give
-            // names of ports and operations that can be used for further check about existence in ng_op_map
-
-            // check if output vector for places have been already defined and the order of this check is important
-            // it moves from places corresponding to input port of the current operation node to output port of original
-            // producers
-            if (ng_op_map.count(std::to_string(input_port_idx) + ":" + operation_name)) {
-                const auto& input_outputs_vector = ng_op_map.at(std::to_string(input_port_idx) + ":" + operation_name);
-                FRONT_END_GENERAL_CHECK(input_outputs_vector.size() == 1,
-                                        "Input created with pruning must have one output");
-                ng_inputs.push_back(input_outputs_vector.at(0));
-            } else if (ng_op_map.count(producer_name + ":" + std::to_string(producer_port_idx))) {
-                const auto& input_outputs_vector =
-                    ng_op_map.at(producer_name + ":" + std::to_string(producer_port_idx));
-                FRONT_END_GENERAL_CHECK(input_outputs_vector.size() == 1,
-                                        "Input created with pruning must have one output");
-                ng_inputs.push_back(input_outputs_vector.at(0));
-            } else if (ng_op_map.count(producer_name)) {
-                const auto& input_outputs_vector = ng_op_map.at(producer_name);
-                FRONT_END_GENERAL_CHECK(input_outputs_vector.size() > producer_port_idx,
-                                        "Input created with pruning must have one output");
-                ng_inputs.push_back(input_outputs_vector.at(producer_port_idx));
-            } else {
-                FRONT_END_GENERAL_CHECK(false,
-                                        "No input is found for node \"" + operation_name + "\" by port " +
-                                            std::to_string(producer_port_idx));
+        };
+
+        std::vector<OperationTranslation*> concurrent_translations;
+        if (parallel_translation) {
+            for (auto& translation : translations) {
+                if (translation.has_placeholder_inputs()) {
+                    concurrent_translations.push_back(&translation);
+                }
             }
         }
-
-        // generate OV node output vector for the current operation node
-        ov::OutputVector ng_outputs;
-        try {
-            FRONT_END_OP_CONVERSION_CHECK(translate_map.count(operation_decoder->get_op_type()),
-                                          "No translator found for " + operation_decoder->get_op_type() + " node.");
-            auto op_fun = &(translate_map[operation_decoder->get_op_type()]);
-            // NodeContext node_context(ng_inputs, operation_decoder, model_inputs);
-            // TODO: Check why NodeContextNew doesn't have ngOutputVector ng_inputs input in constructor
-            NodeContext node_context(*operation_decoder, ng_inputs);
-            // generate OV node output vector using translator for given operation type
-            ng_outputs = (*op_fun)(node_context);
-        } catch (...) {
-            if (fail_fast) {
-                // re-throw any exception
-                throw;
-            } else {
-                auto ng_node = std::make_shared<FrameworkNode>(operation_decoder,
-                                                               ng_inputs,
-                                                               operation_place->get_output_ports().size());
-                set_node_name(operation_name, ng_node);
-                ng_outputs = ng_node->outputs();
+        if (concurrent_translations.size() > 1) {
+            for (auto translation : concurrent_translations) {
+                translation->make_placeholders();
             }
+            ov::util::parallel_for(concurrent_translations.size(), [&](size_t idx) {
+                try {
+                    translate(*concurrent_translations[idx]);
+                } catch (...) {
+                    concurrent_translations[idx]->exception = std::current_exception();
+                }
+            });
         }
 
-        // register OV node outputs in the map for new operation node
-        for (const auto& output : ng_outputs) {
-            if (auto result = std::dynamic_pointer_cast<ov::opset8::Result>(output.get_node_shared_ptr())) {
-                // do not add RetVal type operation to ng_op_map
-                results.push_back(result);
+        for (auto& translation : translations) {
+            if (translation.exception) {
+                std::rethrow_exception(translation.exception);
+            }
+            if (translation.concurrent) {
+                translation.connect_placeholders();
             } else {
-                auto param = std::dynamic_pointer_cast<ov::opset8::Parameter>(output.get_node_shared_ptr());
-                if (param && operation_decoder->get_op_type() != "Identity") {
-                    params.push_back(param);
+                translate(translation);
+            }
+
+            // register OV node outputs in the map for new operation node
+            const auto& operation_name = translation.place->get_names()[0];
+            const auto& operation_type = translation.place->get_decoder()->get_op_type();
+            for (const auto& output : translation.outputs) {
+                if (auto result = std::dynamic_pointer_cast<ov::opset8::Result>(output.get_node_shared_ptr())) {
+                    // do not add RetVal type operation to ng_op_map
+                    operation_results[translation.place_idx].push_back(result);
+                } else {
+                    auto param = std::dynamic_pointer_cast<ov::opset8::Parameter>(output.get_node_shared_ptr());
+                    if (param && operation_type != "Identity") {
+                        operation_params[translation.place_idx].push_back(param);
+                    }
+                    ng_op_map[operation_name].push_back(output);
                 }
-                ng_op_map[operation_name].push_back(output);
             }
         }
+        translated_operations += translations.size();
+    }
+    for (const auto& operation_param : operation_params) {
+        params.insert(params.end(), operation_param.second.begin(), operation_param.second.end());
+    }
+    for (const auto& operation_result : operation_results) {
+        results.insert(results.end(), operation_result.second.begin(), operation_result.second.end());
     }
+    const auto translation_time = std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+                                      std::chrono::steady_clock::now() - translation_start)
+                                      .count();
+    OPENVINO_DEBUG << "Translated " << translated_operations << " operations in " << operation_levels.size()
+                   << " levels for " << translation_time << " ms ("
+                   << (translation_time > 0 ? translated_operations * 1000.0 / translation_time : 0.0)
+                   << " operations/s)";
 
     // create Result nodes for all model outputs
     for (const auto& model_output : model_outputs) {
@@ -7,6 +7,7 @@
 #include <fstream>
 
 #include "decoder_proto.hpp"
+#include "google/protobuf/arena.h"
 #include "graph.pb.h"
 #include "node_def.pb.h"
 #include "openvino/frontend/exception.hpp"
@@ -22,9 +23,17 @@ class GraphIteratorProto : public GraphIterator {
     size_t node_index = 0;
     std::shared_ptr<::tensorflow::GraphDef> m_graph_def;
 
+    // GraphDef is allocated on the arena, the arena is released together with the last reference to the GraphDef.
+    // Decoders share the ownership, so Constants created as views over tensor data keep the data alive.
+    static std::shared_ptr<::tensorflow::GraphDef> create_graph_def() {
+        auto arena = std::make_shared<::google::protobuf::Arena>();
+        auto graph_def = ::google::protobuf::Arena::CreateMessage<::tensorflow::GraphDef>(arena.get());
+        return std::shared_ptr<::tensorflow::GraphDef>(arena, graph_def);
+    }
+
 public:
     template <typename T>
-    GraphIteratorProto(const std::basic_string<T>& path) : m_graph_def(std::make_shared<::tensorflow::GraphDef>()) {
+    GraphIteratorProto(const std::basic_string<T>& path) : m_graph_def(create_graph_def()) {
         std::ifstream pb_stream(path, std::ios::in | std::ifstream::binary);
 
         FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file does not exist");
@@ -55,7 +64,7 @@ public:
 
     /// Return NodeContext for the current node that iterator points to
     std::shared_ptr<DecoderBase> get_decoder() const override {
-        return std::make_shared<DecoderProto>(m_nodes[node_index]);
+        return std::make_shared<DecoderProto>(m_nodes[node_index], m_graph_def);
     }
 };
 
@@ -4,6 +4,10 @@
 
 #include "utils.hpp"
 
+#include <cstdint>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+
 void ov::frontend::tensorflow::tf_shape_to_ov_shape(const ::tensorflow::TensorShapeProto& tf_shape,
                                                     ov::PartialShape* ng_shape) {
     std::vector<ov::Dimension> dims;
@@ -27,3 +31,45 @@ void ov::frontend::tensorflow::set_node_name(const std::string& node_name, const
 void ov::frontend::tensorflow::set_out_name(const std::string& out_name, const ov::Output<ov::Node>& output) {
     output.get_tensor().add_names({out_name});
 }
+
+std::shared_ptr<const ::tensorflow::TensorProto> ov::frontend::tensorflow::get_const_tensor_proto(
+    const NodeContext& node) {
+    TENSORFLOW_OP_VALIDATION(node, node.get_op_type() == "Const", "Node is expected to be Constant.");
+    // TODO: investigate why as<>() && method using std::move leads to the issue (75371) in OVTF integration with
+    //  tensorflow frontend. The current fix: replace it with as<>() & method. But in fact, both
+    //  approaches should work the same way.
+    const auto* decoder = node.get_decoder();
+    if (const auto* decoder_proto = dynamic_cast<const DecoderProto*>(decoder)) {
+        if (auto tensor_proto = decoder_proto->get_tensor_attribute("value")) {
+            return tensor_proto;
+        }
+    }
+    auto value = decoder->get_native_attribute("value");
+    return std::make_shared<::tensorflow::TensorProto>(value.as<::tensorflow::TensorProto>());
+}
+
+std::shared_ptr<ov::opset8::Constant> ov::frontend::tensorflow::make_shared_const_op(
+    const NodeContext& node,
+    const std::shared_ptr<const ::tensorflow::TensorProto>& tensor_proto,
+    const ov::element::Type& et) {
+    const auto& tensor_content = tensor_proto->tensor_content();
+    if (tensor_content.empty() || !tensor_proto->has_tensor_shape()) {
+        return nullptr;
+    }
+
+    ov::PartialShape pshape;
+    tf_shape_to_ov_shape(tensor_proto->tensor_shape(), &pshape);
+    TENSORFLOW_OP_VALIDATION(node, pshape.is_static(), "Dynamic shapes are not supported in Constant conversion.");
+    const auto shape = pshape.get_shape();
+    auto data = const_cast<char*>(tensor_content.data());
+    if (tensor_content.size() != ov::shape_size(shape) * et.size() ||
+        reinterpret_cast<uintptr_t>(data) % et.size() != 0) {
+        return nullptr;
+    }
+
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<const ::tensorflow::TensorProto>>>(
+        data,
+        tensor_content.size(),
+        tensor_proto);
+    return std::make_shared<ov::opset8::Constant>(et, shape, buffer);
+}
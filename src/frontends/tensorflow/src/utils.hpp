@@ -81,45 +81,42 @@ void get_const_input(const NodeContext& node, int64_t input_index, std::vector<T
     FRONT_END_THROW("Node must be converted to Constant.");
 }
 
-// Taken from: tensorflow/core/grappler/optimizers/arithmetic_optimizer.cc
-// Extract values from a Const op to `values`. Returns true if succeeds.
-//
-// Modified with an extra `VecT` parameter to handle the case where the type
-// in the std::vector does not match TensorFlow's notion of what the C++ type
-// should be (e.g. when T is `bool`, we actually need a std::vector of `char` for
-// compatibility with OpenVINO).
-template <typename T, typename VecT = T>
-void values_from_const_node(const NodeContext& node, ov::Shape* const_tensor_shape, std::vector<VecT>* values) {
-    TENSORFLOW_OP_VALIDATION(node, node.get_op_type() == "Const", "Node is expected to be Constant.");
-    const auto* decoder = node.get_decoder();
-    auto dt = decoder->get_native_attribute("dtype").as<::tensorflow::DataType>();
+// Returns the "value" attribute of the Const node. When the decoder is DecoderProto sharing the ownership of the model,
+// the returned pointer references the tensor in place and keeps the model data alive, otherwise it holds a copy.
+std::shared_ptr<const ::tensorflow::TensorProto> get_const_tensor_proto(const NodeContext& node);
 
-    // TODO: investigate why as<>() && method using std::move leads to the issue (75371) in OVTF integration with
-    //  tensorflow frontend. The current fix: replace it with as<>() & method. But in fact, both
-    //  approaches should work the same way.
-    // auto tensor_proto = decoder->get_native_attribute("value").as<::tensorflow::TensorProto>();
-    auto value = decoder->get_native_attribute("value");
-    auto tensor_proto = value.as<::tensorflow::TensorProto>();
+// Creates Constant as a view over the tensor_content of the Const node without copying the data.
+// Returns nullptr if the tensor is not stored in the plain form matching the element type and the shape.
+std::shared_ptr<ov::opset8::Constant> make_shared_const_op(
+    const NodeContext& node,
+    const std::shared_ptr<const ::tensorflow::TensorProto>& tensor_proto,
+    const ov::element::Type& et);
+
+template <typename T, typename VecT = T>
+void values_from_tensor_proto(const NodeContext& node,
+                              const ::tensorflow::TensorProto& tensor_proto,
+                              ov::Shape* const_tensor_shape,
+                              std::vector<VecT>* values) {
+    auto dt = node.get_decoder()->get_native_attribute("dtype").as<::tensorflow::DataType>();
 
     const ::tensorflow::TensorShapeProto& shape = tensor_proto.tensor_shape();
     ov::PartialShape pshape;
     tf_shape_to_ov_shape(shape, &pshape);
-    *const_tensor_shape = pshape.get_shape();
     TENSORFLOW_OP_VALIDATION(node, pshape.is_static(), "Dynamic shapes are not supported in Constant conversion.");
-    auto tensor_content = tensor_proto.tensor_content();
-    std::vector<char> tensor_values_plain(tensor_content.begin(), tensor_content.end());
-    const T* tensor_values = reinterpret_cast<const T*>(tensor_values_plain.data());
+    *const_tensor_shape = pshape.get_shape();
+    const auto& tensor_content = tensor_proto.tensor_content();
+    const T* tensor_values = reinterpret_cast<const T*>(tensor_content.data());
 
-    if (!tensor_values_plain.empty() && tensor_proto.has_tensor_shape()) {
+    if (!tensor_content.empty() && tensor_proto.has_tensor_shape()) {
         // When tensor_shape is set, theoretically the representation of the data
         // could be compressed. So, before copying values to the returned vector,
         // make sure no compression happens.
-        // if (shape.dim_size() == 1 && shape.dim(0).size() == tensor_values_plain.size()/sizeof(T)) {
-        values->insert(values->end(), tensor_values, tensor_values + tensor_values_plain.size() / sizeof(T));
+        // if (shape.dim_size() == 1 && shape.dim(0).size() == tensor_content.size()/sizeof(T)) {
+        values->insert(values->end(), tensor_values, tensor_values + tensor_content.size() / sizeof(T));
         return;
         //}
     }
-    const auto tensor_content_size = tensor_proto.tensor_content().size();
+    const auto tensor_content_size = tensor_content.size();
     if (tensor_content_size % sizeof(VecT)) {
         std::cerr << "[ ERROR ] tensor_content_size (" << tensor_content_size << ") is not a multiple of "
                   << sizeof(VecT);
@@ -188,12 +185,31 @@ void values_from_const_node(const NodeContext& node, ov::Shape* const_tensor_sha
     }
 }
 
+// Taken from: tensorflow/core/grappler/optimizers/arithmetic_optimizer.cc
+// Extract values from a Const op to `values`. Returns true if succeeds.
+//
+// Modified with an extra `VecT` parameter to handle the case where the type
+// in the std::vector does not match TensorFlow's notion of what the C++ type
+// should be (e.g. when T is `bool`, we actually need a std::vector of `char` for
+// compatibility with OpenVINO).
+template <typename T, typename VecT = T>
+void values_from_const_node(const NodeContext& node, ov::Shape* const_tensor_shape, std::vector<VecT>* values) {
+    auto tensor_proto = get_const_tensor_proto(node);
+    values_from_tensor_proto<T, VecT>(node, *tensor_proto, const_tensor_shape, values);
+}
+
 template <typename T, typename VecT = T>
 void make_const_op(const NodeContext& node, element::Type et, ov::Output<ov::Node>& ng_node) {
+    auto tensor_proto = get_const_tensor_proto(node);
+    if (auto shared_const = make_shared_const_op(node, tensor_proto, et)) {
+        ng_node = shared_const;
+        return;
+    }
+
     std::vector<VecT> const_values;
     ov::Shape ng_shape;
 
-    values_from_const_node<T, VecT>(node, &ng_shape, &const_values);
+    values_from_tensor_proto<T, VecT>(node, *tensor_proto, &ng_shape, &const_values);
     ng_node = std::make_shared<ov::opset8::Constant>(et, ng_shape, const_values);
 };
 }  // namespace tensorflow
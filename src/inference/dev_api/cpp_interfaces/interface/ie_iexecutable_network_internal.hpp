@@ -13,6 +13,7 @@
 #include "cpp_interfaces/interface/ie_ivariable_state_internal.hpp"
 #include "ie_parameter.hpp"
 #include "ie_remote_context.hpp"
+#include "ie_startup_profile.hpp"
 #include "so_ptr.hpp"
 
 namespace ov {
@@ -148,6 +149,18 @@ public:
      */
     virtual std::shared_ptr<RemoteContext> GetContext() const;
 
+    /**
+     * @brief Sets the startup profile collected while the network was compiled or imported
+     * @param profile The profile, the plugin adds the phases of the first inference to it
+     */
+    void SetStartupProfile(const ov::StartupProfile::Ptr& profile);
+
+    /**
+     * @brief Gets the startup profile of the network
+     * @return The profile or nullptr if the network was created without the profiling
+     */
+    ov::StartupProfile::Ptr GetStartupProfile() const;
+
 protected:
     virtual ~IExecutableNetworkInternal() = default;
 
@@ -183,6 +196,8 @@ protected:
      * @note Needed to correctly handle ownership between objects.
      */
     std::shared_ptr<IInferencePlugin> _plugin;
+
+    ov::StartupProfile::Ptr _startupProfile;  //!< Holds the phases of the compilation and of the first inference
 };
 
 /**
@@ -53,6 +53,13 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Enables the fusion of the scaled dot-product attention subgraphs into a single CPU node (set value to YES).
+ *        The fusion is disabled by default until the node outperforms the unfused MatMul and Softmax layers.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SCALED_ATTN_FUSION);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -108,6 +108,36 @@ public:
                                                           const std::string& deviceName = {},
                                                           const std::map<std::string, std::string>& config = {}) = 0;
 
+    /**
+     * @brief Finds the first configuration for which the cache directory holds a compiled blob that LoadNetwork
+     * would import for the specified network and device. The network is hashed once for all the configurations.
+     *
+     * @param network CNNNetwork object acquired from Core::ReadNetwork
+     * @param deviceName Name of device to load network to
+     * @param configs Maps of pairs: (config parameter name, config parameter value) relevant only for the load
+     * operation
+     * @return Index of the first configuration with a valid cache entry, or configs.size() if there is no such
+     * configuration or caching is not enabled
+     */
+    virtual size_t FindCachedNetwork(const ie::CNNNetwork& network,
+                                     const std::string& deviceName,
+                                     const std::vector<std::map<std::string, std::string>>& configs) = 0;
+
+    /**
+     * @brief Finds the first configuration for which the cache directory holds a compiled blob that LoadNetwork
+     * would import for the specified model file and device
+     *
+     * @param modelPath Path to model
+     * @param deviceName Name of device to load network to
+     * @param configs Maps of pairs: (config parameter name, config parameter value) relevant only for the load
+     * operation
+     * @return Index of the first configuration with a valid cache entry, or configs.size() if there is no such
+     * configuration or caching is not enabled
+     */
+    virtual size_t FindCachedNetwork(const std::string& modelPath,
+                                     const std::string& deviceName,
+                                     const std::vector<std::map<std::string, std::string>>& configs) = 0;
+
     /**
      * @brief Query device if it supports specified network with specified configuration
      *
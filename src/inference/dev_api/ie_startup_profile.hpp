@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the startup profile of the compiled models
+ * @file ie_startup_profile.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include "ie_api.h"
+
+namespace ov {
+
+/**
+ * @brief Tree of the phases of the model compilation and of the first inference.
+ * The phases are the tasks annotated with OV_ITT_SCOPE(FIRST_INFERENCE, ...) which are executed inside
+ * a StartupProfiler session. The phases with the same name and parent are aggregated into one node.
+ * Every phase records the time since the start of the profile and the process memory in MB.
+ * @ingroup ie_dev_profiling
+ */
+class INFERENCE_ENGINE_API_CLASS(StartupProfile) {
+public:
+    using Ptr = std::shared_ptr<StartupProfile>;
+    struct Phase;
+
+    StartupProfile();
+    ~StartupProfile();
+
+    /**
+     * @brief Marks the phase as profiled, used by the plugins to profile only the first run of a phase
+     * @return true if the phase is claimed for the first time
+     */
+    bool claim(const std::string& phase);
+
+    /**
+     * @brief Serializes the profile into JSON:
+     * {"phases": [{"name": ..., "count": ..., "start_ms": ..., "end_ms": ..., "duration_ms": ...,
+     *              "rss_begin_mb": ..., "rss_end_mb": ..., "peak_rss_mb": ..., "phases": [...]}, ...],
+     *  "peak_rss_mb": ...}
+     */
+    std::string to_json() const;
+
+    /**
+     * @brief Returns the time in milliseconds since the creation of the profile
+     */
+    double now_ms() const;
+
+    /**
+     * @brief Opens the child phase of the parent phase, nullptr parent means the root of the profile
+     * @param start_ms The start time of this run of the phase, see now_ms()
+     */
+    Phase* begin(Phase* parent, const std::string& name, double start_ms);
+
+    /**
+     * @brief Closes the run of the phase started at start_ms
+     */
+    void end(Phase* phase, double start_ms);
+
+private:
+    mutable std::mutex _mutex;
+    std::chrono::steady_clock::time_point _origin;
+    std::unique_ptr<Phase> _root;
+    std::set<std::string> _claimed;
+};
+
+/**
+ * @brief RAII session which collects the annotated tasks of the current thread into a phase of the startup profile.
+ * The sessions can be nested, the inner session is restored to the outer one on the destruction.
+ * @ingroup ie_dev_profiling
+ */
+class INFERENCE_ENGINE_API_CLASS(StartupProfiler) {
+public:
+    /**
+     * @brief The phase of the session opened on the thread, used to continue the session in the worker threads
+     */
+    struct Context {
+        StartupProfile::Ptr profile;
+        StartupProfile::Phase* phase;
+    };
+
+    /**
+     * @brief Opens the phase of the top level of the profile, does nothing if the profile is nullptr
+     */
+    StartupProfiler(const StartupProfile::Ptr& profile, const std::string& phase);
+
+    /**
+     * @brief Opens the child phase of the context phase, does nothing if the context is empty
+     */
+    StartupProfiler(const Context& context, const std::string& phase);
+
+    ~StartupProfiler();
+
+    StartupProfiler(const StartupProfiler&) = delete;
+    StartupProfiler& operator=(const StartupProfiler&) = delete;
+
+    /**
+     * @brief Returns the innermost phase of the session of the current thread or an empty context
+     */
+    static Context current();
+
+    /**
+     * @brief Returns true while a session is open on any thread, the task names are interned only then
+     */
+    static bool isActive();
+
+    /**
+     * @brief Opens the phase of the annotated task in the session of the current thread if any,
+     * called by the runtime task listener, see ov::runtimeTaskListener()
+     */
+    static void taskBegin(const char* name);
+
+    /**
+     * @brief Closes the phase of the last annotated task in the session of the current thread if any
+     */
+    static void taskEnd();
+
+private:
+    struct Session;
+    static Session*& currentSession();
+
+    std::unique_ptr<Session> _session;
+};
+
+}  // namespace ov
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the built-in tracer of the annotated tasks
+ * @file ie_tracer.hpp
+ */
+
+#pragma once
+
+#include <string>
+
+#include "ie_api.h"
+#include "openvino/itt.hpp"
+
+namespace ov {
+
+/**
+ * @brief Records the begin and end of the tasks annotated with OV_ITT_SCOPE and OV_ITT_SCOPED_TASK without Intel ITT.
+ * Without ITT only the first inference tasks and the per-node execution tasks of the CPU plugin are built by default,
+ * the other counter groups need the ENABLE_PROFILING_TRACE build option. The per-node tasks cost a check of
+ * Tracer::isStarted() per node while the tracer doesn't run.
+ * Each thread writes the events with the nanosecond timestamps into its own lock-free ring buffer, so only
+ * the latest events of every thread are kept. The recorded events are dumped in the Chrome trace JSON format,
+ * which can be opened with chrome://tracing or https://ui.perfetto.dev.
+ * If the OPENVINO_TRACE_FILE environment variable is set, the tracing is started when the OpenVINO runtime library
+ * is loaded and the trace is dumped to that file at the process exit. OPENVINO_TRACE_BUFFER_SIZE sets the number of
+ * the events kept per thread.
+ * @ingroup ie_dev_profiling
+ */
+class INFERENCE_ENGINE_API_CLASS(Tracer) {
+public:
+    /**
+     * @brief Starts the recording, the events recorded before are kept. The tasks whose annotation handles were
+     * created before any profiling started are recorded unnamed, except the per-node tasks of the CPU plugin
+     * which are named on their first traced execution
+     * @param eventsPerThread The capacity of the ring buffer of each thread which is not created yet,
+     * 0 means OPENVINO_TRACE_BUFFER_SIZE or the default capacity
+     */
+    static void start(size_t eventsPerThread = 0);
+
+    /**
+     * @brief Stops the recording, the recorded events can still be dumped
+     */
+    static void stop();
+
+    /**
+     * @brief Returns true while the recording runs, cheap enough to be checked per executed node
+     */
+    static bool isStarted();
+
+    /**
+     * @brief Writes the events recorded by all the threads as Chrome trace JSON
+     */
+    static void dump(const std::string& path);
+
+    /**
+     * @brief Drops the recorded events
+     */
+    static void clear();
+};
+
+/**
+ * @brief Returns the task listener which feeds the startup profiler and the tracer, it is active only while
+ * the tracer is started or a startup profiler session is open. Each module (shared library)
+ * which annotates the tasks and whose tasks should be profiled registers it with openvino::itt::setTaskListener,
+ * the OpenVINO runtime library registers it for itself.
+ * @ingroup ie_dev_profiling
+ */
+INFERENCE_ENGINE_API_CPP(openvino::itt::TaskListener&) runtimeTaskListener();
+
+}  // namespace ov
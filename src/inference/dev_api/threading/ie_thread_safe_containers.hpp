@@ -7,6 +7,8 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <type_traits>
@@ -138,4 +140,95 @@ protected:
     bool _capacity = false;
 };
 #endif
+
+/**
+ * @brief Lock-free bounded multi-producer multi-consumer queue
+ * @details Each cell of the ring buffer carries a sequence number telling whether the cell is free or holds a value
+ * for the current lap of the producers and the consumers, so the positions are claimed with a single CAS and
+ * there is no ABA problem.
+ * @tparam T A type of the values, should be default constructible
+ */
+template <typename T>
+class LockFreeBoundedQueue {
+public:
+    /**
+     * @brief Constructs the queue
+     * @param capacity The maximum number of the values in the queue, rounded up to the power of two
+     */
+    explicit LockFreeBoundedQueue(std::size_t capacity) {
+        std::size_t size = 1;
+        while (size < capacity)
+            size <<= 1;
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; i++)
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+    }
+
+    LockFreeBoundedQueue(const LockFreeBoundedQueue&) = delete;
+    LockFreeBoundedQueue& operator=(const LockFreeBoundedQueue&) = delete;
+
+    /**
+     * @brief Pushes the value to the queue
+     * @return `false` if the queue is full, the value is left intact in this case
+     */
+    bool try_push(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops the value from the queue
+     * @return `false` if the queue is empty
+     */
+    bool try_pop(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        // the cell shouldn't keep the resources of the moved value (e.g. the shared pointers) alive
+        cell->_value = T{};
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+protected:
+    struct Cell {
+        std::atomic<std::size_t> _sequence{0};
+        T _value{};
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask = 0;
+    std::atomic<std::size_t> _enqueuePos{0};
+    std::atomic<std::size_t> _dequeuePos{0};
+};
 }  // namespace InferenceEngine
@@ -34,5 +34,39 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy used to dispatch infer requests to the devices
+ * MULTI_DEVICE_PRIORITY (default) - the first idle device in the device priority order is used
+ * MULTI_LATENCY_AWARE - a device with the lowest expected completion time is used, the estimation is based on
+ * the moving average latency of the device and the number of requests in flight
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(DEVICE_PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(LATENCY_AWARE);
+
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get per-device dispatch statistics of the MULTI executable network.
+ * For every device name it holds DISPATCHED, IN_FLIGHT, AVERAGE_LATENCY_MS and EXPECTED_COMPLETION_MS values
+ */
+DECLARE_METRIC_KEY(MULTI_DEVICE_DISPATCH_STATISTICS, std::map<std::string, std::map<std::string, double>>);
+
+/**
+ * @brief Metric to get the way the AUTO executable network started the inference:
+ * CPU_HELP when the CPU helper serves the requests until the actual device is ready,
+ * ACTUAL_DEVICE_FROM_CACHE when the accelerator network is imported from the cache and the CPU helper is skipped,
+ * ACTUAL_DEVICE when the actual device is used from the start otherwise
+ */
+DECLARE_METRIC_KEY(AUTO_STARTUP_PATH, std::string);
+
+/**
+ * @brief Metric to get the time from the AUTO network loading start to the first completed inference,
+ * in milliseconds, -1 until the first inference is completed
+ */
+DECLARE_METRIC_KEY(AUTO_TIME_TO_FIRST_INFERENCE_MS, double);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
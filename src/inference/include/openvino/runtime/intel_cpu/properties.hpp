@@ -0,0 +1,122 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for advanced hardware related properties for CPU plugin
+ *        To use in set_property() and get_property() methods of plugins
+ *
+ * @file properties.hpp
+ */
+#pragma once
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+
+/**
+ * @brief Namespace with Intel CPU specific properties
+ */
+namespace intel_cpu {
+
+/**
+ * @brief Enum to define how the weights are placed in memory on multi-socket (NUMA) hosts
+ */
+enum class WeightsPlacement {
+    REPLICATE = 0,    //!< Each NUMA node used by the streams keeps its own copy of the weights
+    INTERLEAVE = 1,   //!< A single copy of the weights with the pages interleaved across the NUMA nodes
+    FIRST_TOUCH = 2,  //!< A single copy of the weights placed on the NUMA node of the stream that creates them
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const WeightsPlacement& weights_placement) {
+    switch (weights_placement) {
+    case WeightsPlacement::REPLICATE:
+        return os << "REPLICATE";
+    case WeightsPlacement::INTERLEAVE:
+        return os << "INTERLEAVE";
+    case WeightsPlacement::FIRST_TOUCH:
+        return os << "FIRST_TOUCH";
+    default:
+        throw ov::Exception{"Unsupported weights placement!"};
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, WeightsPlacement& weights_placement) {
+    std::string str;
+    is >> str;
+    if (str == "REPLICATE") {
+        weights_placement = WeightsPlacement::REPLICATE;
+    } else if (str == "INTERLEAVE") {
+        weights_placement = WeightsPlacement::INTERLEAVE;
+    } else if (str == "FIRST_TOUCH") {
+        weights_placement = WeightsPlacement::FIRST_TOUCH;
+    } else {
+        throw ov::Exception{"Unsupported weights placement: " + str};
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Property to set the placement policy of the weights shared between the streams
+ * @details The weights are shared only if the model is compiled for several streams.
+ * Replication (default) gives each NUMA node local copies at the cost of the memory multiplied by the number of nodes,
+ * interleaving and first touch keep a single copy of the weights that is partially accessed remotely.
+ */
+static constexpr Property<WeightsPlacement> weights_placement{"CPU_WEIGHTS_PLACEMENT"};
+
+/**
+ * @brief Read-only property to get the size in bytes of the shared weights resident on each NUMA node
+ */
+static constexpr Property<std::map<int64_t, uint64_t>, PropertyMutability::RO> weights_memory_per_numa_node{
+    "CPU_WEIGHTS_MEMORY_PER_NUMA_NODE"};
+
+/**
+ * @brief Property to enable the calibration of the number of streams and threads for the THROUGHPUT hint
+ * @details When enabled, the compilation times a few inferences for several candidate configurations of
+ * streams and threads per stream and keeps the fastest one instead of the heuristic choice. The streams set
+ * explicitly have higher priority. The chosen configuration is stored in the compiled blob, so the models loaded
+ * from the cache directory (ov::cache_dir) skip the calibration.
+ */
+static constexpr Property<bool> streams_calibration{"CPU_STREAMS_CALIBRATION"};
+
+/**
+ * @brief Read-only property of the compiled model to get the number of reorders eliminated by the layout assignment
+ * over the whole graph compared to the layouts selected for each node independently
+ */
+static constexpr Property<uint32_t, PropertyMutability::RO> eliminated_reorders{"CPU_ELIMINATED_REORDERS"};
+
+/**
+ * @brief Property to collect the hardware performance counters of each node along with the performance counters
+ * @details Takes effect together with ov::enable_profiling on Linux. The cycles, instructions and last level cache
+ * misses of each node are read with perf_event_open on the stream thread executing the inference, they are added to
+ * the nodes of the runtime model (ov::CompiledModel::get_runtime_model), the profiling info
+ * (ov::InferRequest::get_profiling_info) has no fields for them. The CPU time of the profiling info becomes the CPU
+ * time of the stream thread instead of the wall time. The compilation measures the peak FLOPS and the memory bandwidth
+ * available to a stream for the roofline report (ov::intel_cpu::roofline_report).
+ */
+static constexpr Property<bool> hw_perf_counters{"CPU_HW_PERF_COUNTERS"};
+
+/**
+ * @brief Read-only property of the compiled model to get the roofline report in the JSON format
+ * @details The report contains the measured peaks of a stream and, for each executed node, the estimated FLOPs,
+ * the bytes transferred from memory, the arithmetic intensity, whether the node is memory or compute bound and the
+ * achieved fraction of the roof. The throughput is based on the wall time of the node, the CPU time of the stream
+ * thread is reported separately as cpu_time_us. The bytes are estimated by the last level cache misses counted on the stream thread
+ * multiplied by the number of threads of the stream, or by the size of the node's tensors if the misses are not
+ * collected (see ov::intel_cpu::hw_perf_counters).
+ */
+static constexpr Property<std::string, PropertyMutability::RO> roofline_report{"CPU_ROOFLINE_REPORT"};
+
+/**
+ * @brief Property to set the minimal sparsity rate of the constant FP32 weights of FullyConnected executed as sparse
+ * @details The sparsity rate is the share of the zero blocks of 16 output channels x 1 input channel in the weights
+ * (e.g. the input channels pruned per group of output channels). The weights with the rate above the threshold are
+ * packed into the block sparse format at the compilation, and only the non-zero blocks are multiplied.
+ * The value is in the range [0, 1], 1 (default) disables the sparse execution. The sparse execution needs avx2.
+ */
+static constexpr Property<float> sparse_weights_rate{"CPU_SPARSE_WEIGHTS_RATE"};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -220,6 +220,21 @@ static constexpr Property<std::string, PropertyMutability::RO> model_name{"NETWO
 static constexpr Property<uint32_t, PropertyMutability::RO> optimal_number_of_infer_requests{
     "OPTIMAL_NUMBER_OF_INFER_REQUESTS"};
 
+/**
+ * @brief Read-only property to get the startup profile of a compiled model as a JSON string.
+ * The profile holds the tree of the phases of the model compilation or import and of the first inference
+ * with their start and end time in milliseconds and the process resident and peak memory in MB.
+ * The property is supported only by the models compiled or imported with ov::enable_startup_profile(true).
+ */
+static constexpr Property<std::string, PropertyMutability::RO> startup_profile{"STARTUP_PROFILE"};
+
+/**
+ * @brief The name for enabling the startup profile of a compiled model, see ov::startup_profile.
+ *
+ * It is passed to Core::compile_model() and Core::import_model(), the profile is not collected by default
+ */
+static constexpr Property<bool> enable_startup_profile{"ENABLE_STARTUP_PROFILE"};
+
 /**
  * @brief Namespace with hint properties
  */
@@ -65,63 +65,75 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                                    const std::map<std::string, std::string>& compileOptions) {
+    return computeHashes(network, {compileOptions}).front();
+}
+
+std::vector<std::string> NetworkCompilationContext::computeHashes(
+    const CNNNetwork& network,
+    const std::vector<std::map<std::string, std::string>>& compileOptions) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
 
     IE_ASSERT(network.getFunction());
 
-    uint64_t seed = 0;
-    // 1. Calculate hash on function
+    uint64_t functionSeed = 0;
+    // 1. Calculate hash on function, the function is serialized once for all the options
     CNNNetwork net(network);
     ov::pass::Manager m;
     m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
+    m.register_pass<ov::pass::Hash>(functionSeed);
     m.run_passes(net.getFunction());
 
-    // 2. Compute hash on serialized data and options
-    for (const auto& kvp : compileOptions) {
-        seed = hash_combine(seed, kvp.first + kvp.second);
-    }
+    std::vector<std::string> hashes;
+    hashes.reserve(compileOptions.size());
+    for (const auto& options : compileOptions) {
+        uint64_t seed = functionSeed;
+        // 2. Compute hash on serialized data and options
+        for (const auto& kvp : options) {
+            seed = hash_combine(seed, kvp.first + kvp.second);
+        }
 
-    // 3. Add runtime information which may not be serialized
-    for (const auto& op : network.getFunction()->get_ordered_ops()) {
-        const auto& rt = op->get_rt_info();
-        for (const auto& rtMapData : rt) {
-            seed = hash_combine(seed, rtMapData.first);
-            std::stringstream strm;
-            rtMapData.second.print(strm);
-            seed = hash_combine(seed, strm.str());
+        // 3. Add runtime information which may not be serialized
+        for (const auto& op : network.getFunction()->get_ordered_ops()) {
+            const auto& rt = op->get_rt_info();
+            for (const auto& rtMapData : rt) {
+                seed = hash_combine(seed, rtMapData.first);
+                std::stringstream strm;
+                rtMapData.second.print(strm);
+                seed = hash_combine(seed, strm.str());
+            }
         }
-    }
 
-    // 4. Add inputs info
-    for (const auto& input : network.getInputsInfo()) {
-        InputInfo::Ptr info = input.second;
-        seed = hash_combine(seed, as_int32_t(info->getPrecision()));
-        seed = hash_combine(seed, as_int32_t(info->getLayout()));
-
-        const InferenceEngine::PreProcessInfo& preproc = info->getPreProcess();
-        seed = hash_combine(seed, as_int32_t(preproc.getMeanVariant()));
-
-        if (preproc.getMeanVariant() == MeanVariant::MEAN_VALUE) {
-            seed = hash_combine(seed, preproc.getNumberOfChannels());
-            for (size_t c = 0; c < preproc.getNumberOfChannels(); ++c) {
-                const PreProcessChannel::Ptr& channelInfo = preproc[c];
-                seed = hash_combine(seed, channelInfo->stdScale);
-                seed = hash_combine(seed, channelInfo->meanValue);
+        // 4. Add inputs info
+        for (const auto& input : network.getInputsInfo()) {
+            InputInfo::Ptr info = input.second;
+            seed = hash_combine(seed, as_int32_t(info->getPrecision()));
+            seed = hash_combine(seed, as_int32_t(info->getLayout()));
+
+            const InferenceEngine::PreProcessInfo& preproc = info->getPreProcess();
+            seed = hash_combine(seed, as_int32_t(preproc.getMeanVariant()));
+
+            if (preproc.getMeanVariant() == MeanVariant::MEAN_VALUE) {
+                seed = hash_combine(seed, preproc.getNumberOfChannels());
+                for (size_t c = 0; c < preproc.getNumberOfChannels(); ++c) {
+                    const PreProcessChannel::Ptr& channelInfo = preproc[c];
+                    seed = hash_combine(seed, channelInfo->stdScale);
+                    seed = hash_combine(seed, channelInfo->meanValue);
+                }
+            } else if (preproc.getMeanVariant() == MeanVariant::MEAN_IMAGE) {
+                // TODO: think if we need to compute hash for mean image if it exists
             }
-        } else if (preproc.getMeanVariant() == MeanVariant::MEAN_IMAGE) {
-            // TODO: think if we need to compute hash for mean image if it exists
         }
-    }
 
-    // 5. Add outputs info
-    for (const auto& output : network.getOutputsInfo()) {
-        DataPtr info = output.second;
-        seed = hash_combine(seed, as_int32_t(info->getPrecision()));
-        seed = hash_combine(seed, as_int32_t(info->getLayout()));
-    }
+        // 5. Add outputs info
+        for (const auto& output : network.getOutputsInfo()) {
+            DataPtr info = output.second;
+            seed = hash_combine(seed, as_int32_t(info->getPrecision()));
+            seed = hash_combine(seed, as_int32_t(info->getLayout()));
+        }
 
-    return std::to_string(seed);
+        hashes.push_back(std::to_string(seed));
+    }
+    return hashes;
 }
 
 std::string NetworkCompilationContext::computeHash(const std::string& modelName,
@@ -8,6 +8,7 @@
 #include <map>
 #include <ostream>
 #include <string>
+#include <vector>
 
 namespace InferenceEngine {
 
@@ -18,6 +19,11 @@ struct NetworkCompilationContext final {
 
     static std::string computeHash(const CNNNetwork& network, const std::map<std::string, std::string>& compileOptions);
 
+    // the same as computeHash for each of the options, but the network is serialized only once
+    static std::vector<std::string> computeHashes(
+        const CNNNetwork& network,
+        const std::vector<std::map<std::string, std::string>>& compileOptions);
+
     static std::string computeHash(const std::string& modelName,
                                    const std::map<std::string, std::string>& compileOptions);
 };
@@ -214,6 +214,12 @@ void CompiledModel::set_property(const AnyMap& config) {
 
 Any CompiledModel::get_property(const std::string& name) const {
     OV_EXEC_NET_CALL_STATEMENT({
+        auto startup_profile = _impl->GetStartupProfile();
+        if (ov::startup_profile == name) {
+            OPENVINO_ASSERT(startup_profile,
+                            "The startup profile is available only for the models compiled or imported by ov::Core");
+            return startup_profile->to_json();
+        }
         if (ov::supported_properties == name) {
             try {
                 auto supported_properties = _impl->GetMetric(name).as<std::vector<PropertyName>>();
@@ -224,6 +230,9 @@ Any CompiledModel::get_property(const std::string& name) const {
                                                                      name == METRIC_KEY(SUPPORTED_CONFIG_KEYS);
                                                           }),
                                            supported_properties.end());
+                if (startup_profile) {
+                    supported_properties.emplace_back(ov::startup_profile.name(), PropertyMutability::RO);
+                }
                 return supported_properties;
             } catch (ie::Exception&) {
                 auto ro_properties = _impl->GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
@@ -239,6 +248,9 @@ Any CompiledModel::get_property(const std::string& name) const {
                     supported_properties.emplace_back(rw_property, PropertyMutability::RW);
                 }
                 supported_properties.emplace_back(ov::supported_properties.name(), PropertyMutability::RO);
+                if (startup_profile) {
+                    supported_properties.emplace_back(ov::startup_profile.name(), PropertyMutability::RO);
+                }
                 return supported_properties;
             }
         }
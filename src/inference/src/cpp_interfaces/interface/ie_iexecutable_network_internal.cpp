@@ -91,6 +91,14 @@ void IExecutableNetworkInternal::SetPointerToPlugin(const std::shared_ptr<IInfer
     _plugin = plugin;
 }
 
+void IExecutableNetworkInternal::SetStartupProfile(const ov::StartupProfile::Ptr& profile) {
+    _startupProfile = profile;
+}
+
+ov::StartupProfile::Ptr IExecutableNetworkInternal::GetStartupProfile() const {
+    return _startupProfile;
+}
+
 void IExecutableNetworkInternal::SetConfig(const std::map<std::string, Parameter>&) {
     IE_THROW(NotImplemented);
 }
@@ -29,6 +29,7 @@
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_remote_context.hpp"
+#include "ie_startup_profile.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset.hpp"
@@ -321,6 +322,24 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         return execNetwork;
     }
 
+    bool HasValidCacheEntry(const std::shared_ptr<ie::ICacheManager>& cacheManager,
+                            const std::string& blobId,
+                            const std::string& modelPath = std::string()) {
+        bool isValid = false;
+        auto lock = cacheGuard.getHashLock(blobId);
+        try {
+            cacheManager->readCacheEntry(blobId, [&](std::istream& networkStream) {
+                ie::CompiledBlobHeader header;
+                networkStream >> header;
+                isValid = header.getIeVersion() == ie::GetInferenceEngineVersion()->buildNumber &&
+                          header.getFileInfo() == ie::NetworkCompilationContext::calculateFileInfo(modelPath);
+            });
+        } catch (...) {
+            isValid = false;
+        }
+        return isValid;
+    }
+
     std::map<std::string, std::string> CreateCompileConfig(const ov::InferencePlugin& plugin,
                                                            const std::string& deviceFamily,
                                                            const std::map<std::string, std::string>& origConfig) const {
@@ -684,6 +703,64 @@ public:
         return {res._ptr, res._so};
     }
 
+    size_t FindCachedNetwork(const ie::CNNNetwork& network,
+                             const std::string& deviceName,
+                             const std::vector<std::map<std::string, std::string>>& configs) override {
+        auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
+        if (!cacheManager) {
+            return configs.size();
+        }
+        std::vector<size_t> configIndices;
+        std::vector<std::map<std::string, std::string>> compileConfigs;
+        for (size_t idx = 0; idx < configs.size(); ++idx) {
+            std::string deviceNameWithBatch = deviceName;
+            std::map<std::string, std::string> config_with_batch = configs[idx];
+            // the same device and config patching as in LoadNetwork, otherwise the hash does not match
+            ApplyAutoBatching(network, deviceNameWithBatch, config_with_batch);
+            if (config_with_batch.count(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE)) > 0) {
+                continue;
+            }
+            auto parsed = parseDeviceNameIntoConfig(deviceNameWithBatch, config_with_batch);
+            auto plugin = GetCPPPluginByName(parsed._deviceName);
+            if (!DeviceSupportsImportExport(plugin)) {
+                continue;
+            }
+            configIndices.push_back(idx);
+            compileConfigs.push_back(CreateCompileConfig(plugin, parsed._deviceName, parsed._config));
+        }
+        if (compileConfigs.empty()) {
+            return configs.size();
+        }
+        // the network is serialized for hashing once for all the configurations
+        const auto hashes = ie::NetworkCompilationContext::computeHashes(network, compileConfigs);
+        for (size_t idx = 0; idx < hashes.size(); ++idx) {
+            if (HasValidCacheEntry(cacheManager, hashes[idx])) {
+                return configIndices[idx];
+            }
+        }
+        return configs.size();
+    }
+
+    size_t FindCachedNetwork(const std::string& modelPath,
+                             const std::string& deviceName,
+                             const std::vector<std::map<std::string, std::string>>& configs) override {
+        auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
+        if (!cacheManager) {
+            return configs.size();
+        }
+        for (size_t idx = 0; idx < configs.size(); ++idx) {
+            auto parsed = parseDeviceNameIntoConfig(deviceName, configs[idx]);
+            auto plugin = GetCPPPluginByName(parsed._deviceName);
+            if (DeviceSupportsImportExport(plugin) &&
+                HasValidCacheEntry(cacheManager,
+                                   CalculateFileHash(modelPath, parsed._deviceName, plugin, parsed._config),
+                                   modelPath)) {
+                return idx;
+            }
+        }
+        return configs.size();
+    }
+
     ie::SoExecutableNetworkInternal ImportNetwork(std::istream& networkModel,
                                                   const std::string& deviceName,
                                                   const std::map<std::string, std::string>& config) override {
@@ -1693,6 +1770,32 @@ ie::CNNNetwork toCNN(const std::shared_ptr<const ngraph::Function>& model) {
                                                             true));
 }
 
+/**
+ * @brief Compiles or imports the network inside a startup profiler session and attaches the profile to it
+ * if the config enables it with ov::enable_startup_profile, the plugin adds the phases of the first inference
+ * to the same profile. The property is removed from the config passed to the load function.
+ */
+template <typename Load>
+ie::SoExecutableNetworkInternal load_with_startup_profile(const std::string& phase, AnyMap config, const Load& load) {
+    auto it = config.find(ov::enable_startup_profile.name());
+    if (it == config.end()) {
+        return load(config);
+    }
+    const bool enabled = it->second.as<bool>();
+    config.erase(it);
+    if (!enabled) {
+        return load(config);
+    }
+    auto profile = std::make_shared<ov::StartupProfile>();
+    ie::SoExecutableNetworkInternal exec;
+    {
+        ov::StartupProfiler profiler(profile, phase);
+        exec = load(config);
+    }
+    exec->SetStartupProfile(profile);
+    return exec;
+}
+
 }  // namespace
 
 CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model, const AnyMap& config) {
@@ -1703,7 +1806,11 @@ CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
                                   const std::string& deviceName,
                                   const AnyMap& config) {
     OV_CORE_CALL_STATEMENT({
-        auto exec = _impl->LoadNetwork(toCNN(model), deviceName, any_copy(flatten_sub_properties(deviceName, config)));
+        auto exec = load_with_startup_profile("compile_model", config, [&](const AnyMap& loadConfig) {
+            return _impl->LoadNetwork(toCNN(model),
+                                      deviceName,
+                                      any_copy(flatten_sub_properties(deviceName, loadConfig)));
+        });
         return {exec._ptr, exec._so};
     });
 }
@@ -1714,7 +1821,9 @@ CompiledModel Core::compile_model(const std::string& modelPath, const AnyMap& co
 
 CompiledModel Core::compile_model(const std::string& modelPath, const std::string& deviceName, const AnyMap& config) {
     OV_CORE_CALL_STATEMENT({
-        auto exec = _impl->LoadNetwork(modelPath, deviceName, any_copy(flatten_sub_properties(deviceName, config)));
+        auto exec = load_with_startup_profile("compile_model", config, [&](const AnyMap& loadConfig) {
+            return _impl->LoadNetwork(modelPath, deviceName, any_copy(flatten_sub_properties(deviceName, loadConfig)));
+        });
         return {exec._ptr, exec._so};
     });
 }
@@ -1723,9 +1832,11 @@ CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
                                   const RemoteContext& context,
                                   const AnyMap& config) {
     OV_CORE_CALL_STATEMENT({
-        auto exec = _impl->LoadNetwork(toCNN(model),
-                                       context._impl,
-                                       any_copy(flatten_sub_properties(context.get_device_name(), config)));
+        auto exec = load_with_startup_profile("compile_model", config, [&](const AnyMap& loadConfig) {
+            return _impl->LoadNetwork(toCNN(model),
+                                      context._impl,
+                                      any_copy(flatten_sub_properties(context.get_device_name(), loadConfig)));
+        });
         return {exec._ptr, exec._so};
     });
 }
@@ -1753,7 +1864,11 @@ void Core::add_extension(const std::vector<std::shared_ptr<ov::Extension>>& exte
 CompiledModel Core::import_model(std::istream& modelStream, const std::string& deviceName, const AnyMap& config) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "Core::import_model");
     OV_CORE_CALL_STATEMENT({
-        auto exec = _impl->ImportNetwork(modelStream, deviceName, any_copy(flatten_sub_properties(deviceName, config)));
+        auto exec = load_with_startup_profile("import_model", config, [&](const AnyMap& loadConfig) {
+            return _impl->ImportNetwork(modelStream,
+                                        deviceName,
+                                        any_copy(flatten_sub_properties(deviceName, loadConfig)));
+        });
         return {exec._ptr, exec._so};
     });
 }
@@ -1778,7 +1893,9 @@ CompiledModel Core::import_model(std::istream& modelStream, const RemoteContext&
     modelStream.seekg(currentPos, modelStream.beg);
 
     OV_CORE_CALL_STATEMENT({
-        auto exec = _impl->GetCPPPluginByName(deviceName).import_model(modelStream, {});
+        auto exec = load_with_startup_profile("import_model", config, [&](const AnyMap&) {
+            return _impl->GetCPPPluginByName(deviceName).import_model(modelStream, {});
+        });
         return {exec._ptr, exec._so};
     });
 }
@@ -0,0 +1,260 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_startup_profile.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+// windows.h must be included first
+#    include <psapi.h>
+#else
+#    include <fcntl.h>
+#    include <sys/resource.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+
+namespace {
+
+constexpr double bytesInMB = 1024.0 * 1024.0;
+
+std::atomic<size_t> openSessions{0};
+
+struct MemoryUsage {
+    double rss_mb = 0;
+    double peak_rss_mb = 0;
+};
+
+MemoryUsage getMemoryUsage() {
+    MemoryUsage usage;
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        usage.rss_mb = counters.WorkingSetSize / bytesInMB;
+        usage.peak_rss_mb = counters.PeakWorkingSetSize / bytesInMB;
+    }
+#else
+#    ifdef __linux__
+    // the memory is sampled at every begin and end of a phase, so the file is kept open and re-read from the start
+    static const int statm = open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+    static const long pageSize = sysconf(_SC_PAGESIZE);
+    char buffer[128];
+    const auto size = statm >= 0 ? pread(statm, buffer, sizeof(buffer) - 1, 0) : -1;
+    if (size > 0) {
+        buffer[size] = '\0';
+        unsigned long total = 0, resident = 0;
+        if (std::sscanf(buffer, "%lu %lu", &total, &resident) == 2) {
+            usage.rss_mb = static_cast<double>(resident) * pageSize / bytesInMB;
+        }
+    }
+#    endif
+    struct rusage rusage;
+    if (getrusage(RUSAGE_SELF, &rusage) == 0) {
+#    ifdef __APPLE__
+        // ru_maxrss is in bytes on macOS and in kilobytes on Linux
+        usage.peak_rss_mb = rusage.ru_maxrss / bytesInMB;
+#    else
+        usage.peak_rss_mb = rusage.ru_maxrss / 1024.0;
+#    endif
+    }
+#endif
+    return usage;
+}
+
+std::string escapeJson(const std::string& str) {
+    std::string escaped;
+    for (auto c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped += ' ';
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+}  // namespace
+
+struct StartupProfile::Phase {
+    std::string name;
+    size_t count = 0;
+    double start_ms = 0;
+    double end_ms = 0;
+    double duration_ms = 0;
+    double rss_begin_mb = 0;
+    double rss_end_mb = 0;
+    double peak_rss_mb = 0;
+    // in the order of the first start
+    std::vector<std::unique_ptr<Phase>> children;
+    // the plugins annotate every node of the graph, so the children are looked up by the name
+    std::unordered_map<std::string, Phase*> childrenByName;
+
+    void write(std::ostream& out) const {
+        out << "{\"name\": \"" << escapeJson(name) << "\", \"count\": " << count << ", \"start_ms\": " << start_ms
+            << ", \"end_ms\": " << end_ms << ", \"duration_ms\": " << duration_ms
+            << ", \"rss_begin_mb\": " << rss_begin_mb << ", \"rss_end_mb\": " << rss_end_mb
+            << ", \"peak_rss_mb\": " << peak_rss_mb << ", \"phases\": ";
+        writeChildren(out);
+        out << "}";
+    }
+
+    void writeChildren(std::ostream& out) const {
+        out << "[";
+        for (size_t i = 0; i < children.size(); i++) {
+            out << (i ? ", " : "");
+            children[i]->write(out);
+        }
+        out << "]";
+    }
+};
+
+StartupProfile::StartupProfile() : _origin(std::chrono::steady_clock::now()), _root(new Phase) {}
+
+StartupProfile::~StartupProfile() = default;
+
+bool StartupProfile::claim(const std::string& phase) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _claimed.insert(phase).second;
+}
+
+StartupProfile::Phase* StartupProfile::begin(Phase* parent, const std::string& name, double start_ms) {
+    const auto memory = getMemoryUsage();
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!parent) {
+        parent = _root.get();
+    }
+    auto& phase = parent->childrenByName[name];
+    if (!phase) {
+        parent->children.emplace_back(new Phase);
+        phase = parent->children.back().get();
+        phase->name = name;
+        phase->start_ms = start_ms;
+        phase->rss_begin_mb = memory.rss_mb;
+    }
+    ++phase->count;
+    return phase;
+}
+
+void StartupProfile::end(Phase* phase, double start_ms) {
+    const auto memory = getMemoryUsage();
+    const std::chrono::duration<double, std::milli> end = std::chrono::steady_clock::now() - _origin;
+    std::lock_guard<std::mutex> lock(_mutex);
+    phase->end_ms = std::max(phase->end_ms, end.count());
+    phase->duration_ms += end.count() - start_ms;
+    phase->rss_end_mb = memory.rss_mb;
+    phase->peak_rss_mb = std::max(phase->peak_rss_mb, memory.peak_rss_mb);
+}
+
+double StartupProfile::now_ms() const {
+    const std::chrono::duration<double, std::milli> now = std::chrono::steady_clock::now() - _origin;
+    return now.count();
+}
+
+std::string StartupProfile::to_json() const {
+    std::stringstream out;
+    out << std::fixed << std::setprecision(3);
+    std::lock_guard<std::mutex> lock(_mutex);
+    out << "{\"phases\": ";
+    _root->writeChildren(out);
+    out << ", \"peak_rss_mb\": " << getMemoryUsage().peak_rss_mb << "}";
+    return out.str();
+}
+
+struct StartupProfiler::Session {
+    struct Entry {
+        StartupProfile::Phase* phase;
+        double start_ms;
+    };
+
+    void push(const std::string& name) {
+        auto parent = stack.empty() ? parentPhase : stack.back().phase;
+        const auto start_ms = profile->now_ms();
+        stack.push_back({profile->begin(parent, name, start_ms), start_ms});
+    }
+
+    void pop() {
+        profile->end(stack.back().phase, stack.back().start_ms);
+        stack.pop_back();
+    }
+
+    StartupProfile::Ptr profile;
+    StartupProfile::Phase* parentPhase = nullptr;
+    std::vector<Entry> stack;
+    Session* previous = nullptr;
+};
+
+StartupProfiler::Session*& StartupProfiler::currentSession() {
+    static thread_local Session* session = nullptr;
+    return session;
+}
+
+StartupProfiler::StartupProfiler(const StartupProfile::Ptr& profile, const std::string& phase)
+    : StartupProfiler(Context{profile, nullptr}, phase) {}
+
+StartupProfiler::StartupProfiler(const Context& context, const std::string& phase) {
+    if (!context.profile) {
+        return;
+    }
+    _session.reset(new Session);
+    ++openSessions;
+    _session->profile = context.profile;
+    _session->parentPhase = context.phase;
+    _session->previous = currentSession();
+    _session->push(phase);
+    currentSession() = _session.get();
+}
+
+StartupProfiler::~StartupProfiler() {
+    if (!_session) {
+        return;
+    }
+    while (!_session->stack.empty()) {
+        _session->pop();
+    }
+    currentSession() = _session->previous;
+    --openSessions;
+}
+
+StartupProfiler::Context StartupProfiler::current() {
+    auto session = currentSession();
+    if (!session || session->stack.empty()) {
+        return {};
+    }
+    return {session->profile, session->stack.back().phase};
+}
+
+bool StartupProfiler::isActive() {
+    return openSessions.load(std::memory_order_relaxed) != 0;
+}
+
+void StartupProfiler::taskBegin(const char* name) {
+    if (auto session = currentSession()) {
+        session->push(name);
+    }
+}
+
+void StartupProfiler::taskEnd() {
+    auto session = currentSession();
+    // never closes the phase of the session itself, e.g. if a task started before the session ends inside it
+    if (session && session->stack.size() > 1) {
+        session->pop();
+    }
+}
+
+}  // namespace ov
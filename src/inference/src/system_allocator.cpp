@@ -4,11 +4,151 @@
 
 #include "system_allocator.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "threading/ie_thread_safe_containers.hpp"
+
 namespace InferenceEngine {
 
+namespace {
+
+constexpr size_t blockAlignment = 64;
+constexpr size_t minClassSizeLog2 = 6;
+// the larger blocks are rare and too expensive to be kept
+constexpr size_t maxClassSizeLog2 = 26;
+constexpr size_t classesPerPowerOfTwo = 4;
+constexpr size_t numClasses = (maxClassSizeLog2 - minClassSizeLog2) * classesPerPowerOfTwo + 1;
+constexpr size_t notPooled = SIZE_MAX;
+// the bytes kept in the cache of one size class, a few blocks are kept for the largest classes anyway
+constexpr size_t maxCachedBytesPerClass = 32 << 20;
+
+struct BlockHeader {
+    void* raw;
+    size_t sizeClass;
+};
+
+size_t sizeClassOf(size_t size) {
+    if (size <= (size_t(1) << minClassSizeLog2))
+        return 0;
+    if (size > (size_t(1) << maxClassSizeLog2))
+        return notPooled;
+    // 2^e < size <= 2^(e+1)
+    size_t e = 0;
+    for (size_t v = size - 1; v > 1; v >>= 1)
+        e++;
+    const size_t step = size_t(1) << (e - 2);
+    const size_t k = (size - (size_t(1) << e) + step - 1) / step;
+    return (e - minClassSizeLog2) * classesPerPowerOfTwo + k;
+}
+
+size_t sizeOfClass(size_t sizeClass) {
+    const size_t e = minClassSizeLog2 + sizeClass / classesPerPowerOfTwo;
+    return (size_t(1) << e) + (sizeClass % classesPerPowerOfTwo) * (size_t(1) << (e - 2));
+}
+
+class MemoryPool {
+public:
+    MemoryPool() {
+        for (size_t i = 0; i < numClasses; i++) {
+            const size_t capacity = std::max<size_t>(4, std::min<size_t>(256, maxCachedBytesPerClass / sizeOfClass(i)));
+            _caches.emplace_back(new LockFreeBoundedQueue<void*>(capacity));
+        }
+    }
+
+    void* alloc(size_t size) {
+        const auto sizeClass = sizeClassOf(size);
+        if (sizeClass != notPooled) {
+            size = sizeOfClass(sizeClass);
+            void* handle = nullptr;
+            if (_caches[sizeClass]->try_pop(handle)) {
+                _cachedBytes.fetch_sub(size);
+                return handle;
+            }
+        }
+
+        void* raw = std::malloc(sizeof(BlockHeader) + blockAlignment - 1 + size);
+        if (raw == nullptr)
+            return nullptr;
+        const auto address = reinterpret_cast<uintptr_t>(raw) + sizeof(BlockHeader);
+        void* handle = reinterpret_cast<void*>((address + blockAlignment - 1) & ~(blockAlignment - 1));
+        auto header = reinterpret_cast<BlockHeader*>(handle) - 1;
+        header->raw = raw;
+        header->sizeClass = sizeClass;
+        return handle;
+    }
+
+    void free(void* handle) {
+        auto header = reinterpret_cast<BlockHeader*>(handle) - 1;
+        const auto sizeClass = header->sizeClass;
+        if (sizeClass != notPooled) {
+            const size_t size = sizeOfClass(sizeClass);
+            // the blocks of other classes are evicted, the largest first, to keep the total cached size in the budget
+            size_t cachedBytes = _cachedBytes.fetch_add(size) + size;
+            for (size_t evictedClass = numClasses; cachedBytes > PooledMemoryAllocator::maxCachedBytes && evictedClass > 0;) {
+                if (evictedClass - 1 == sizeClass || !evict(evictedClass - 1))
+                    evictedClass--;
+                cachedBytes = _cachedBytes.load();
+            }
+            if (cachedBytes <= PooledMemoryAllocator::maxCachedBytes && _caches[sizeClass]->try_push(handle))
+                return;
+            _cachedBytes.fetch_sub(size);
+        }
+        std::free(header->raw);
+    }
+
+    size_t cachedBytes() const {
+        return _cachedBytes.load();
+    }
+
+private:
+    bool evict(size_t sizeClass) {
+        void* handle = nullptr;
+        if (!_caches[sizeClass]->try_pop(handle))
+            return false;
+        _cachedBytes.fetch_sub(sizeOfClass(sizeClass));
+        std::free((reinterpret_cast<BlockHeader*>(handle) - 1)->raw);
+        return true;
+    }
+
+    std::vector<std::unique_ptr<LockFreeBoundedQueue<void*>>> _caches;
+    std::atomic<size_t> _cachedBytes{0};
+};
+
+MemoryPool& memoryPool() {
+    // the pool is never destroyed, so the blobs released by other static objects at exit are still freed correctly
+    static auto pool = new MemoryPool();
+    return *pool;
+}
+
+}  // namespace
+
+constexpr size_t PooledMemoryAllocator::maxCachedBytes;
+
+void* PooledMemoryAllocator::alloc(size_t size) noexcept {
+    try {
+        return memoryPool().alloc(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+bool PooledMemoryAllocator::free(void* handle) noexcept {
+    if (handle != nullptr)
+        memoryPool().free(handle);
+    return true;
+}
+
+size_t PooledMemoryAllocator::cachedBytes() noexcept {
+    return memoryPool().cachedBytes();
+}
+
 INFERENCE_ENGINE_API_CPP(std::shared_ptr<IAllocator>) CreateDefaultAllocator() noexcept {
     try {
-        return std::make_shared<SystemMemoryAllocator>();
+        return std::make_shared<PooledMemoryAllocator>();
     } catch (...) {
         return nullptr;
     }
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "ie_allocator.hpp"
+#include "ie_api.h"
 
 namespace InferenceEngine {
 class SystemMemoryAllocator : public InferenceEngine::IAllocator {
@@ -33,4 +36,30 @@ public:
     }
 };
 
+/**
+ * @brief The allocator recycling the freed memory blocks instead of returning them to the system
+ * @details The sizes are rounded up to the size classes (four per power of two), the freed blocks are kept in
+ * lock-free per-class caches shared by all the instances, so the allocation of the same sizes (e.g. the tensors of
+ * the infer requests created and destroyed by a server) doesn't reach the system allocator in the steady state.
+ * The total size of the kept blocks is limited by maxCachedBytes for the whole process: the cached blocks of the
+ * largest classes are returned to the system first to make room for a freed block.
+ * The blocks are aligned to 64 bytes. Only the blocks allocated by this allocator can be freed by it.
+ */
+class INFERENCE_ENGINE_API_CLASS(PooledMemoryAllocator) : public SystemMemoryAllocator {
+public:
+    /**
+     * @brief The limit of the total size of the freed blocks kept by all the instances
+     */
+    static constexpr size_t maxCachedBytes = size_t(128) << 20;
+
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @brief Returns the total size of the freed blocks kept by all the instances
+     */
+    static size_t cachedBytes() noexcept;
+};
+
 }  // namespace InferenceEngine
\ No newline at end of file
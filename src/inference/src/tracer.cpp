@@ -0,0 +1,281 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_tracer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "ie_common.h"
+#include "ie_startup_profile.hpp"
+
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
+
+namespace ov {
+
+namespace {
+
+constexpr size_t defaultEventsPerThread = 32 * 1024;
+
+uint64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+struct TraceEvent {
+    std::atomic<uint64_t> timestamp{0};
+    // nullptr marks the end of the last begun task
+    std::atomic<const char*> name{nullptr};
+};
+
+/**
+ * @brief Single producer ring buffer of the events of one thread, the oldest events are overwritten.
+ * The events are atomics with the relaxed access, so the dump can read them while the thread writes.
+ */
+class TraceBuffer {
+public:
+    TraceBuffer(size_t capacity, uint32_t id) : tid(id) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _events.reset(new TraceEvent[size]);
+        _mask = size - 1;
+    }
+
+    void push(const char* name) {
+        const auto head = _head.load(std::memory_order_relaxed);
+        auto& event = _events[head & _mask];
+        event.timestamp.store(nowNs(), std::memory_order_relaxed);
+        event.name.store(name, std::memory_order_relaxed);
+        _head.store(head + 1, std::memory_order_release);
+    }
+
+    std::vector<std::pair<uint64_t, const char*>> snapshot() const {
+        const uint64_t capacity = _mask + 1;
+        const auto head = _head.load(std::memory_order_acquire);
+        const auto first = std::max(head > capacity ? head - capacity : 0, _cleared.load(std::memory_order_relaxed));
+        std::vector<std::pair<uint64_t, const char*>> events;
+        events.reserve(head - first);
+        for (auto i = first; i < head; i++) {
+            const auto& event = _events[i & _mask];
+            events.emplace_back(event.timestamp.load(std::memory_order_relaxed),
+                                event.name.load(std::memory_order_relaxed));
+        }
+        // the thread could overwrite the oldest copied events in the meantime
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto newHead = _head.load(std::memory_order_relaxed);
+        const auto overwritten = newHead > capacity ? newHead - capacity : 0;
+        if (overwritten > first) {
+            events.erase(events.begin(), events.begin() + std::min<uint64_t>(overwritten - first, events.size()));
+        }
+        return events;
+    }
+
+    void clear() {
+        _cleared.store(_head.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+
+    const uint32_t tid;
+    // guarded by the mutex of the registry
+    std::string threadName;
+
+private:
+    std::unique_ptr<TraceEvent[]> _events;
+    uint64_t _mask = 0;
+    std::atomic<uint64_t> _head{0};
+    std::atomic<uint64_t> _cleared{0};
+};
+
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<TraceBuffer>> buffers;
+    std::atomic<bool> started{false};
+    size_t eventsPerThread = defaultEventsPerThread;
+    const uint64_t origin = nowNs();
+};
+
+TraceRegistry& registry() {
+    // never destroyed, the threads can still run tasks while the process exits
+    static auto registry = new TraceRegistry;
+    return *registry;
+}
+
+thread_local TraceBuffer* threadBuffer = nullptr;
+thread_local std::string currentThreadName;
+
+TraceBuffer& getThreadBuffer() {
+    if (!threadBuffer) {
+        auto& traceRegistry = registry();
+        std::lock_guard<std::mutex> lock(traceRegistry.mutex);
+        auto buffer = std::make_shared<TraceBuffer>(traceRegistry.eventsPerThread,
+                                                    static_cast<uint32_t>(traceRegistry.buffers.size()));
+        buffer->threadName = currentThreadName;
+        traceRegistry.buffers.push_back(buffer);
+        threadBuffer = buffer.get();
+    }
+    return *threadBuffer;
+}
+
+void writeJsonString(std::ostream& out, const char* str) {
+    out << '"';
+    for (; *str; ++str) {
+        if (*str == '"' || *str == '\\') {
+            out << '\\' << *str;
+        } else if (static_cast<unsigned char>(*str) < 0x20) {
+            out << ' ';
+        } else {
+            out << *str;
+        }
+    }
+    out << '"';
+}
+
+int processId() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return getpid();
+#endif
+}
+
+class RuntimeTaskListener : public openvino::itt::TaskListener {
+public:
+    void taskBegin(const char* name) override {
+        if (registry().started.load(std::memory_order_relaxed)) {
+            getThreadBuffer().push(name);
+        }
+        StartupProfiler::taskBegin(name);
+    }
+
+    void taskEnd() override {
+        if (registry().started.load(std::memory_order_relaxed)) {
+            getThreadBuffer().push(nullptr);
+        }
+        StartupProfiler::taskEnd();
+    }
+
+    bool isActive() const override {
+        return registry().started.load(std::memory_order_relaxed) || StartupProfiler::isActive();
+    }
+
+    void threadName(const char* name) override {
+        currentThreadName = name;
+        if (threadBuffer) {
+            std::lock_guard<std::mutex> lock(registry().mutex);
+            threadBuffer->threadName = name;
+        }
+    }
+};
+
+}  // namespace
+
+void Tracer::start(size_t eventsPerThread) {
+    auto& traceRegistry = registry();
+    std::lock_guard<std::mutex> lock(traceRegistry.mutex);
+    if (eventsPerThread == 0) {
+        auto env = std::getenv("OPENVINO_TRACE_BUFFER_SIZE");
+        eventsPerThread = env ? std::strtoul(env, nullptr, 10) : 0;
+    }
+    traceRegistry.eventsPerThread = eventsPerThread ? eventsPerThread : defaultEventsPerThread;
+    traceRegistry.started = true;
+}
+
+void Tracer::stop() {
+    registry().started = false;
+}
+
+bool Tracer::isStarted() {
+    return registry().started.load(std::memory_order_relaxed);
+}
+
+void Tracer::clear() {
+    auto& traceRegistry = registry();
+    std::lock_guard<std::mutex> lock(traceRegistry.mutex);
+    for (auto&& buffer : traceRegistry.buffers) {
+        buffer->clear();
+    }
+}
+
+void Tracer::dump(const std::string& path) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        IE_THROW() << "Can't open the trace file " << path;
+    }
+    auto& traceRegistry = registry();
+    std::vector<std::pair<std::shared_ptr<TraceBuffer>, std::string>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(traceRegistry.mutex);
+        for (auto&& buffer : traceRegistry.buffers) {
+            buffers.emplace_back(buffer, buffer->threadName);
+        }
+    }
+
+    const auto pid = processId();
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    bool first = true;
+    auto separator = [&] {
+        out << (first ? "\n" : ",\n");
+        first = false;
+    };
+    for (auto&& buffer : buffers) {
+        const auto tid = buffer.first->tid;
+        separator();
+        out << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << pid << ", \"tid\": " << tid
+            << ", \"args\": {\"name\": ";
+        writeJsonString(out, buffer.second.empty() ? ("thread_" + std::to_string(tid)).c_str() : buffer.second.c_str());
+        out << "}}";
+        for (auto&& event : buffer.first->snapshot()) {
+            // the timestamps are in microseconds with the nanosecond precision
+            const double ts = (static_cast<int64_t>(event.first) - static_cast<int64_t>(traceRegistry.origin)) / 1000.0;
+            separator();
+            if (event.second) {
+                out << "{\"name\": ";
+                writeJsonString(out, event.second);
+                out << ", \"ph\": \"B\"";
+            } else {
+                out << "{\"ph\": \"E\"";
+            }
+            out << ", \"ts\": " << ts << ", \"pid\": " << pid << ", \"tid\": " << tid << "}";
+        }
+    }
+    out << "\n]}\n";
+}
+
+openvino::itt::TaskListener& runtimeTaskListener() {
+    static RuntimeTaskListener listener;
+    return listener;
+}
+
+namespace {
+const bool runtimeTaskListenerRegistered = [] {
+    // the tasks of the OpenVINO runtime library itself, the plugins register the listener for their tasks
+    openvino::itt::setTaskListener(&runtimeTaskListener());
+    auto path = std::getenv("OPENVINO_TRACE_FILE");
+    if (path && *path) {
+        Tracer::start();
+        std::atexit([] {
+            try {
+                Tracer::dump(std::getenv("OPENVINO_TRACE_FILE"));
+            } catch (...) {
+            }
+        });
+    }
+    return true;
+}();
+}  // namespace
+
+}  // namespace ov
@@ -3,6 +3,8 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <limits>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -85,6 +87,11 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto policy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    _latencyAwareScheduling = policy != _config.end() &&
+                              policy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_LATENCY_AWARE;
+    _config[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = _latencyAwareScheduling ?
+        MultiDeviceConfigParams::MULTI_LATENCY_AWARE : MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY;
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -114,6 +121,7 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
                               itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
     auto& workerRequests = _workerRequests[device];
     auto& idleWorkerRequests = _idleWorkerRequests[device];
+    auto* statisticsPtr = &(_dispatchStatistics[device]);
     workerRequests.resize(numRequests);
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
@@ -123,11 +131,29 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
         workerRequest._inferRequest = {executableNetwork->CreateInferRequest(), executableNetwork._so};
         auto* workerRequestPtr = &workerRequest;
         workerRequestPtr->_index = num++;
+        workerRequestPtr->_statistics = statisticsPtr;
         IE_ASSERT(idleWorkerRequests.try_push(std::make_pair(workerRequestPtr->_index, workerRequestPtr)) == true);
         workerRequest._inferRequest->SetCallback(
             [workerRequestPtr, this, device, idleWorkerRequestsPtr] (std::exception_ptr exceptionPtr) mutable {
                 IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
+                {
+                    auto* statistics = workerRequestPtr->_statistics;
+                    const double latency = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count();
+                    // the smoothing factor keeps the estimation responsive to the device load changes
+                    // while filtering out the single outliers
+                    constexpr double smoothing = 0.2;
+                    std::lock_guard<std::mutex> lock(statistics->_mutex);
+                    statistics->_avgLatency = statistics->_hasSamples ?
+                        smoothing * latency + (1.0 - smoothing) * statistics->_avgLatency : latency;
+                    statistics->_hasSamples = true;
+                    statistics->_inFlight--;
+                }
+                int64_t notInferredYet = -1;
+                _firstInferenceTime.compare_exchange_strong(notInferredYet,
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - _loadStartTime).count());
                 {
                     auto capturedTask = std::move(workerRequestPtr->_task);
                     capturedTask();
@@ -137,10 +163,12 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
                     // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
                     // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
                     Task t;
-                    if (_inferPipelineTasks.try_pop(t))
+                    if (_inferPipelineTasks.try_pop(t)) {
+                        _numPendingTasks--;
                         ScheduleToWorkerInferRequest(std::move(t));
-                    else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
+                    } else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
                         ScheduleToWorkerInferRequest(std::move(t), device);
+                    }
                 }
             });
     }
@@ -186,19 +214,41 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
     // if Actual device is CPU, disabled _loadContext[CPU], only use _loadContext[ACTUALDEVICE]
     if (isActualDevCPU) {
         _loadContext[CPU].isEnabled = false;
+        _startupPath = "ACTUAL_DEVICE";
     } else {
         const auto CPUIter = std::find_if(metaDevices.begin(), metaDevices.end(),
                 [=](const DeviceInformation& d)->bool{return d.deviceName.find("CPU") != std::string::npos;});
-        // if have CPU Device,  enable _loadContext[CPU]
+        // importing the network of the actual device from the cache is expected to be faster
+        // than compiling the network for CPU, so the CPU helper is not needed in this case.
+        // the actual device may be cached with the compiling threads limited as in the CPU helper case,
+        // both configurations are checked with a single hash of the network
+        std::vector<DeviceInformation> candidates = {_loadContext[ACTUALDEVICE].deviceInfo};
         if (CPUIter != metaDevices.end()) {
+            auto limitedDeviceInfo = _loadContext[ACTUALDEVICE].deviceInfo;
+            LimitCompilingThreads(limitedDeviceInfo);
+            if (limitedDeviceInfo.config != _loadContext[ACTUALDEVICE].deviceInfo.config) {
+                candidates.push_back(limitedDeviceInfo);
+            }
+        }
+        const auto cachedIdx = FindCachedNetwork(candidates, modelPath, network);
+        // if have CPU Device,  enable _loadContext[CPU]
+        if (cachedIdx < candidates.size()) {
+            _loadContext[ACTUALDEVICE].deviceInfo = candidates[cachedIdx];
+            _loadContext[CPU].isEnabled = false;
+            _startupPath = "ACTUAL_DEVICE_FROM_CACHE";
+            LOG_INFO("[AUTOPLUGIN]:network for %s is found in cache, CPU helper is skipped",
+                     _loadContext[ACTUALDEVICE].deviceInfo.deviceName.c_str());
+        } else if (CPUIter != metaDevices.end()) {
             _loadContext[CPU].isEnabled = true;
             _loadContext[CPU].deviceInfo = *CPUIter;
             _loadContext[CPU].deviceInfo.config[CONFIG_KEY(PERFORMANCE_HINT)] =
                 InferenceEngine::PluginConfigParams::LATENCY;
             _loadContext[CPU].workName = "CPU_HELP";
+            _startupPath = "CPU_HELP";
             LOG_INFO("[AUTOPLUGIN]:will load CPU for accelerator");
         } else {
             _loadContext[CPU].isEnabled = false;
+            _startupPath = "ACTUAL_DEVICE";
         }
     }
 
@@ -262,9 +312,11 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
             _idleWorkerRequests[device.deviceName];
             _workerRequests[device.deviceName];
             _inferPipelineTasksDeviceSpecific[device.deviceName] = nullptr;
+            _dispatchStatistics[device.deviceName];
         }
         _idleWorkerRequests["CPU_HELP"];
         _workerRequests["CPU_HELP"];
+        _dispatchStatistics["CPU_HELP"];
         _inferPipelineTasksDeviceSpecific["CPU_HELP"] = nullptr;
         _executor->run(_loadContext[CPU].task);
         _executor->run(_loadContext[ACTUALDEVICE].task);
@@ -309,27 +361,10 @@ void MultiDeviceExecutableNetwork::TryToLoadNetWork(AutoLoadContext& context,
     auto& deviceConfig = context.deviceInfo.config;
     auto& deviceList = context.metaDevices;
     bool curDevIsCPU = (device.find("CPU") != std::string::npos);
-    bool curDevIsGPU = (device.find("GPU") != std::string::npos);
     {
         std::lock_guard<std::mutex> lock(_confMutex);
-        if (curDevIsGPU && _loadContext[CPU].isEnabled) {
-            // user does not set the compiling threads
-            // limit the threads num for compiling
-            int maxNumThreads = 0;
-            try {
-                maxNumThreads = _core->GetConfig(device, GPU_CONFIG_KEY(MAX_NUM_THREADS)).as<int>();
-            } catch (...) {
-                LOG_DEBUG("[AUTOPLUGIN]: cannot get MAX_NUM_THREADS from GPU");
-            }
-            if (maxNumThreads == static_cast<int>(std::thread::hardware_concurrency())) {
-                int threadNum = maxNumThreads / 2;
-                deviceConfig[GPU_CONFIG_KEY(MAX_NUM_THREADS)] = std::to_string(threadNum).c_str();
-                LOG_DEBUG("[AUTO PLUGIN]:gpu streams number for compiling: %s", deviceConfig[GPU_CONFIG_KEY(MAX_NUM_THREADS)].c_str());
-            } else {
-                // user set the compiling threads num
-                // use the user's val anyway
-                LOG_DEBUG("[AUTOPLUGIN]:user defined compiling threads: %d", maxNumThreads);
-            }
+        if (_loadContext[CPU].isEnabled) {
+            LimitCompilingThreads(context.deviceInfo);
         }
     }
     try {
@@ -407,6 +442,51 @@ void MultiDeviceExecutableNetwork::TryToLoadNetWork(AutoLoadContext& context,
     TryToLoadNetWork(context, modelPath, network);
 }
 
+void MultiDeviceExecutableNetwork::LimitCompilingThreads(DeviceInformation& deviceInfo) {
+    auto& device = deviceInfo.deviceName;
+    auto& deviceConfig = deviceInfo.config;
+    if (device.find("GPU") == std::string::npos) {
+        return;
+    }
+    // user does not set the compiling threads
+    // limit the threads num for compiling
+    int maxNumThreads = 0;
+    try {
+        maxNumThreads = _core->GetConfig(device, GPU_CONFIG_KEY(MAX_NUM_THREADS)).as<int>();
+    } catch (...) {
+        LOG_DEBUG("[AUTOPLUGIN]: cannot get MAX_NUM_THREADS from GPU");
+    }
+    if (maxNumThreads == static_cast<int>(std::thread::hardware_concurrency())) {
+        int threadNum = maxNumThreads / 2;
+        deviceConfig[GPU_CONFIG_KEY(MAX_NUM_THREADS)] = std::to_string(threadNum).c_str();
+        LOG_DEBUG("[AUTO PLUGIN]:gpu streams number for compiling: %s", deviceConfig[GPU_CONFIG_KEY(MAX_NUM_THREADS)].c_str());
+    } else {
+        // user set the compiling threads num
+        // use the user's val anyway
+        LOG_DEBUG("[AUTOPLUGIN]:user defined compiling threads: %d", maxNumThreads);
+    }
+}
+
+size_t MultiDeviceExecutableNetwork::FindCachedNetwork(const std::vector<DeviceInformation>& candidates,
+                                                      const std::string& modelPath,
+                                                      const InferenceEngine::CNNNetwork& network) const {
+    // all the candidates are configurations of the same device
+    const auto& deviceName = candidates.front().deviceName;
+    std::vector<std::map<std::string, std::string>> configs;
+    for (auto&& candidate : candidates) {
+        configs.push_back(candidate.config);
+    }
+    try {
+        if (!modelPath.empty()) {
+            return _core->FindCachedNetwork(modelPath, deviceName, configs);
+        }
+        return _core->FindCachedNetwork(network, deviceName, configs);
+    } catch (const std::exception& e) {
+        LOG_DEBUG("[AUTOPLUGIN]:cannot check the cache for %s: %s", deviceName.c_str(), e.what());
+    }
+    return candidates.size();
+}
+
 void MultiDeviceExecutableNetwork::WaitFirstNetworkReady() {
     if (_firstLoadFuture.valid()) {
         // wait for the first loading finished
@@ -481,6 +561,11 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
             std::lock_guard<std::mutex> lock(_mutex);
             return _devicePriorities;
         }();
+        if (_latencyAwareScheduling && preferred_device.empty() && devices.size() > 1) {
+            // waiting for a busy device may still finish sooner than running on a slower idle one,
+            // so the task is offered to the best device only and queued if that device has no idle requests
+            devices = {SelectFastestDevice(devices)};
+        }
     }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
@@ -493,8 +578,45 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
     // no vacant requests this time, storing the task to the respective queue
     if (!preferred_device.empty())
         _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    else {
+        _numPendingTasks++;
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
+}
+
+double MultiDeviceExecutableNetwork::EstimateCompletionTime(const DeviceName& device) const {
+    auto statistics = _dispatchStatistics.find(device);
+    auto workers = _workerRequests.find(device);
+    if (statistics == _dispatchStatistics.end() || workers == _workerRequests.end() || workers->second.empty()) {
+        return std::numeric_limits<double>::max();
+    }
+    double avgLatency = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(statistics->second._mutex);
+        // the device was not measured yet, let it take a single request to get the first latency sample
+        if (!statistics->second._hasSamples) {
+            return statistics->second._inFlight == 0 ? 0.0 : std::numeric_limits<double>::max();
+        }
+        avgLatency = statistics->second._avgLatency;
+    }
+    // the device drains its queue (requests in flight, the pending ones and the new one)
+    // with the throughput of numWorkers / avgLatency, but a request never completes faster than the latency itself
+    const double queueDepth = statistics->second._inFlight + _numPendingTasks + 1;
+    return (std::max)(avgLatency, queueDepth * avgLatency / workers->second.size());
+}
+
+DeviceInformation MultiDeviceExecutableNetwork::SelectFastestDevice(const std::vector<DeviceInformation>& devices) const {
+    // devices are in the priority order, so the higher priority device wins if the estimations are equal
+    auto fastest = devices.cbegin();
+    double fastestTime = EstimateCompletionTime(fastest->deviceName);
+    for (auto device = std::next(fastest); device != devices.cend(); ++device) {
+        const double time = EstimateCompletionTime(device->deviceName);
+        if (time < fastestTime) {
+            fastest = device;
+            fastestTime = time;
+        }
+    }
+    return *fastest;
 }
 
 bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
@@ -506,9 +628,18 @@ bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
       workerRequestPtr = worker.second;
       IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
       _thisWorkerInferRequest = workerRequestPtr;
+      workerRequestPtr->_statistics->_inFlight++;
+      workerRequestPtr->_statistics->_dispatched++;
+      workerRequestPtr->_startTime = std::chrono::steady_clock::now();
       {
           auto capturedTask = std::move(inferPipelineTask);
-          capturedTask();
+          try {
+              capturedTask();
+          } catch (...) {
+              // the request was not started, so the completion callback will not account it
+              workerRequestPtr->_statistics->_inFlight--;
+              throw;
+          }
       }
       idleGuard.Release();
       return true;
@@ -753,8 +884,15 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::hint::model_priority.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RO}
+                ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{METRIC_KEY(AUTO_STARTUP_PATH), ov::PropertyMutability::RO},
+                ov::PropertyName{METRIC_KEY(AUTO_TIME_TO_FIRST_INFERENCE_MS), ov::PropertyMutability::RO}
             };
+        } else if (name == METRIC_KEY(AUTO_STARTUP_PATH)) {
+            return _startupPath;
+        } else if (name == METRIC_KEY(AUTO_TIME_TO_FIRST_INFERENCE_MS)) {
+            const auto firstInferenceTime = _firstInferenceTime.load();
+            return firstInferenceTime < 0 ? -1.0 : firstInferenceTime / 1000.0;
         } else if (name == ov::device::priorities) {
             auto value = _config.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
             return decltype(ov::device::priorities)::value_type {value->second.as<std::string>()};
@@ -854,10 +992,12 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             ov::PropertyName{ov::supported_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
+            ov::PropertyName{METRIC_KEY(MULTI_DEVICE_DISPATCH_STATISTICS), ov::PropertyMutability::RO},
 
             // Configs
             // device priority can be changed on-the-fly in MULTI
-            ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW}
+            ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, ov::PropertyMutability::RO}
         };
     } else if (name == ov::optimal_number_of_infer_requests) {
         unsigned int res = 0u;
@@ -876,15 +1016,34 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
         auto it = _networksPerDevice.begin();
         IE_ASSERT(it != _networksPerDevice.end());
         return decltype(ov::model_name)::value_type {it->second->GetMetric(METRIC_KEY(NETWORK_NAME)).as<std::string>()};
+    } else if (name == METRIC_KEY(MULTI_DEVICE_DISPATCH_STATISTICS)) {
+        std::map<std::string, std::map<std::string, double>> statistics;
+        for (auto&& device : _devicePrioritiesInitial) {
+            auto iter = _dispatchStatistics.find(device.deviceName);
+            if (iter == _dispatchStatistics.end()) {
+                continue;
+            }
+            auto& deviceStatistics = statistics[device.deviceName];
+            deviceStatistics["DISPATCHED"] = static_cast<double>(iter->second._dispatched);
+            deviceStatistics["IN_FLIGHT"] = static_cast<double>(iter->second._inFlight);
+            {
+                std::lock_guard<std::mutex> lock(iter->second._mutex);
+                deviceStatistics["AVERAGE_LATENCY_MS"] = iter->second._avgLatency;
+            }
+            deviceStatistics["EXPECTED_COMPLETION_MS"] = EstimateCompletionTime(device.deviceName);
+        }
+        return statistics;
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(MULTI_DEVICE_DISPATCH_STATISTICS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric key: " << name;
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <unordered_map>
 #include <map>
@@ -82,12 +83,22 @@ class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkTh
                                      public InferenceEngine::ITaskExecutor {
 public:
     using Ptr = std::shared_ptr<MultiDeviceExecutableNetwork>;
+    struct DispatchStatistics {
+        std::atomic<unsigned int>                 _inFlight = {0};
+        std::atomic<uint64_t>                     _dispatched = {0};
+        mutable std::mutex                        _mutex;
+        // exponential moving average of the request latency on the device, in milliseconds
+        double                                    _avgLatency = 0.0;
+        bool                                      _hasSamples = false;
+    };
     struct WorkerInferRequest {
         InferenceEngine::SoIInferRequestInternal  _inferRequest;
         InferenceEngine::Task                     _task;
         std::exception_ptr                        _exceptionPtr = nullptr;
         unsigned int                              _inferCount = 0;
         int                                       _index = 0;
+        DispatchStatistics*                       _statistics = nullptr;
+        std::chrono::steady_clock::time_point     _startTime;
     };
     using NotBusyWorkerRequests = InferenceEngine::ThreadSafeBoundedPriorityQueue<std::pair<int, WorkerInferRequest*>>;
 
@@ -117,6 +128,8 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
+    double EstimateCompletionTime(const DeviceName& device) const;
+    DeviceInformation SelectFastestDevice(const std::vector<DeviceInformation>& devices) const;
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
@@ -131,9 +144,15 @@ public:
     DeviceMap<std::unique_ptr<InferenceEngine::ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<DispatchStatistics>                               _dispatchStatistics;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
+    std::atomic_size_t                                          _numPendingTasks = {0};
+    bool                                                        _latencyAwareScheduling = false;
+    std::chrono::steady_clock::time_point                       _loadStartTime = std::chrono::steady_clock::now();
+    // time from the network loading start to the first completed inference, in microseconds
+    std::atomic<int64_t>                                        _firstInferenceTime = {-1};
 
 private:
     void GenerateWorkers(const std::string& device, const InferenceEngine::SoExecutableNetworkInternal& executableNetwork);
@@ -145,6 +164,10 @@ private:
     void TryToLoadNetWork(AutoLoadContext& context,
                           const std::string& modelPath,
                           const InferenceEngine::CNNNetwork& network);
+    void LimitCompilingThreads(DeviceInformation& deviceInfo);
+    size_t FindCachedNetwork(const std::vector<DeviceInformation>& candidates,
+                             const std::string& modelPath,
+                             const InferenceEngine::CNNNetwork& network) const;
 
 private:
     std::shared_ptr<InferenceEngine::ICore>                             _core;
@@ -161,6 +184,7 @@ private:
     bool                                                                _exitFlag = {false};
     const InferenceEngine::CNNNetwork                                   _network;
     int                                                                 _cpuHelpInferCount = 0;
+    std::string                                                         _startupPath;
 };
 
 }  // namespace MultiDevicePlugin
@@ -58,6 +58,7 @@ namespace {
     std::vector<std::string> supported_configKeys = []() -> decltype(PerfHintsConfig::SupportedKeys()) {
                     auto res = PerfHintsConfig::SupportedKeys();
                     res.push_back(ov::device::priorities.name());
+                    res.push_back(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
                     res.push_back(CONFIG_KEY_INTERNAL(MULTI_WORK_MODE_AS_AUTO));
                     res.push_back(ov::enable_profiling.name());
                     res.push_back(PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS);
@@ -354,6 +355,13 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
         metaDevices = ParseMetaDevices(priorities->second, fullConfig);
         multiNetworkConfig.insert(*priorities);
     }
+    auto schedulingPolicy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (schedulingPolicy != fullConfig.end()) {
+        AutoContext context;
+        std::map<std::string, std::string> filterConfig;
+        CheckConfig({*schedulingPolicy}, context, filterConfig);
+        multiNetworkConfig.insert(*schedulingPolicy);
+    }
 
     DeviceMap<SoExecutableNetworkInternal> executableNetworkPerDevice;
     std::mutex load_mutex;
@@ -666,6 +674,12 @@ void MultiDeviceInferencePlugin::CheckConfig(const std::map<std::string, std::st
                 IE_THROW() << "Unsupported config value: " << kvp.second
                            << " for key: " << kvp.first;
             }
+        } else if (kvp.first == MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY) {
+            if (kvp.second != MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY &&
+                kvp.second != MultiDeviceConfigParams::MULTI_LATENCY_AWARE) {
+                IE_THROW() << "Unsupported config value: " << kvp.second
+                           << " for key: " << kvp.first;
+            }
         } else if (kvp.first == ov::hint::allow_auto_batching) {
             if (kvp.second == PluginConfigParams::NO) {
                 context.batchingDisabled = true;
@@ -3,15 +3,41 @@
 //
 
 #include "async_infer_request.h"
+#include "exec_network.h"
+#include <cpp/ie_infer_request.hpp>
 #include <memory>
 
 ov::intel_cpu::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+      _inferRequest(static_cast<MKLDNNInferRequestBase*>(inferRequest.get())) {
+    _inferRequest->SetAsyncRequest(this);
+    _inferRequest->SaveDefaultState();
 }
 
 ov::intel_cpu::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
     StopAndWait();
 }
+
+bool ov::intel_cpu::MKLDNNAsyncInferRequest::Recycle() {
+    try {
+        Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+    } catch (...) {
+        // the failure of the last inference was already reported to the user
+    }
+    try {
+        SetCallback({});
+    } catch (...) {
+        return false;
+    }
+    if (!_inferRequest->Recycle())
+        return false;
+    setPointerToExecutableNetworkInternal(nullptr);
+    return true;
+}
+
+void ov::intel_cpu::MKLDNNAsyncInferRequest::Reuse(const std::shared_ptr<MKLDNNExecNetwork>& execNetwork) {
+    _inferRequest->Reuse(execNetwork);
+    setPointerToExecutableNetworkInternal(execNetwork);
+}
@@ -18,6 +18,21 @@ public:
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~MKLDNNAsyncInferRequest();
+
+    /**
+     * @brief Waits for the request released by the user and prepares it to be reused, see MKLDNNInferRequestBase::Recycle
+     * @return `false` if the request can't be reused
+     */
+    bool Recycle();
+
+    /**
+     * @brief Attaches the recycled request to the executable network
+     * @param[in]  execNetwork The executable network the request was created by
+     */
+    void Reuse(const std::shared_ptr<MKLDNNExecNetwork>& execNetwork);
+
+private:
+    MKLDNNInferRequestBase* _inferRequest;
 };
 
 }   // namespace intel_cpu
@@ -105,6 +105,13 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SCALED_ATTN_FUSION) {
+            if (val == PluginConfigParams::YES)
+                scaledAttnFusion = true;
+            else if (val == PluginConfigParams::NO)
+                scaledAttnFusion = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SCALED_ATTN_FUSION;
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)) {
@@ -148,6 +155,35 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (key == ov::intel_cpu::weights_placement.name()) {
+            try {
+                weightsPlacement = ov::util::from_string(val, ov::intel_cpu::weights_placement);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::weights_placement.name()
+                           << ". Supported values: REPLICATE, INTERLEAVE, FIRST_TOUCH";
+            }
+        } else if (key == ov::intel_cpu::streams_calibration.name()) {
+            if (val == PluginConfigParams::YES) streamsCalibration = true;
+            else if (val == PluginConfigParams::NO) streamsCalibration = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::streams_calibration.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::hw_perf_counters.name()) {
+            if (val == PluginConfigParams::YES) hwPerfCounters = true;
+            else if (val == PluginConfigParams::NO) hwPerfCounters = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::hw_perf_counters.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::sparse_weights_rate.name()) {
+            float rate = -1.0f;
+            try {
+                rate = std::stof(val);
+            } catch (const std::exception&) {
+            }
+            if (rate < 0.0f || rate > 1.0f)
+                IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::sparse_weights_rate.name()
+                           << ". Expected a number in the range [0, 1]";
+            sparseWeightsRate = rate;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -212,6 +248,12 @@ void Config::updateProperties() {
     _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
             std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
     _config.insert({PluginConfigParams::KEY_CACHE_DIR, cache_dir});
+    _config.insert({ov::intel_cpu::weights_placement.name(), ov::util::to_string(weightsPlacement)});
+    _config.insert({ov::intel_cpu::streams_calibration.name(),
+                    streamsCalibration ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::hw_perf_counters.name(),
+                    hwPerfCounters ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::sparse_weights_rate.name(), std::to_string(sparseWeightsRate)});
 }
 
 #ifdef CPU_DEBUG_CAPS
@@ -7,6 +7,7 @@
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
 #include "utils/debug_capabilities.h"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #include <string>
 #include <map>
@@ -28,6 +29,11 @@ struct Config {
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 5000ul;
+    ov::intel_cpu::WeightsPlacement weightsPlacement = ov::intel_cpu::WeightsPlacement::REPLICATE;
+    bool streamsCalibration = false;
+    bool hwPerfCounters = false;
+    float sparseWeightsRate = 1.0f;
+    bool scaledAttnFusion = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
@@ -191,6 +191,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "Subgraph", Subgraph},
         { "PriorBox", PriorBox},
         { "PriorBoxClustered", PriorBoxClustered},
+        { "ScaledDotProductAttention", ScaledDotProductAttention},
 };
 
 Type TypeFromName(const std::string& type) {
@@ -376,6 +377,8 @@ std::string NameFromType(const Type type) {
             return "Reference";
         case Subgraph:
             return "Subgraph";
+        case ScaledDotProductAttention:
+            return "ScaledDotProductAttention";
         default:
             return "Unknown";
     }
@@ -105,6 +105,7 @@ enum Type {
     Subgraph,
     PriorBox,
     PriorBoxClustered,
+    ScaledDotProductAttention,
 };
 
 enum Algorithm {
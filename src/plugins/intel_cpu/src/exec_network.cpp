@@ -20,6 +20,7 @@
 #endif
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
+#include <ie_startup_profile.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -121,11 +122,16 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    // enough to keep the requests of the clients served concurrently, the rest is destroyed on release
+    _requestPool = std::make_shared<RequestPool>(std::max(8, 2 * streams));
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
+        // the graphs are created in the stream threads, continue the startup profile of the loading thread there
+        auto startupContext = ov::StartupProfiler::current();
         for (auto&& task : tasks) {
-            task = [this] {
+            task = [this, startupContext] {
+                ov::StartupProfiler startupProfiler(startupContext, "StreamGraph");
                 MKLDNNExecNetwork::GetGraph();
             };
         }
@@ -171,11 +177,13 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
+                ov::intel_cpu::WeightsPlacement weightsPlacement;
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
+                    weightsPlacement = _cfg.weightsPlacement;
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights.get(numaNodeId, weightsPlacement));
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -206,7 +214,28 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 }
 
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    std::shared_ptr<MKLDNNAsyncInferRequest> request;
+    InferenceEngine::IInferRequestInternal::Ptr pooledRequest;
+    if (_requestPool->try_pop(pooledRequest)) {
+        request = std::static_pointer_cast<MKLDNNAsyncInferRequest>(pooledRequest);
+        request->Reuse(std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this()));
+    } else {
+        request = std::static_pointer_cast<MKLDNNAsyncInferRequest>(CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>());
+    }
+
+    // the request released by the user is returned to the pool instead of being destroyed
+    std::weak_ptr<RequestPool> requestPool = _requestPool;
+    return InferenceEngine::IInferRequestInternal::Ptr(request.get(),
+        [request, requestPool](InferenceEngine::IInferRequestInternal*) mutable {
+            auto releasedRequest = std::move(request);
+            // keeps the network alive until the recycled request is pooled, the network destroys the pool afterwards
+            auto network = releasedRequest->getPointerToExecutableNetworkInternal();
+            auto pool = requestPool.lock();
+            if (pool && releasedRequest->Recycle()) {
+                InferenceEngine::IInferRequestInternal::Ptr recycledRequest = std::move(releasedRequest);
+                pool->try_push(recycledRequest);
+            }
+        });
 }
 
 std::shared_ptr<ngraph::Function> MKLDNNExecNetwork::GetExecGraphInfo() {
@@ -259,6 +288,8 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetricLegacy(const std::string
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(ov::intel_cpu::eliminated_reorders.name());
+        metrics.push_back(ov::intel_cpu::roofline_report.name());
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -273,6 +304,10 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetricLegacy(const std::string
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == ov::intel_cpu::eliminated_reorders) {
+        return decltype(ov::intel_cpu::eliminated_reorders)::value_type(graph.getEliminatedReordersCount());
+    } else if (name == ov::intel_cpu::roofline_report) {
+        return decltype(ov::intel_cpu::roofline_report)::value_type(rooflineReport(graph));
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -306,6 +341,12 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
+            RO_property(ov::intel_cpu::weights_placement.name()),
+            RO_property(ov::intel_cpu::streams_calibration.name()),
+            RO_property(ov::intel_cpu::eliminated_reorders.name()),
+            RO_property(ov::intel_cpu::hw_perf_counters.name()),
+            RO_property(ov::intel_cpu::roofline_report.name()),
+            RO_property(ov::intel_cpu::sparse_weights_rate.name()),
         };
     }
 
@@ -348,6 +389,14 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::weights_placement) {
+        return decltype(ov::intel_cpu::weights_placement)::value_type(config.weightsPlacement);
+    } else if (name == ov::intel_cpu::streams_calibration) {
+        return decltype(ov::intel_cpu::streams_calibration)::value_type(config.streamsCalibration);
+    } else if (name == ov::intel_cpu::hw_perf_counters) {
+        return decltype(ov::intel_cpu::hw_perf_counters)::value_type(config.hwPerfCounters);
+    } else if (name == ov::intel_cpu::sparse_weights_rate) {
+        return decltype(ov::intel_cpu::sparse_weights_rate)::value_type(config.sparseWeightsRate);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -537,6 +586,12 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
 }
 
 void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
-    CNNNetworkSerializer serializer(modelStream, extensionManager);
+    std::map<std::string, std::string> runtimeConfig;
+    if (_cfg.streamsCalibration) {
+        // store the calibrated streams, so the model imported from the cache doesn't repeat the calibration
+        runtimeConfig[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = std::to_string(_cfg.streamExecutorConfig._streams);
+        runtimeConfig[PluginConfigParams::KEY_CPU_THREADS_NUM] = std::to_string(_cfg.streamExecutorConfig._threads);
+    }
+    CNNNetworkSerializer serializer(modelStream, extensionManager, runtimeConfig);
     serializer <<_network;
 }
@@ -10,6 +10,7 @@
 #include "graph.h"
 #include "extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
+#include <threading/ie_thread_safe_containers.hpp>
 
 #include <vector>
 #include <memory>
@@ -83,6 +84,11 @@ protected:
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const Graph& graph) const;
+
+    using RequestPool = InferenceEngine::LockFreeBoundedQueue<InferenceEngine::IInferRequestInternal::Ptr>;
+    // The requests released by the user are kept with their blobs to be reused by CreateInferRequest().
+    // Should be the last member, the pooled requests are destroyed before the graphs they refer to.
+    std::shared_ptr<RequestPool>                _requestPool;
 };
 
 }   // namespace intel_cpu
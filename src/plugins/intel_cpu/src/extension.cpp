@@ -6,6 +6,7 @@
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include "ngraph_transformations/op/leaky_relu.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
+#include "ngraph_transformations/op/scaled_attn.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
 
 #include <ngraph/ngraph.hpp>
@@ -38,6 +39,7 @@ std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
         NGRAPH_OP(FullyConnectedNode, ov::intel_cpu)
         NGRAPH_OP(LeakyReluNode, ov::intel_cpu)
         NGRAPH_OP(PowerStaticNode, ov::intel_cpu)
+        NGRAPH_OP(ScaledAttnNode, ov::intel_cpu)
         NGRAPH_OP(SwishNode, ov::intel_cpu)
 #undef NGRAPH_OP
 
@@ -33,6 +33,7 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_tracer.hpp>
 
 #include "utils/general_utils.h"
 #include "utils/debug_capabilities.h"
@@ -40,6 +41,7 @@
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
 #include "utils/verbose.h"
+#include "utils/hw_perf_counters.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
 #include <ngraph/node.hpp>
@@ -75,6 +77,9 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
     Replicate(net, extMgr);
     InitGraph();
 
+    if (config.collectPerfCounters && config.hwPerfCounters)
+        machinePeaks = measureMachinePeaks();
+
     status = Ready;
 
     CPU_DEBUG_CAP_ENABLE(serialize(*this));
@@ -383,6 +388,8 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    AssignLayouts();
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -436,6 +443,117 @@ void MKLDNNGraph::InitDescriptors() {
     }
 }
 
+/**
+ * The primitive descriptors are selected greedily node by node, taking into account the layouts of the parents only.
+ * This pass revises the layouts of the nodes over the whole graph: each node is switched to the descriptor of the same
+ * implementation type which minimizes the estimated cost of the reorders on all its edges, until no node can be improved.
+ * The kernel choice is never changed, so the total cost (the number of elements moved by the reorders) only decreases.
+ */
+void MKLDNNGraph::AssignLayouts() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "MKLDNNGraph::AssignLayouts");
+
+    auto reorderCost = [](const MKLDNNEdgePtr& edge, const NodeDesc* parentPD, const NodeDesc* childPD) -> size_t {
+        // reorders of the constant data are executed only once on the network loading
+        if (parentPD == nullptr || childPD == nullptr || edge->getParent()->isConstant())
+            return 0;
+
+        const auto& parentConfs = parentPD->getConfig().outConfs;
+        const auto& childConfs = childPD->getConfig().inConfs;
+        int inNum = edge->getInputNum();
+        if (inNum < 0 || inNum >= parentConfs.size())
+            inNum = 0;
+        const int outNum = edge->getOutputNum();
+        if (parentConfs.empty() || outNum < 0 || outNum >= childConfs.size())
+            return 0;
+
+        if (childConfs[outNum].getMemDesc()->isCompatible(*parentConfs[inNum].getMemDesc()))
+            return 0;
+
+        const auto& shape = edge->getParent()->getOutputShapeAtPort(inNum);
+        return shape.isStatic() ? std::max<size_t>(shape.getElementsCount(), 1) : 1;
+    };
+
+    auto nodeCost = [&](const MKLDNNNodePtr& node, const NodeDesc* pd) {
+        size_t cost = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            cost += reorderCost(edge, edge->getParent()->getSelectedPrimitiveDescriptor(), pd);
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            cost += reorderCost(edge, pd, edge->getChild()->getSelectedPrimitiveDescriptor());
+        }
+        return cost;
+    };
+
+    auto countReorders = [&]() {
+        size_t count = 0;
+        for (auto& edge : graphEdges) {
+            if (reorderCost(edge, edge->getParent()->getSelectedPrimitiveDescriptor(), edge->getChild()->getSelectedPrimitiveDescriptor()))
+                count++;
+        }
+        return count;
+    };
+
+    // only the nodes which process any layout by the same kernel are revised, the in-place configurations are left as is
+    auto isLayoutAgnostic = [](const MKLDNNNodePtr& node) {
+        return one_of(node->getType(), Convolution, Eltwise, Pooling, FakeQuantize, Interpolate, MVN, Reduce, NormalizeL2, Pad,
+                      DepthToSpace, SpaceToDepth);
+    };
+
+    auto isSuitableConfig = [](const NodeConfig& config, const NodeConfig& selectedConfig) {
+        if (config.inConfs.size() != selectedConfig.inConfs.size() || config.outConfs.size() != selectedConfig.outConfs.size())
+            return false;
+        for (size_t i = 0; i < config.inConfs.size(); i++) {
+            if (config.inConfs[i].inPlace() >= 0 ||
+                config.inConfs[i].getMemDesc()->getPrecision() != selectedConfig.inConfs[i].getMemDesc()->getPrecision())
+                return false;
+        }
+        for (size_t i = 0; i < config.outConfs.size(); i++) {
+            if (config.outConfs[i].inPlace() >= 0 ||
+                config.outConfs[i].getMemDesc()->getPrecision() != selectedConfig.outConfs[i].getMemDesc()->getPrecision())
+                return false;
+        }
+        return true;
+    };
+
+    const size_t reordersBefore = countReorders();
+
+    // every switch strictly decreases the total cost, which is a non-negative integer, so the loop terminates
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (auto& node : graphNodes) {
+            const auto* selectedPD = node->getSelectedPrimitiveDescriptor();
+            if (!isLayoutAgnostic(node) || selectedPD == nullptr || !isSuitableConfig(selectedPD->getConfig(), selectedPD->getConfig()))
+                continue;
+
+            const auto& supportedPDs = node->getSupportedPrimitiveDescriptors();
+            int bestIdx = -1;
+            size_t bestCost = nodeCost(node, selectedPD);
+            for (size_t i = 0; i < supportedPDs.size() && bestCost > 0; i++) {
+                const auto& pd = supportedPDs[i];
+                if (&pd == selectedPD || pd.getImplementationType() != selectedPD->getImplementationType() ||
+                    !isSuitableConfig(pd.getConfig(), selectedPD->getConfig()))
+                    continue;
+
+                const auto cost = nodeCost(node, &pd);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestIdx = static_cast<int>(i);
+                }
+            }
+
+            if (bestIdx >= 0) {
+                node->selectPrimitiveDescriptorByIndex(bestIdx);
+                changed = true;
+            }
+        }
+    }
+
+    const size_t reordersAfter = countReorders();
+    eliminatedReorders = reordersBefore > reordersAfter ? reordersBefore - reordersAfter : 0;
+}
+
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "MKLDNNGraph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -940,9 +1058,20 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
+// Checks whether the execution of the node is traced, the nodes created before the tracer started are named here
+static inline bool isNodeTraced(const MKLDNNNodePtr& node) {
+    if (!ov::Tracer::isStarted())
+        return false;
+    auto& execute = node->perfCounters().execute;
+    if (!execute)
+        execute = openvino::itt::handle(node->getName());
+    return true;
+}
+
 inline void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const {
     DUMP(node, config, infer_count);
-    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, node->profiling.execute);
+    // the per-node scopes are built by default for the built-in tracer and cost a flag check while it doesn't run
+    OV_ITT_SCOPED_TASK_IF(isNodeTraced(node), itt::domains::intel_cpu, node->profiling.execute);
 
     if (node->isDynamicNode()) {
         node->executeDynamic(stream);
@@ -957,10 +1086,12 @@ void MKLDNNGraph::Infer(MKLDNNInferRequestBase* request) {
     }
 
     mkldnn::stream stream(eng);
+    const HwPerfCounters* hwCounters = config.collectPerfCounters && config.hwPerfCounters ?
+                                       HwPerfCounters::forCurrentThread() : nullptr;
 
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+        PERF(node, config.collectPerfCounters, hwCounters);
 
         if (request)
             request->ThrowIfCanceled();
@@ -1064,6 +1195,10 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         pc.execution_index = i++;
         // TODO: Why time counter is signed?
         pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
+        // the CPU time of the stream thread if the hardware performance counters are collected
+        const auto taskClockNs = node->PerfCounter().hwAvg().taskClockNs;
+        if (taskClockNs)
+            pc.cpu_uSec = (long long) (taskClockNs / 1000);
         pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
@@ -1329,6 +1464,7 @@ void MKLDNNGraph::EnforceBF16() {
         RNNCell,        // recurent nets
         RNNSeq,         // recurent nets
         MatMul,         // bert nets
+        ScaledDotProductAttention, // bert nets
         ROIPooling,     // object detection nets
         Interpolate,    // super resolution nets
     };
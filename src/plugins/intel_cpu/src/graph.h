@@ -11,6 +11,7 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "utils/roofline.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -112,6 +113,12 @@ public:
         return eng;
     }
 
+    /**
+     * @brief Fills the profiling info of the executed nodes, realTime_uSec is the average wall time of a node.
+     * cpu_uSec is the same wall time unless the hardware counters are collected (CPU_HW_PERF_COUNTERS),
+     * then it is the CPU time of the stream thread only, which excludes the waiting for the other threads
+     * and the preemption. The hardware counters themselves aren't part of the profiling info, see the runtime model.
+     */
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
     void RemoveDroppedNodes();
@@ -191,6 +198,15 @@ public:
         return graphHasDynamicInput;
     }
 
+    size_t getEliminatedReordersCount() const {
+        return eliminatedReorders;
+    }
+
+    // measured when the hardware performance counters are collected
+    const MachinePeaks& getMachinePeaks() const {
+        return machinePeaks;
+    }
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -223,6 +239,8 @@ protected:
 
     bool isQuantizedFlag = false;
     bool graphHasDynamicInput = false;
+    size_t eliminatedReorders = 0;
+    MachinePeaks machinePeaks;
 
     static mkldnn::engine eng;
 
@@ -231,6 +249,7 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void AssignLayouts();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
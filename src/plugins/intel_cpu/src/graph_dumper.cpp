@@ -29,7 +29,7 @@ void serializeToXML(const MKLDNNGraph &graph, const std::string& path);
 
 namespace {
 
-std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &node) {
+std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &node, const MachinePeaks &peaks) {
     std::map<std::string, std::string> serialization_info;
 
     if (node->getType() == Input && node->isConstant()) {
@@ -105,6 +105,21 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    // Hardware performance counters, collected with ov::intel_cpu::hw_perf_counters
+    const auto hwCounters = node->PerfCounter().hwAvg();
+    if (hwCounters.cycles != 0) {
+        const auto roofline = getNodeRoofline(node, peaks);
+        serialization_info["cycles"] = std::to_string(hwCounters.cycles);
+        serialization_info["instructions"] = std::to_string(hwCounters.instructions);
+        serialization_info["ipc"] = std::to_string(roofline.ipc);
+        serialization_info["llcMisses"] = std::to_string(hwCounters.llcMisses);
+        serialization_info["memoryBytes"] = std::to_string(static_cast<uint64_t>(roofline.bytes));
+        serialization_info["gflops"] = std::to_string(roofline.gflops);
+        serialization_info["arithmeticIntensity"] = std::to_string(roofline.arithmeticIntensity);
+        serialization_info["rooflineBound"] = roofline.memoryBound ? "memory" : "compute";
+        serialization_info["rooflineEfficiency"] = std::to_string(roofline.efficiency);
+    }
+
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
@@ -162,7 +177,7 @@ std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const MKLDNNGraph
             should_be_hold = true;
         }
 
-        auto meta_data = extract_node_metadata(node);
+        auto meta_data = extract_node_metadata(node, graph.getMachinePeaks());
         std::shared_ptr<ngraph::Node> return_node;
         if (is_input) {
             auto& desc = node->getChildEdgeAt(0)->getMemory().getDesc();
@@ -20,6 +20,8 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/embedding_bag_sum.h"
+#include "nodes/fullyconnected.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "mkldnn/ie_mkldnn.h"
@@ -47,6 +49,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <numeric>
 
 #include "itt.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -62,6 +65,18 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionMatMulAndBias(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndDecompression");
+    FuseEmbeddingBagAndDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFullyConnectedAndDecompression");
+    FuseFullyConnectedAndDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "PackFullyConnectedSparseWeights");
+    PackFullyConnectedSparseWeights(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMultiplyAndAdd");
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
@@ -134,6 +149,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseInterpolateAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvertAndInterpolate");
+    FuseConvertAndInterpolate(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseNormalizeL2AndSimpleOperation");
     FuseNormalizeL2AndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -334,6 +353,254 @@ void MKLDNNGraphOptimizer::FuseDeconvolutionAndSimpleOperation(MKLDNNGraph &grap
     }
 }
 
+// Returns the per tensor or per row constant data of the second eltwise input
+static bool getRowWiseDecompressionConstant(const MKLDNNNodePtr& node, size_t rows, std::vector<float>& data) {
+    if (node->getParentEdges().size() != 2)
+        return false;
+
+    auto constNode = std::dynamic_pointer_cast<MKLDNNInputNode>(node->getParentEdgesAtPort(1)[0]->getParent());
+    if (!constNode || !constNode->isConstant() || constNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+        return false;
+
+    const auto& dims = node->getInputShapeAtPort(1).getDims();
+    const auto& tableDims = node->getInputShapeAtPort(0).getDims();
+    const auto size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+    if (size != 1) {
+        if (dims.size() != tableDims.size() || dims[0] != rows ||
+            !std::all_of(dims.begin() + 1, dims.end(), [](size_t dim) { return dim == 1; }))
+            return false;
+    }
+
+    const auto constData = static_cast<const float*>(constNode->getMemoryPtr()->GetPtr());
+    data.assign(constData, constData + size);
+    return true;
+}
+
+// Composes the row-wise affine decompression 'x * scales + shifts' with the eltwise operation
+static bool applyDecompressionEltwise(const MKLDNNNodePtr& node, size_t rows, std::vector<float>& scales, std::vector<float>& shifts) {
+    if (node->getType() != Eltwise || !node->getFusedWith().empty())
+        return false;
+
+    if (node->getAlgorithm() == EltwisePowerStatic) {
+        auto eltwiseNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(node);
+        if (!eltwiseNode || eltwiseNode->getAlpha() != 1.0f)
+            return false;
+        for (size_t i = 0; i < scales.size(); i++) {
+            scales[i] *= eltwiseNode->getBeta();
+            shifts[i] = shifts[i] * eltwiseNode->getBeta() + eltwiseNode->getGamma();
+        }
+        return true;
+    }
+
+    std::vector<float> data;
+    if (!one_of(node->getAlgorithm(), EltwiseMultiply, EltwiseAdd, EltwiseSubtract) || !getRowWiseDecompressionConstant(node, rows, data))
+        return false;
+
+    if (data.size() > scales.size()) {
+        scales.resize(data.size(), scales[0]);
+        shifts.resize(data.size(), shifts[0]);
+    }
+    for (size_t i = 0; i < scales.size(); i++) {
+        const float value = data.size() == 1 ? data[0] : data[i];
+        switch (node->getAlgorithm()) {
+            case EltwiseMultiply:
+                scales[i] *= value;
+                shifts[i] *= value;
+                break;
+            case EltwiseAdd:
+                shifts[i] += value;
+                break;
+            default:
+                shifts[i] -= value;
+                break;
+        }
+    }
+    return true;
+}
+
+void MKLDNNGraphOptimizer::FuseEmbeddingBagAndDecompression(MKLDNNGraph &graph) {
+    // Row-wise quantized embedding tables (Constant[U8/I8] -> Convert -> Subtract/Add -> Multiply) are kept compressed:
+    // the decompression is applied by the EmbeddingBag JIT kernel while the rows are accumulated.
+    if (!cpu::x64::mayiuse(cpu::x64::sse41))
+        return;
+
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConvertNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Convert || node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+            return false;
+
+        const auto parent = node->getParentEdgesAtPort(0)[0]->getParent();
+        return parent->getType() == Input && parent->isConstant() &&
+               one_of(node->getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::I8) &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+               node->getInputShapeAtPort(0).isStatic() && node->getInputShapeAtPort(0).getRank() > 0;
+    };
+
+    auto isEmbeddingNode = [](MKLDNNNodePtr node) {
+        return one_of(node->getType(), EmbeddingBagOffsetsSum, EmbeddingBagPackedSum, EmbeddingSegmentsSum);
+    };
+
+    for (auto &graphNode : graphNodes) {
+        if (!isSuitableConvertNode(graphNode))
+            continue;
+
+        const size_t rows = graphNode->getInputShapeAtPort(0).getStaticDims()[0];
+        std::vector<float> scales{1.0f};
+        std::vector<float> shifts{0.0f};
+        std::vector<MKLDNNNodePtr> decompressionNodes{graphNode};
+
+        bool isSuitable = false;
+        auto node = graphNode;
+        while (node->getChildEdges().size() == 1 && node->getChildEdgeAt(0)->getOutputNum() == 0) {
+            auto child = node->getChildEdgeAt(0)->getChild();
+            if (isEmbeddingNode(child)) {
+                isSuitable = decompressionNodes.size() > 1;
+                break;
+            }
+            if (!applyDecompressionEltwise(child, rows, scales, shifts))
+                break;
+
+            decompressionNodes.push_back(child);
+            node = child;
+        }
+        if (!isSuitable)
+            continue;
+
+        auto embeddingNode = node->getChildEdgeAt(0)->getChild();
+        auto embeddingBagNode = dynamic_cast<MKLDNNEmbeddingBagSumNode*>(embeddingNode.get());
+        if (embeddingBagNode == nullptr)
+            IE_THROW() << "Cannot cast " << embeddingNode->getName() << " to EmbeddingBagSum node";
+
+        embeddingBagNode->fuseDecompression(std::move(scales), std::move(shifts));
+        embeddingNode->setOriginalInputPrecisionAtPort(0, graphNode->getOriginalInputPrecisionAtPort(0));
+        for (auto& decompressionNode : decompressionNodes) {
+            if (decompressionNode->getParentEdges().size() == 2)
+                graph.RemoveEdge(decompressionNode->getParentEdgesAtPort(1)[0]);
+            graph.DropNode(decompressionNode);
+        }
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndDecompression(MKLDNNGraph &graph) {
+    // Compressed weights (Constant[U8/I8/FP16] -> Convert -> Subtract/Add -> Multiply) are kept in memory as is:
+    // FullyConnected converts them to FP32 in registers and applies the per output channel scales and shifts to the result.
+    if (!cpu::x64::mayiuse(cpu::x64::avx2))
+        return;
+
+    auto& graphNodes = graph.GetNodes();
+    const bool withF16C = cpu::x64::cpu().has(Xbyak::util::Cpu::tF16C);
+
+    auto isSuitableConvertNode = [withF16C](MKLDNNNodePtr node) {
+        if (node->getType() != Convert || node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+            return false;
+
+        const auto parent = node->getParentEdgesAtPort(0)[0]->getParent();
+        const auto inputPrc = node->getOriginalInputPrecisionAtPort(0);
+        return parent->getType() == Input && parent->isConstant() &&
+               (one_of(inputPrc, Precision::U8, Precision::I8) || (inputPrc == Precision::FP16 && withF16C)) &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+               node->getInputShapeAtPort(0).isStatic() && node->getInputShapeAtPort(0).getRank() == 2;
+    };
+
+    auto isSuitableFullyConnectedNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != FullyConnected || !node->getFusedWith().empty())
+            return false;
+
+        const auto dataRank = node->getInputShapeAtPort(0).getRank();
+        return one_of(dataRank, 2, 3) && node->getOriginalInputPrecisionAtPort(0) == Precision::FP32 &&
+               (node->getOriginalInputsNumber() < 3 || node->getOriginalInputPrecisionAtPort(2) == Precision::FP32);
+    };
+
+    for (auto &graphNode : graphNodes) {
+        if (!isSuitableConvertNode(graphNode))
+            continue;
+
+        const size_t rows = graphNode->getInputShapeAtPort(0).getStaticDims()[0];
+        std::vector<float> scales{1.0f};
+        std::vector<float> shifts{0.0f};
+        std::vector<MKLDNNNodePtr> decompressionNodes{graphNode};
+
+        bool isSuitable = false;
+        auto node = graphNode;
+        while (node->getChildEdges().size() == 1) {
+            const auto childEdge = node->getChildEdgeAt(0);
+            auto child = childEdge->getChild();
+            if (childEdge->getOutputNum() == 1) {
+                isSuitable = isSuitableFullyConnectedNode(child);
+                break;
+            }
+            if (childEdge->getOutputNum() != 0 || !applyDecompressionEltwise(child, rows, scales, shifts))
+                break;
+
+            decompressionNodes.push_back(child);
+            node = child;
+        }
+        if (!isSuitable)
+            continue;
+
+        auto fcNode = node->getChildEdgeAt(0)->getChild();
+        auto fullyConnectedNode = dynamic_cast<MKLDNNFullyConnectedNode*>(fcNode.get());
+        if (fullyConnectedNode == nullptr)
+            IE_THROW() << "Cannot cast " << fcNode->getName() << " to FullyConnected node";
+
+        fullyConnectedNode->fuseDecompression(std::move(scales), std::move(shifts));
+        fcNode->setOriginalInputPrecisionAtPort(1, graphNode->getOriginalInputPrecisionAtPort(0));
+        for (auto& decompressionNode : decompressionNodes) {
+            if (decompressionNode->getParentEdges().size() == 2)
+                graph.RemoveEdge(decompressionNode->getParentEdgesAtPort(1)[0]);
+            graph.DropNode(decompressionNode);
+        }
+    }
+}
+
+void MKLDNNGraphOptimizer::PackFullyConnectedSparseWeights(MKLDNNGraph &graph) {
+    // Pruned constant weights are packed by blocks and the zero blocks are skipped by the FullyConnected kernel.
+    // It runs before the fusings, since the sparse kernel doesn't support post ops.
+    const float threshold = graph.getConfig().sparseWeightsRate;
+    if (threshold >= 1.0f || !cpu::x64::mayiuse(cpu::x64::avx2))
+        return;
+
+    auto isSuitableFullyConnectedNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != FullyConnected || !node->getFusedWith().empty())
+            return false;
+
+        const auto weights = node->getParentEdgesAtPort(1)[0]->getParent();
+        const auto dataRank = node->getInputShapeAtPort(0).getRank();
+        return weights->getType() == Input && weights->isConstant() &&
+               node->getInputShapeAtPort(1).isStatic() && node->getInputShapeAtPort(1).getRank() == 2 &&
+               one_of(dataRank, 2, 3) && node->getOriginalInputPrecisionAtPort(0) == Precision::FP32 &&
+               node->getOriginalInputPrecisionAtPort(1) == Precision::FP32 &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+               (node->getOriginalInputsNumber() < 3 || node->getOriginalInputPrecisionAtPort(2) == Precision::FP32);
+    };
+
+    auto& graphNodes = graph.GetNodes();
+    std::vector<MKLDNNNodePtr> packedWeightsNodes;
+    for (auto &graphNode : graphNodes) {
+        if (!isSuitableFullyConnectedNode(graphNode))
+            continue;
+
+        auto fullyConnectedNode = dynamic_cast<MKLDNNFullyConnectedNode*>(graphNode.get());
+        if (fullyConnectedNode == nullptr)
+            IE_THROW() << "Cannot cast " << graphNode->getName() << " to FullyConnected node";
+        if (fullyConnectedNode->withDecompression() || !fullyConnectedNode->useSparseWeights(threshold))
+            continue;
+
+        // the packed weights replace the dense ones, so the dense copy is released once no other node uses it
+        auto weightsEdge = graphNode->getParentEdgesAtPort(1)[0];
+        const auto packedWeights = std::make_shared<MKLDNNInputNode>(fullyConnectedNode->getSparseWeights(),
+                                                                     weightsEdge->getParent()->getName() + "_sparse",
+                                                                     graph.getEngine(), graph.weightsCache);
+        MKLDNNEdgePtr newEdge(new MKLDNNEdge(packedWeights, graphNode, 0, 1));
+        graphNode->addEdge(newEdge);
+        graph.GetEdges().push_back(newEdge);
+        packedWeightsNodes.push_back(packedWeights);
+        graph.RemoveEdge(weightsEdge);
+    }
+    graphNodes.insert(graphNodes.end(), packedWeightsNodes.begin(), packedWeightsNodes.end());
+}
+
 void MKLDNNGraphOptimizer::FuseMultiplyAndAdd(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1383,6 +1650,67 @@ void MKLDNNGraphOptimizer::FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph)
     }
 }
 
+void MKLDNNGraphOptimizer::FuseConvertAndInterpolate(MKLDNNGraph &graph) {
+    // Preprocessing subgraphs (u8 image -> Convert -> [Transpose] -> Interpolate -> mean/scale) are executed in a single pass:
+    // the Interpolate JIT kernel reads integer data natively and applies the normalization as fused post ops.
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConvertNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Convert || node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+            return false;
+
+        const auto inPrc = node->getOriginalInputPrecisionAtPort(0);
+        const auto outPrc = node->getOriginalOutputPrecisionAtPort(0);
+        return one_of(inPrc, Precision::U8, Precision::I8) && one_of(outPrc, Precision::FP32, Precision::BF16);
+    };
+
+    // The NHWC -> NCHW layout conversion of PrePostProcessor, the Interpolate is wrapped into such transposes
+    // by WrapInterpolateIntoTransposes. Once the Convert is dropped, it's merged with the Reorder to nspc layout
+    // in front of the Interpolate (MergeTransposeAndReorder), so the Interpolate reads the image in place.
+    auto isSuitableTransposeNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Transpose || node->getChildEdges().size() != 1 || node->getChildEdgeAt(0)->getOutputNum() != 0)
+            return false;
+
+        const auto transposeNode = std::dynamic_pointer_cast<MKLDNNTransposeNode>(node);
+        return transposeNode && transposeNode->getOrder() == SizeVector{0, 3, 1, 2};
+    };
+
+    auto isSuitableInterpolateNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Interpolate)
+            return false;
+
+        // The output precision of the Interpolate node is derived from its input precision unless it has fused
+        // operations, so the Convert may be dropped only if the normalization has already been fused.
+        // Such nodes are always executed by the JIT kernel, since fusing is not supported by the reference one.
+        const auto& fusedWith = node->getFusedWith();
+        return !fusedWith.empty() &&
+               one_of(fusedWith.back()->getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16);
+    };
+
+    for (auto &graphNode : graphNodes) {
+        if (!isSuitableConvertNode(graphNode) || graphNode->getChildEdgeAt(0)->getOutputNum() != 0)
+            continue;
+
+        const auto inPrc = graphNode->getOriginalInputPrecisionAtPort(0);
+        auto childNode = graphNode->getChildEdgeAt(0)->getChild();
+        MKLDNNNodePtr transposeNode;
+        if (isSuitableTransposeNode(childNode)) {
+            transposeNode = childNode;
+            childNode = transposeNode->getChildEdgeAt(0)->getChild();
+        }
+        if (!isSuitableInterpolateNode(childNode))
+            continue;
+
+        if (transposeNode) {
+            // the transposition is a copy, so it's done in the integer precision
+            transposeNode->setOriginalInputPrecisionAtPort(0, inPrc);
+            transposeNode->setOriginalOutputPrecisionAtPort(0, inPrc);
+        }
+        childNode->setOriginalInputPrecisionAtPort(0, inPrc);
+        graph.DropNode(graphNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseNormalizeL2AndSimpleOperation(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
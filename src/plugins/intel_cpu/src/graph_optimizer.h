@@ -22,6 +22,9 @@ public:
 private:
     void FuseConvolutionMatMulAndBias(MKLDNNGraph &graph);
     void FuseDeconvolutionAndSimpleOperation(MKLDNNGraph &graph);
+    void FuseEmbeddingBagAndDecompression(MKLDNNGraph &graph);
+    void FuseFullyConnectedAndDecompression(MKLDNNGraph &graph);
+    void PackFullyConnectedSparseWeights(MKLDNNGraph &graph);
     void FuseMultiplyAndAdd(MKLDNNGraph &graph);
     void FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &graph);
     void FuseMatMulAndSimpleOperation(MKLDNNGraph &graph);
@@ -32,6 +35,7 @@ private:
     void FuseConvolutionSumAndConvolutionSumActivation(MKLDNNGraph &graph);
     void FuseMVNAndSimpleOperation(MKLDNNGraph &graph);
     void FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph);
+    void FuseConvertAndInterpolate(MKLDNNGraph &graph);
     void FuseNormalizeL2AndSimpleOperation(MKLDNNGraph &graph);
     void FuseReduceAndSimpleOperation(MKLDNNGraph &graph);
 
@@ -20,6 +20,7 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "async_infer_request.h"
 #include <debug.h>
+#include <ie_startup_profile.hpp>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -59,7 +60,59 @@ void ov::intel_cpu::MKLDNNInferRequestBase::CreateInferRequest() {
 }
 
 ov::intel_cpu::MKLDNNInferRequestBase::~MKLDNNInferRequestBase() {
+    // the recycled requests are detached from the executable network
+    if (execNetwork)
+        --(execNetwork->_numRequests);
+}
+
+void ov::intel_cpu::MKLDNNInferRequestBase::SaveDefaultState() {
+    defaultInputs = _inputs;
+    defaultOutputs = _outputs;
+    defaultExternalPtr = externalPtr;
+
+    defaultBlobs.clear();
+    for (const auto* blobs : {&defaultInputs, &defaultOutputs}) {
+        for (const auto& blob : *blobs) {
+            defaultBlobs.emplace_back(blob.second, 0);
+        }
+    }
+    for (auto& blob : defaultBlobs) {
+        blob.second = blob.first.use_count();
+    }
+}
+
+bool ov::intel_cpu::MKLDNNInferRequestBase::Recycle() {
+    // the blobs and the states kept by the user after the request is released can't be shared with the next user
+    for (const auto& blob : defaultBlobs) {
+        if (blob.first.use_count() > blob.second)
+            return false;
+    }
+    for (const auto& state : memoryStates) {
+        if (state.use_count() > 1)
+            return false;
+    }
+
+    _inputs = defaultInputs;
+    _outputs = defaultOutputs;
+    externalPtr = defaultExternalPtr;
+    _batched_inputs.clear();
+    _preProcData.clear();
+    m_curBatch = -1;
+    for (auto& state : memoryStates) {
+        state->Reset();
+    }
+
+    // the pooled request shouldn't keep the executable network alive
+    setPointerToExecutableNetworkInternal(nullptr);
     --(execNetwork->_numRequests);
+    execNetwork.reset();
+    return true;
+}
+
+void ov::intel_cpu::MKLDNNInferRequestBase::Reuse(const std::shared_ptr<MKLDNNExecNetwork>& execNetwork_) {
+    execNetwork = execNetwork_;
+    ++(execNetwork->_numRequests);
+    setPointerToExecutableNetworkInternal(execNetwork);
 }
 
 void ov::intel_cpu::MKLDNNInferRequestBase::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
@@ -149,6 +202,14 @@ void ov::intel_cpu::MKLDNNInferRequestBase::redefineMemoryForInputNodes() {
 void ov::intel_cpu::MKLDNNInferRequestBase::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, profilingTask);
+    std::shared_ptr<ov::StartupProfile> startupProfile;
+    if (!startupProfileChecked) {
+        startupProfileChecked = true;
+        startupProfile = execNetwork->GetStartupProfile();
+        if (startupProfile && !startupProfile->claim("first_inference"))
+            startupProfile = nullptr;
+    }
+    ov::StartupProfiler startupProfiler(startupProfile, "first_inference");
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
 
@@ -8,6 +8,8 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
+#include <utility>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace ov {
@@ -37,6 +39,23 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief Saves the blobs and the external pointers the request was created with to be restored by Recycle()
+     */
+    void SaveDefaultState();
+
+    /**
+     * @brief Restores the blobs and the states the request was created with and detaches it from the executable network
+     * @return `false` if the blobs or the states are still referenced by the user, so the request can't be reused
+     */
+    bool Recycle();
+
+    /**
+     * @brief Attaches the recycled request to the executable network
+     * @param[in]  execNetwork_ The executable network the request was created by
+     */
+    void Reuse(const std::shared_ptr<MKLDNNExecNetwork>& execNetwork_);
+
 protected:
     MKLDNNInferRequestBase(InferenceEngine::InputsDataMap networkInputs,
                            InferenceEngine::OutputsDataMap networkOutputs,
@@ -66,8 +85,16 @@ private:
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     openvino::itt::handle_t             profilingTask;
+    // each request tries to claim the first inference of the startup profile only once
+    bool                                startupProfileChecked = false;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+
+    InferenceEngine::BlobMap            defaultInputs;
+    InferenceEngine::BlobMap            defaultOutputs;
+    std::unordered_map<std::string, void*> defaultExternalPtr;
+    // the default blobs with their use counts when the request was created
+    std::vector<std::pair<InferenceEngine::Blob::Ptr, long>> defaultBlobs;
 };
 
 class MKLDNNLegacyInferRequest : public MKLDNNInferRequestBase {
@@ -35,6 +35,8 @@ enum impl_desc_type {
     reorder = 1<<22,
     // winograd
     winograd = 1<<23,
+    // sparse weights
+    sparse = 1<<24,
 
     // real types
     ref_any             = ref  | any,
@@ -70,6 +72,9 @@ enum impl_desc_type {
     jit_uni_dw          = jit  | uni    | _dw,
     jit_avx512_amx_dw   = jit  | avx512 | amx | _dw,
 
+    jit_avx512_sparse   = jit  | avx512 | sparse,
+    jit_avx2_sparse     = jit  | avx2   | sparse,
+
     brgconv_avx512      = brgconv  | avx512,
     brgconv_avx2        = brgconv  | avx2,
     brgconv_avx         = brgconv  | avx,
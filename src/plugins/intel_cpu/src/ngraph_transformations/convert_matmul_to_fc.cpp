@@ -8,12 +8,30 @@
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 
 NGRAPH_RTTI_DEFINITION(ov::intel_cpu::ConvertMatMulToFC, "ConvertMatMulToFC", 0);
 
+namespace {
+
+// Compressed weights: Constant -> Convert (not folded) -> [Subtract/Add/Multiply by constants]
+bool isDecompressedWeights(const ngraph::Output<ngraph::Node>& output) {
+    auto node = output.get_node_shared_ptr();
+    while (ov::is_type<ngraph::opset1::Multiply>(node) || ov::is_type<ngraph::opset1::Subtract>(node) ||
+           ov::is_type<ngraph::opset1::Add>(node)) {
+        if (!ov::is_type<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1)))
+            return false;
+        node = node->get_input_node_shared_ptr(0);
+    }
+    return ov::is_type<ngraph::opset1::Convert>(node) && ov::pass::constant_folding_is_disabled(node) &&
+           ov::is_type<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(0));
+}
+
+}  // namespace
+
 ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -44,8 +62,15 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
-            std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
+        const bool decompressed_weights = isDecompressedWeights(fc_input_b);
+        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) && !decompressed_weights) {
+            return false;
+        }
+        // compressed weights are decompressed by the FullyConnected node, so they can't be transposed or reshaped
+        if (decompressed_weights && (!matmul->get_transpose_b() || rank_b != 2)) {
+            return false;
+        }
+        if (std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
         /*
@@ -0,0 +1,162 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_horizontal_fusion.hpp"
+#include "op/fully_connected.hpp"
+#include <algorithm>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset2.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include "transformations/utils/utils.hpp"
+
+NGRAPH_RTTI_DEFINITION(ov::intel_cpu::FullyConnectedHorizontalFusion, "FullyConnectedHorizontalFusion", 0);
+
+namespace {
+
+// Quantized FullyConnected operations are skipped, as their dequantization can't be fused into the node after the split
+bool hasConstantInputs(const std::shared_ptr<ngraph::Node>& fc) {
+    if (!fc->get_input_element_type(0).is_real() || !fc->get_input_element_type(1).is_real())
+        return false;
+    for (size_t i = 1; i < fc->get_input_size(); i++) {
+        if (!ngraph::is_type<ngraph::opset1::Constant>(fc->get_input_node_shared_ptr(i)))
+            return false;
+    }
+    return true;
+}
+
+bool feedsResult(const ngraph::Output<ngraph::Node>& output) {
+    for (const auto& input : output.get_target_inputs()) {
+        if (ngraph::is_type<ngraph::opset1::Result>(input.get_node()))
+            return true;
+    }
+    return false;
+}
+
+// FullyConnected operations can be merged if they differ only by the number of output channels
+bool canBeMerged(const std::shared_ptr<ov::intel_cpu::FullyConnectedNode>& fc1, const std::shared_ptr<ov::intel_cpu::FullyConnectedNode>& fc2) {
+    if (fc1->get_input_size() != fc2->get_input_size() ||
+        fc1->get_output_rank() != fc2->get_output_rank() ||
+        fc1->get_output_element_type(0) != fc2->get_output_element_type(0))
+        return false;
+
+    for (size_t i = 1; i < fc1->get_input_size(); i++) {
+        const auto& shape1 = fc1->get_input_shape(i);
+        const auto& shape2 = fc2->get_input_shape(i);
+        if (fc1->get_input_element_type(i) != fc2->get_input_element_type(i) || shape1.size() != shape2.size() ||
+            !std::equal(shape1.begin() + 1, shape1.end(), shape2.begin() + 1))
+            return false;
+    }
+    return true;
+}
+
+// Activation without attributes applied by the single consumer of the FullyConnected output
+std::shared_ptr<ngraph::Node> getActivation(const std::shared_ptr<ngraph::Node>& fc) {
+    const auto consumers = fc->get_output_target_inputs(0);
+    if (consumers.size() != 1)
+        return nullptr;
+
+    const auto node = consumers.begin()->get_node()->shared_from_this();
+    if (ngraph::is_type<ngraph::opset1::Relu>(node) || ngraph::is_type<ngraph::opset1::Sigmoid>(node) ||
+        ngraph::is_type<ngraph::opset1::Tanh>(node) || ngraph::is_type<ngraph::opset2::Gelu>(node) ||
+        ngraph::is_type<ngraph::opset4::HSwish>(node) || ngraph::is_type<ngraph::opset4::Mish>(node) ||
+        ngraph::is_type<ngraph::opset5::HSigmoid>(node))
+        return node;
+    return nullptr;
+}
+
+}  // namespace
+
+ov::intel_cpu::FullyConnectedHorizontalFusion::FullyConnectedHorizontalFusion() {
+    auto m_fc = ngraph::pattern::wrap_type<ov::intel_cpu::FullyConnectedNode>(ngraph::pattern::has_static_rank());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto fc = std::dynamic_pointer_cast<ov::intel_cpu::FullyConnectedNode>(m.get_match_root());
+        if (!fc || transformation_callback(fc) || !hasConstantInputs(fc))
+            return false;
+
+        const auto input = fc->input_value(0);
+        std::vector<std::shared_ptr<ov::intel_cpu::FullyConnectedNode>> siblings;
+        for (const auto& target : input.get_target_inputs()) {
+            const auto sibling = std::dynamic_pointer_cast<ov::intel_cpu::FullyConnectedNode>(target.get_node()->shared_from_this());
+            if (sibling && target.get_index() == 0 && hasConstantInputs(sibling) && canBeMerged(fc, sibling) &&
+                !transformation_callback(sibling))
+                siblings.push_back(sibling);
+        }
+        if (siblings.size() < 2)
+            return false;
+
+        // keep the order of the siblings stable, the set of target inputs is unordered
+        std::sort(siblings.begin(), siblings.end(), [](const std::shared_ptr<ngraph::Node>& a, const std::shared_ptr<ngraph::Node>& b) {
+            return a->get_instance_id() < b->get_instance_id();
+        });
+
+        std::vector<std::shared_ptr<ngraph::Node>> activations;
+        for (const auto& sibling : siblings) {
+            activations.push_back(getActivation(sibling));
+        }
+        const bool commonActivation = std::all_of(activations.begin(), activations.end(), [&](const std::shared_ptr<ngraph::Node>& act) {
+            return act && act->get_type_info() == activations[0]->get_type_info();
+        });
+
+        // output names are produced from the friendly name of the last node, so network outputs are left as is
+        for (size_t i = 0; i < siblings.size(); i++) {
+            const auto& last = commonActivation ? activations[i] : siblings[i];
+            if (feedsResult(last->output(0)))
+                return false;
+        }
+
+        ngraph::NodeVector new_ops;
+        ngraph::OutputVector fusedInputs{input};
+        for (size_t i = 1; i < fc->get_input_size(); i++) {
+            ngraph::OutputVector parts;
+            for (const auto& sibling : siblings)
+                parts.push_back(sibling->input_value(i));
+            const auto concat = ngraph::op::util::make_try_fold<ngraph::opset1::Concat>(parts, 0);
+            new_ops.push_back(concat);
+            fusedInputs.push_back(concat);
+        }
+
+        std::vector<int64_t> splitLengths;
+        for (const auto& sibling : siblings)
+            splitLengths.push_back(static_cast<int64_t>(sibling->get_input_shape(1)[0]));
+
+        std::shared_ptr<ngraph::Node> fused = fusedInputs.size() == 3 ?
+            std::make_shared<ov::intel_cpu::FullyConnectedNode>(fusedInputs[0], fusedInputs[1], fusedInputs[2],
+                                                                fc->get_output_rank(), fc->get_output_type()) :
+            std::make_shared<ov::intel_cpu::FullyConnectedNode>(fusedInputs[0], fusedInputs[1],
+                                                                fc->get_output_rank(), fc->get_output_type());
+        fused->set_friendly_name(siblings[0]->get_friendly_name() + "/horizontal_fused");
+        new_ops.push_back(fused);
+
+        if (commonActivation) {
+            fused = activations[0]->clone_with_new_inputs({fused});
+            fused->set_friendly_name(activations[0]->get_friendly_name() + "/horizontal_fused");
+            new_ops.push_back(fused);
+        }
+
+        const auto axis = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, {fc->get_output_rank().get_length() - 1});
+        const auto lengths = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{splitLengths.size()}, splitLengths);
+        const auto split = std::make_shared<ngraph::opset1::VariadicSplit>(fused, axis, lengths);
+        split->set_friendly_name(fused->get_friendly_name() + "/split");
+        new_ops.push_back(split);
+
+        ngraph::NodeVector replaced;
+        for (size_t i = 0; i < siblings.size(); i++) {
+            const auto& last = commonActivation ? activations[i] : siblings[i];
+            last->output(0).replace(split->output(i));
+            replaced.push_back(siblings[i]);
+            if (commonActivation)
+                replaced.push_back(activations[i]);
+        }
+        ngraph::copy_runtime_info(replaced, new_ops);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_fc, "FullyConnectedHorizontalFusion");
+    this->register_matcher(m, callback);
+}
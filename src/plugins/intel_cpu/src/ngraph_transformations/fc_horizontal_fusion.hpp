@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     FullyConnectedHorizontalFusion merges sibling FullyConnected operations reading the same input
+ *     (e.g. Q, K, V projections of the attention) into a single FullyConnected with the concatenated
+ *     weights and biases followed by VariadicSplit over the output channels. An activation applied to
+ *     every sibling is moved before the split, so it can still be fused into the FullyConnected node;
+ *     other consumers are connected to the corresponding parts of the split.
+ */
+
+class FullyConnectedHorizontalFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FullyConnectedHorizontalFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
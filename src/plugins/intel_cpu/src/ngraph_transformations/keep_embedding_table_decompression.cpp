@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "keep_embedding_table_decompression.hpp"
+
+#include <algorithm>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+NGRAPH_RTTI_DEFINITION(ov::intel_cpu::KeepEmbeddingTableDecompression, "KeepEmbeddingTableDecompression", 0);
+
+ov::intel_cpu::KeepEmbeddingTableDecompression::KeepEmbeddingTableDecompression() {
+    auto table = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(
+            ngraph::pattern::type_matches_any({ngraph::element::u8, ngraph::element::i8}));
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({table}, ngraph::pattern::consumers_count(1));
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto convertNode = pattern_map.at(convert).get_node_shared_ptr();
+        const auto& tableShape = pattern_map.at(table).get_shape();
+        if (tableShape.empty() || convertNode->get_output_element_type(0) != ngraph::element::f32)
+            return false;
+
+        // only per tensor or per row constants can be applied by the embedding node
+        auto isRowWiseConstant = [&tableShape](const ngraph::Output<ngraph::Node>& output) {
+            const auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+            if (!constant)
+                return false;
+            const auto& shape = constant->get_shape();
+            if (ngraph::shape_size(shape) == 1)
+                return true;
+            if (shape.size() != tableShape.size() || shape[0] != tableShape[0])
+                return false;
+            return std::all_of(shape.begin() + 1, shape.end(), [](size_t dim) { return dim == 1; });
+        };
+
+        ngraph::Node* node = convertNode.get();
+        bool withMultiply = false;
+        while (true) {
+            const auto consumers = node->output(0).get_target_inputs();
+            if (consumers.size() != 1)
+                return false;
+
+            const auto consumer = *consumers.begin();
+            const auto child = consumer.get_node();
+            if (ov::is_type<ngraph::opset3::EmbeddingBagOffsetsSum>(child) ||
+                ov::is_type<ngraph::opset3::EmbeddingBagPackedSum>(child) ||
+                ov::is_type<ngraph::opset3::EmbeddingSegmentsSum>(child)) {
+                if (consumer.get_index() != 0 || !withMultiply)
+                    return false;
+                break;
+            }
+
+            if (!ov::is_type<ngraph::opset1::Multiply>(child) && !ov::is_type<ngraph::opset1::Subtract>(child) &&
+                !ov::is_type<ngraph::opset1::Add>(child))
+                return false;
+            if (consumer.get_index() != 0 || !isRowWiseConstant(child->input_value(1)))
+                return false;
+
+            withMultiply = withMultiply || ov::is_type<ngraph::opset1::Multiply>(child);
+            node = child;
+        }
+
+        ov::disable_constant_folding(convertNode);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(convert, "KeepEmbeddingTableDecompression");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     Disables constant folding of the decompression subgraph of the row-wise quantized embedding table,
+ *     so the table is kept in U8/I8 precision and the dequantization is performed by the embedding node.
+ *
+ *     Constant[U8/I8]
+ *            |
+ *     Convert[FP32]   (constant folding is disabled)
+ *            |
+ *     Subtract/Add    (optional, per row or per tensor constant)
+ *            |
+ *       Multiply      (per row or per tensor constant)
+ *            |
+ *   EmbeddingBagOffsetsSum / EmbeddingBagPackedSum / EmbeddingSegmentsSum
+ */
+
+class KeepEmbeddingTableDecompression: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    KeepEmbeddingTableDecompression();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
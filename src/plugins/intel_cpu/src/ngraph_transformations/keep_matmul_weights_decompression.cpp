@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "keep_matmul_weights_decompression.hpp"
+
+#include <algorithm>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+#include <transformations/rt_info/keep_const_precision.hpp>
+#include <transformations/utils/utils.hpp>
+
+NGRAPH_RTTI_DEFINITION(ov::intel_cpu::KeepMatMulWeightsDecompression, "KeepMatMulWeightsDecompression", 0);
+
+constexpr size_t ov::intel_cpu::KeepMatMulWeightsDecompression::defaultMaxRows;
+
+ov::intel_cpu::KeepMatMulWeightsDecompression::KeepMatMulWeightsDecompression(size_t maxRows) {
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(
+            ngraph::pattern::type_matches_any({ngraph::element::f16, ngraph::element::u8, ngraph::element::i8}));
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({weights}, ngraph::pattern::consumers_count(1));
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto convertNode = pattern_map.at(convert).get_node_shared_ptr();
+        auto weightsNode = std::dynamic_pointer_cast<ngraph::opset1::Constant>(pattern_map.at(weights).get_node_shared_ptr());
+        const auto& weightsShape = weightsNode->get_shape();
+        if (weightsShape.size() != 2 || convertNode->get_output_element_type(0) != ngraph::element::f32 ||
+            transformation_callback(convertNode))
+            return false;
+
+        std::vector<std::shared_ptr<ngraph::Node>> decompression;
+        std::shared_ptr<ngraph::opset1::MatMul> matmul;
+        ngraph::Node* node = convertNode.get();
+        while (!matmul) {
+            const auto consumers = node->output(0).get_target_inputs();
+            if (consumers.size() != 1)
+                return false;
+
+            const auto consumer = *consumers.begin();
+            const auto child = consumer.get_node()->shared_from_this();
+            if (ov::is_type<ngraph::opset1::MatMul>(child)) {
+                if (consumer.get_index() != 1)
+                    return false;
+                matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(child);
+            } else if (ov::is_type<ngraph::opset1::Multiply>(child) || ov::is_type<ngraph::opset1::Subtract>(child) ||
+                       ov::is_type<ngraph::opset1::Add>(child)) {
+                if (consumer.get_index() != 0 || !ov::is_type<ngraph::opset1::Constant>(child->get_input_node_shared_ptr(1)))
+                    return false;
+                decompression.push_back(child);
+                node = child.get();
+            } else {
+                return false;
+            }
+        }
+
+        const bool withMultiply = std::any_of(decompression.begin(), decompression.end(), [](const std::shared_ptr<ngraph::Node>& node) {
+            return ov::is_type<ngraph::opset1::Multiply>(node);
+        });
+        if (weightsNode->get_element_type() != ngraph::element::f16 && !withMultiply)
+            return false;
+
+        // the FullyConnected node supports 2D and 3D activations
+        const auto dataRank = matmul->get_input_partial_shape(0).rank();
+        if (matmul->get_transpose_a() || dataRank.is_dynamic() || dataRank.get_length() < 2 || dataRank.get_length() > 3)
+            return false;
+
+        // the rows number must be bounded even for the dynamic shapes, otherwise the folded weights are used
+        const auto& dataShape = matmul->get_input_partial_shape(0);
+        size_t rows = 1;
+        for (int64_t i = 0; i < dataRank.get_length() - 1; i++) {
+            const auto maxLength = dataShape[i].get_max_length();
+            if (maxLength < 0 || static_cast<size_t>(maxLength) > maxRows)
+                return false;
+            rows *= static_cast<size_t>(maxLength);
+        }
+        if (rows > maxRows)
+            return false;
+
+        // only per tensor or per output channel constants can be applied by the FullyConnected node
+        const size_t channelAxis = matmul->get_transpose_b() ? 0 : 1;
+        const size_t channels = weightsShape[channelAxis];
+        auto isPerChannelConstant = [&](const std::shared_ptr<ngraph::Node>& node) {
+            const auto& shape = node->get_input_shape(1);
+            if (ngraph::shape_size(shape) == 1)
+                return true;
+            if (ngraph::shape_size(shape) != channels || shape.size() > 2)
+                return false;
+            return shape.size() == 2 ? shape[channelAxis] == channels : channelAxis == 1;
+        };
+        if (!std::all_of(decompression.begin(), decompression.end(), isPerChannelConstant))
+            return false;
+
+        if (!matmul->get_transpose_b()) {
+            ngraph::NodeVector newOps;
+            const auto order = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 0});
+            const auto transposedWeights = ngraph::op::util::make_try_fold<ngraph::opset1::Transpose>(weightsNode, order);
+            weightsNode = std::dynamic_pointer_cast<ngraph::opset1::Constant>(transposedWeights);
+            if (!weightsNode)
+                return false;
+
+            convertNode = convertNode->clone_with_new_inputs({weightsNode});
+            newOps.push_back(convertNode);
+            std::shared_ptr<ngraph::Node> last = convertNode;
+            const auto channelShape = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2},
+                                                                       {static_cast<int64_t>(channels), int64_t{1}});
+            for (const auto& eltwise : decompression) {
+                auto constant = eltwise->input_value(1);
+                if (ngraph::shape_size(constant.get_shape()) != 1)
+                    constant = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(constant, channelShape, false);
+                last = eltwise->clone_with_new_inputs({last, constant});
+                newOps.push_back(last);
+            }
+
+            const auto newMatMul = std::make_shared<ngraph::opset1::MatMul>(matmul->input_value(0), last, false, true);
+            newMatMul->set_friendly_name(matmul->get_friendly_name());
+            newOps.push_back(newMatMul);
+            decompression.push_back(matmul);
+            ngraph::copy_runtime_info(decompression, newOps);
+            ngraph::replace_node(matmul, newMatMul);
+        }
+
+        ov::disable_constant_folding(convertNode);
+        if (weightsNode->get_element_type() == ngraph::element::f16)
+            ov::enable_keep_const_precision(weightsNode);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(convert, "KeepMatMulWeightsDecompression");
+    this->register_matcher(m, callback);
+}
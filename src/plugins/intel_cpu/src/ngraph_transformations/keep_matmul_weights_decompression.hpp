@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     Disables constant folding of the decompression subgraph of the compressed MatMul weights,
+ *     so the weights are kept in FP16/U8/I8 precision and decompressed by the FullyConnected node.
+ *     Weights in [K, N] layout are transposed to [N, K] (transpose_b = true), so the decompression
+ *     constants are applied per output channel (row) of the weights.
+ *     The FullyConnected node decompresses the weights for each row of the activations, so the pass is applied
+ *     only if the number of the activations rows (all the dimensions but the last one) is at most maxRows.
+ *     The larger MatMuls are executed by oneDNN over the folded FP32 weights.
+ *
+ *     Constant[FP16/U8/I8]  (precision is kept by ConvertPrecision)
+ *            |
+ *     Convert[FP32]         (constant folding is disabled)
+ *            |
+ *     Subtract/Add          (optional, per output channel or per tensor constant)
+ *            |
+ *       Multiply            (optional for FP16, per output channel or per tensor constant)
+ *            |
+ *     MatMul[weights]
+ */
+
+class KeepMatMulWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    // the decompression kernel is a matrix-vector product, so it is used for the decode-like (small batch) shapes only
+    static constexpr size_t defaultMaxRows = 16;
+
+    explicit KeepMatMulWeightsDecompression(size_t maxRows = defaultMaxRows);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_attn.hpp"
+
+#include <algorithm>
+
+ov::intel_cpu::ScaledAttnNode::ScaledAttnNode(const ngraph::OutputVector& args,
+                                              float scale,
+                                              const std::vector<size_t>& q_order,
+                                              const std::vector<size_t>& k_order,
+                                              const std::vector<size_t>& v_order,
+                                              const std::vector<size_t>& out_order,
+                                              const ngraph::element::Type output_type)
+    : Op(args), m_scale(scale), m_q_order(q_order), m_k_order(k_order), m_v_order(v_order),
+      m_out_order(out_order), m_output_type(output_type) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::ScaledAttnNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::ScaledAttnNode>(new_args, m_scale, m_q_order, m_k_order, m_v_order, m_out_order, m_output_type);
+}
+
+void ov::intel_cpu::ScaledAttnNode::validate_and_infer_types() {
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        input_size == 3 || input_size == 4,
+        "Number of inputs is incorrect. Current value is: ",
+        input_size,
+        ", expected: 3 or 4.");
+
+    const auto is_order = [](const std::vector<size_t>& order) {
+        std::vector<size_t> sorted(order);
+        std::sort(sorted.begin(), sorted.end());
+        return sorted == std::vector<size_t>{0, 1, 2, 3};
+    };
+    NODE_VALIDATION_CHECK(this,
+        is_order(m_q_order) && is_order(m_k_order) && is_order(m_v_order) && is_order(m_out_order),
+        "Transpose orders must be permutations of 4 dimensions.");
+
+    const auto transpose = [](const ngraph::PartialShape& shape, const std::vector<size_t>& order) {
+        ngraph::PartialShape result;
+        for (auto axis : order)
+            result.push_back(shape[axis]);
+        return result;
+    };
+
+    const auto q_pshape = get_input_partial_shape(0);
+    const auto k_pshape = get_input_partial_shape(1);
+    const auto v_pshape = get_input_partial_shape(2);
+    ngraph::PartialShape output_pshape;
+    if (q_pshape.rank().is_static() && k_pshape.rank().is_static() && v_pshape.rank().is_static()) {
+        NODE_VALIDATION_CHECK(this,
+            q_pshape.size() == 4 && k_pshape.size() == 4 && v_pshape.size() == 4,
+            "Query, key and value inputs must be 4D tensors.");
+
+        const auto q = transpose(q_pshape, m_q_order);
+        const auto k = transpose(k_pshape, m_k_order);
+        const auto v = transpose(v_pshape, m_v_order);
+        // batch dimensions [B, H] are broadcasted like in MatMul
+        ngraph::PartialShape batch{q[0], q[1]};
+        NODE_VALIDATION_CHECK(this,
+            q[3].compatible(k[3]) && k[2].compatible(v[2]) &&
+            ngraph::PartialShape::broadcast_merge_into(batch, {k[0], k[1]}, ngraph::op::AutoBroadcastType::NUMPY) &&
+            ngraph::PartialShape::broadcast_merge_into(batch, {v[0], v[1]}, ngraph::op::AutoBroadcastType::NUMPY),
+            "Query, key and value inputs have incompatible shapes: ", q, ", ", k, ", ", v);
+
+        // [B, H, Lq, Dv]
+        const ngraph::PartialShape logical_pshape{batch[0], batch[1], q[2], v[3]};
+        output_pshape = transpose(logical_pshape, m_out_order);
+    } else {
+        output_pshape = ngraph::PartialShape::dynamic(4);
+    }
+
+    auto output_type = m_output_type == ngraph::element::undefined ? get_input_element_type(0) : m_output_type;
+    set_output_type(0, output_type, output_pshape);
+}
+
+bool ov::intel_cpu::ScaledAttnNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("q_order", m_q_order);
+    visitor.on_attribute("k_order", m_k_order);
+    visitor.on_attribute("v_order", m_v_order);
+    visitor.on_attribute("out_order", m_out_order);
+    visitor.on_attribute("out-type", m_output_type);
+    return true;
+}
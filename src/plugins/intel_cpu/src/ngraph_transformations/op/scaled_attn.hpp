@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Computes softmax(scale * Q * K^T + mask) * V over the last two dimensions of the 4D inputs.
+ * Q, K and V are read as [B, H, L, D] tensors through the transpose orders of the corresponding inputs,
+ * the result [B, H, Lq, Dv] is written through the transpose order of the output.
+ * The mask input is optional and has to be broadcastable to [B, H, Lq, Lk].
+ */
+class ScaledAttnNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ScaledDotProductAttention", "cpu_plugin_opset");
+
+    ScaledAttnNode() = default;
+
+    ScaledAttnNode(const ngraph::OutputVector& args,
+                   float scale,
+                   const std::vector<size_t>& q_order,
+                   const std::vector<size_t>& k_order,
+                   const std::vector<size_t>& v_order,
+                   const std::vector<size_t>& out_order,
+                   const ngraph::element::Type output_type = ngraph::element::undefined);
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    const std::vector<size_t>& get_q_order() const { return m_q_order; }
+    const std::vector<size_t>& get_k_order() const { return m_k_order; }
+    const std::vector<size_t>& get_v_order() const { return m_v_order; }
+    const std::vector<size_t>& get_out_order() const { return m_out_order; }
+    ngraph::element::Type get_output_type() const { return m_output_type; }
+
+private:
+    float m_scale = 1.f;
+    std::vector<size_t> m_q_order;
+    std::vector<size_t> m_k_order;
+    std::vector<size_t> m_v_order;
+    std::vector<size_t> m_out_order;
+    ngraph::element::Type m_output_type;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
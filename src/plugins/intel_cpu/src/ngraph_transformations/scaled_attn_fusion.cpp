@@ -0,0 +1,180 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_attn_fusion.hpp"
+#include "op/scaled_attn.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(ov::intel_cpu::ScaledAttnFusion, "ScaledAttnFusion", 0);
+
+namespace {
+
+bool isSingleConsumer(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+bool isScalarConstant(const ngraph::Output<ngraph::Node>& output, float& value) {
+    const auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+// Follows the chain of multiplications and divisions by scalars up to the MatMul node
+std::shared_ptr<ngraph::opset1::MatMul> getScaledMatMul(ngraph::Output<ngraph::Node> output, float& scale, ngraph::NodeVector& nodes) {
+    while (isSingleConsumer(output)) {
+        const auto node = output.get_node_shared_ptr();
+        float value = 0.f;
+        if (const auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(node)) {
+            return matmul;
+        } else if (ngraph::is_type<ngraph::opset1::Multiply>(node)) {
+            if (isScalarConstant(node->input_value(1), value)) {
+                output = node->input_value(0);
+            } else if (isScalarConstant(node->input_value(0), value)) {
+                output = node->input_value(1);
+            } else {
+                return nullptr;
+            }
+            scale *= value;
+        } else if (ngraph::is_type<ngraph::opset1::Divide>(node)) {
+            if (!isScalarConstant(node->input_value(1), value) || value == 0.f)
+                return nullptr;
+            output = node->input_value(0);
+            scale /= value;
+        } else {
+            return nullptr;
+        }
+        nodes.push_back(node);
+    }
+    return nullptr;
+}
+
+// Absorbs the Transpose producing the MatMul input: the returned order maps [B, H, L, D] dimensions to the source ones
+ngraph::Output<ngraph::Node> getSourceWithOrder(const ngraph::Output<ngraph::Node>& input, bool transposed,
+                                                std::vector<size_t>& order, ngraph::NodeVector& nodes) {
+    order = transposed ? std::vector<size_t>{0, 1, 3, 2} : std::vector<size_t>{0, 1, 2, 3};
+
+    const auto transpose = std::dynamic_pointer_cast<ngraph::opset1::Transpose>(input.get_node_shared_ptr());
+    if (!transpose || !isSingleConsumer(input))
+        return input;
+
+    const auto transpose_order = std::dynamic_pointer_cast<ngraph::opset1::Constant>(transpose->get_input_node_shared_ptr(1));
+    if (!transpose_order || ngraph::shape_size(transpose_order->get_shape()) != 4)
+        return input;
+
+    const auto source_order = transpose_order->cast_vector<size_t>();
+    for (auto& axis : order)
+        axis = source_order[axis];
+    nodes.push_back(transpose);
+    return transpose->input_value(0);
+}
+
+bool isSupportedPrecision(const ngraph::element::Type& type) {
+    return type == ngraph::element::f32 || type == ngraph::element::bf16 ||
+           type == ngraph::element::i8 || type == ngraph::element::u8;
+}
+
+bool isSoftmaxOverLastAxis(const std::shared_ptr<ngraph::Node>& node) {
+    if (const auto softmax = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(node))
+        return softmax->get_axis() == 3;
+    if (const auto softmax = std::dynamic_pointer_cast<ngraph::opset8::Softmax>(node))
+        return softmax->get_axis() == 3 || softmax->get_axis() == -1;
+    return false;
+}
+
+}  // namespace
+
+ov::intel_cpu::ScaledAttnFusion::ScaledAttnFusion() {
+    auto softmax_m = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>(ngraph::pattern::consumers_count(1));
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({softmax_m, ngraph::pattern::any_input()},
+                                                                       ngraph::pattern::rank_equals(4));
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        const auto softmax = pattern_to_output.at(softmax_m).get_node_shared_ptr();
+        const auto matmul_v = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output.at(matmul_m).get_node_shared_ptr());
+        if (!matmul_v || matmul_v->get_transpose_a() || !isSoftmaxOverLastAxis(softmax) || transformation_callback(matmul_v))
+            return false;
+
+        ngraph::NodeVector nodes{matmul_v, softmax};
+        float scale = 1.f;
+        std::shared_ptr<ngraph::opset1::MatMul> matmul_qk;
+        ngraph::Output<ngraph::Node> mask;
+
+        const auto softmax_input = softmax->input_value(0);
+        const auto add = std::dynamic_pointer_cast<ngraph::opset1::Add>(softmax_input.get_node_shared_ptr());
+        if (add && isSingleConsumer(softmax_input) && add->get_autob() == ngraph::op::AutoBroadcastType::NUMPY) {
+            nodes.push_back(add);
+            for (size_t i = 0; i < 2 && !matmul_qk; i++) {
+                ngraph::NodeVector scale_nodes;
+                scale = 1.f;
+                matmul_qk = getScaledMatMul(add->input_value(i), scale, scale_nodes);
+                if (matmul_qk) {
+                    mask = add->input_value(1 - i);
+                    nodes.insert(nodes.end(), scale_nodes.begin(), scale_nodes.end());
+                }
+            }
+            if (!matmul_qk)
+                return false;
+
+            // the mask must not change the shape of the scores
+            const auto& mask_pshape = mask.get_partial_shape();
+            if (mask_pshape.rank().is_dynamic() || mask_pshape.size() > 4 ||
+                !add->get_output_partial_shape(0).same_scheme(matmul_qk->get_output_partial_shape(0)) ||
+                !isSupportedPrecision(mask.get_element_type()))
+                return false;
+        } else {
+            matmul_qk = getScaledMatMul(softmax_input, scale, nodes);
+            if (!matmul_qk)
+                return false;
+        }
+        nodes.push_back(matmul_qk);
+
+        if (matmul_qk->get_output_partial_shape(0).rank() != 4 || matmul_qk->get_input_partial_shape(0).rank() != 4 ||
+            matmul_qk->get_input_partial_shape(1).rank() != 4 || matmul_v->get_input_partial_shape(1).rank() != 4)
+            return false;
+
+        std::vector<size_t> q_order, k_order, v_order;
+        // K is transposed in the attention, so the non-transposed MatMul input has [B, H, D, L] layout
+        const auto q = getSourceWithOrder(matmul_qk->input_value(0), matmul_qk->get_transpose_a(), q_order, nodes);
+        const auto k = getSourceWithOrder(matmul_qk->input_value(1), !matmul_qk->get_transpose_b(), k_order, nodes);
+        const auto v = getSourceWithOrder(matmul_v->input_value(1), matmul_v->get_transpose_b(), v_order, nodes);
+        if (!isSupportedPrecision(q.get_element_type()) || !isSupportedPrecision(k.get_element_type()) ||
+            !isSupportedPrecision(v.get_element_type()))
+            return false;
+
+        std::shared_ptr<ngraph::Node> last_node = matmul_v;
+        std::vector<size_t> out_order{0, 1, 2, 3};
+        const auto consumers = matmul_v->get_output_target_inputs(0);
+        if (consumers.size() == 1) {
+            const auto transpose = std::dynamic_pointer_cast<ngraph::opset1::Transpose>(consumers.begin()->get_node()->shared_from_this());
+            const auto transpose_order = transpose ?
+                std::dynamic_pointer_cast<ngraph::opset1::Constant>(transpose->get_input_node_shared_ptr(1)) : nullptr;
+            if (transpose_order && ngraph::shape_size(transpose_order->get_shape()) == 4) {
+                out_order = transpose_order->cast_vector<size_t>();
+                last_node = transpose;
+                nodes.push_back(transpose);
+            }
+        }
+
+        ngraph::OutputVector inputs{q, k, v};
+        if (mask.get_node())
+            inputs.push_back(mask);
+
+        const auto attn = std::make_shared<ov::intel_cpu::ScaledAttnNode>(inputs, scale, q_order, k_order, v_order, out_order,
+                                                                          last_node->get_output_element_type(0));
+        attn->set_friendly_name(last_node->get_friendly_name());
+        ngraph::copy_runtime_info(nodes, attn);
+        ngraph::replace_node(last_node, attn);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, "ScaledAttnFusion");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     ScaledAttnFusion replaces the attention subgraph
+ *         MatMul(Q, K) -> [Multiply/Divide by scalar]... -> [Add(mask)] -> Softmax -> MatMul(., V)
+ *     with the single ScaledDotProductAttention operation. Transposes on the Q, K, V inputs and on the
+ *     output are absorbed into the operation, so the data is read and written in the original layouts.
+ */
+
+class ScaledAttnFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ScaledAttnFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
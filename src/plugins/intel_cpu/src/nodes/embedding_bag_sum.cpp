@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cassert>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -10,9 +11,218 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace ov::intel_cpu;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_embedding_bag, field)
+
+struct jit_args_embedding_bag {
+    const uint8_t* const* rows;  // pointers to the table rows of the bag, padded with prefetch_distance entries
+    const float* coeffs;         // per row multipliers (per sample weight and decompression scale)
+    const float* bias;           // sum of the per row shifts
+    float* dst;
+    size_t rows_num;
+    size_t work_amount;
+};
+
+struct jit_embedding_bag_config_params {
+    Precision src_dt;
+};
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_uni_embedding_bag_kernel {
+    // Number of rows the kernel runs ahead of the accumulated one to prefetch the table data
+    static constexpr size_t prefetch_distance = 8;
+
+    void (*ker_)(const jit_args_embedding_bag *);
+
+    void operator()(const jit_args_embedding_bag *args) { assert(ker_); ker_(args); }
+
+    jit_uni_embedding_bag_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_embedding_bag_kernel() {}
+
+    virtual void create_ker() = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
+
+template <cpu_isa_t isa>
+struct jit_uni_embedding_bag_kernel_f32 : public jit_uni_embedding_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_embedding_bag_kernel_f32)
+
+    jit_uni_embedding_bag_kernel_f32(jit_embedding_bag_config_params jcp) : jit_uni_embedding_bag_kernel(), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_rows, ptr[reg_params + GET_OFF(rows)]);
+        mov(reg_coeffs, ptr[reg_params + GET_OFF(coeffs)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_rows_num, ptr[reg_params + GET_OFF(rows_num)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_tmp_64, ptr[reg_params + GET_OFF(bias)]);
+        uni_vbroadcastss(vmm_bias, ptr[reg_tmp_64]);
+
+        xor_(reg_src_off, reg_src_off);
+
+        accumulate_loop(unroll);
+        accumulate_loop(1);
+        accumulate_loop(1, true);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int simd_w = vlen / sizeof(float);
+    static constexpr int unroll = 4;
+
+    Xbyak::Reg64 reg_rows = r8;
+    Xbyak::Reg64 reg_coeffs = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_rows_num = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_src_off = r13;
+    Xbyak::Reg64 reg_row_idx = r14;
+    Xbyak::Reg64 reg_row = r15;
+    Xbyak::Reg64 reg_prefetch = rax;
+    Xbyak::Reg64 reg_tmp_64 = rbx;
+    Xbyak::Reg32 reg_tmp_32 = ebx;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_bias = Vmm(0);
+    Vmm vmm_coeff = Vmm(1);
+    Vmm vmm_src = Vmm(2);
+    Vmm get_acc(int i) { return Vmm(3 + i); }
+
+    jit_embedding_bag_config_params jcp_;
+
+    // Accumulates blocks of 'vecs' vectors (or single elements if 'scalar') of all the rows of the bag,
+    // iterating over the rows in the innermost loop so that the partial sums stay in registers.
+    void accumulate_loop(int vecs, bool scalar = false) {
+        const int step = scalar ? 1 : vecs * simd_w;
+        const int src_step = step * static_cast<int>(jcp_.src_dt.size());
+
+        Xbyak::Label block_loop_label;
+        Xbyak::Label block_loop_end_label;
+        Xbyak::Label row_loop_label;
+        Xbyak::Label row_loop_end_label;
+
+        L(block_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(block_loop_end_label, T_NEAR);
+
+            for (int i = 0; i < vecs; i++)
+                uni_vmovups(get_acc(i), vmm_bias);
+
+            xor_(reg_row_idx, reg_row_idx);
+            L(row_loop_label);
+            {
+                cmp(reg_row_idx, reg_rows_num);
+                jge(row_loop_end_label, T_NEAR);
+
+                if (!scalar) {
+                    mov(reg_prefetch, ptr[reg_rows + reg_row_idx * sizeof(void*) + prefetch_distance * sizeof(void*)]);
+                    add(reg_prefetch, reg_src_off);
+                    for (int off = 0; off < src_step; off += 64)
+                        prefetcht0(ptr[reg_prefetch + off]);
+                }
+
+                mov(reg_row, ptr[reg_rows + reg_row_idx * sizeof(void*)]);
+                add(reg_row, reg_src_off);
+                uni_vbroadcastss(vmm_coeff, ptr[reg_coeffs + reg_row_idx * sizeof(float)]);
+
+                for (int i = 0; i < vecs; i++) {
+                    if (scalar)
+                        load_scalar(Xbyak::Xmm(vmm_src.getIdx()), ptr[reg_row]);
+                    else
+                        load_vector(vmm_src, ptr[reg_row + i * simd_w * jcp_.src_dt.size()]);
+                    uni_vfmadd231ps(get_acc(i), vmm_src, vmm_coeff);
+                }
+
+                add(reg_row_idx, 1);
+                jmp(row_loop_label, T_NEAR);
+            }
+            L(row_loop_end_label);
+
+            for (int i = 0; i < vecs; i++) {
+                if (scalar)
+                    uni_vmovss(ptr[reg_dst], Xbyak::Xmm(get_acc(i).getIdx()));
+                else
+                    uni_vmovups(ptr[reg_dst + i * vlen], get_acc(i));
+            }
+
+            add(reg_dst, step * sizeof(float));
+            add(reg_src_off, src_step);
+            sub(reg_work_amount, step);
+
+            jmp(block_loop_label, T_NEAR);
+        }
+        L(block_loop_end_label);
+    }
+
+    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op) {
+        switch (jcp_.src_dt) {
+            case Precision::FP32:
+                uni_vmovups(vmm_src, op);
+                break;
+            case Precision::BF16:
+                vpmovzxwd(vmm_src, op);
+                uni_vpslld(vmm_src, vmm_src, 16);
+                break;
+            case Precision::I8:
+                uni_vpmovsxbd(vmm_src, op);
+                uni_vcvtdq2ps(vmm_src, vmm_src);
+                break;
+            case Precision::U8:
+                uni_vpmovzxbd(vmm_src, op);
+                uni_vcvtdq2ps(vmm_src, vmm_src);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+    }
+
+    inline void load_scalar(Xbyak::Xmm xmm_src, const Xbyak::Address &op) {
+        switch (jcp_.src_dt) {
+            case Precision::FP32:
+                uni_vmovss(xmm_src, op);
+                break;
+            case Precision::BF16:
+                uni_vpinsrw(xmm_src, xmm_src, op, 0);
+                uni_vpslld(xmm_src, xmm_src, 16);
+                break;
+            case Precision::I8:
+                movsx(reg_tmp_32, op);
+                uni_vmovq(xmm_src, reg_tmp_64);
+                uni_vcvtdq2ps(xmm_src, xmm_src);
+                break;
+            case Precision::U8:
+                movzx(reg_tmp_32, op);
+                uni_vmovq(xmm_src, reg_tmp_64);
+                uni_vcvtdq2ps(xmm_src, xmm_src);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+    }
+};
 
 MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
             const std::shared_ptr<ngraph::Node>& op,
@@ -36,11 +246,61 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
-void MKLDNNEmbeddingBagSumNode::prepareParams(const VectorDims& indexStaticShape) {
+void MKLDNNEmbeddingBagSumNode::fuseDecompression(std::vector<float> scales, std::vector<float> shifts) {
+    if (scales.empty() || scales.size() != shifts.size())
+        IE_THROW() << "Node EmbeddingBagSum with name '" << _layerName << "' has inconsistent decompression parameters.";
+
+    _decompressionScales = std::move(scales);
+    _decompressionShifts = std::move(shifts);
+}
+
+Precision MKLDNNEmbeddingBagSumNode::getTablePrecision(const Precision& originalPrc) const {
+    // BF16 tables are accumulated in FP32 by the JIT kernel without being converted as a whole
+    if (originalPrc == Precision::BF16 && !mayiuse(avx512_core))
+        return Precision::FP32;
+    return originalPrc;
+}
+
+Precision MKLDNNEmbeddingBagSumNode::getOutputPrecision(const Precision& tablePrc) const {
+    if (tablePrc == Precision::BF16 || withDecompression())
+        return Precision::FP32;
+    return tablePrc;
+}
+
+impl_desc_type MKLDNNEmbeddingBagSumNode::getImplType(const Precision& tablePrc) const {
+    if (getOutputPrecision(tablePrc) != Precision::FP32)
+        return impl_desc_type::ref_any;
+
+    if (mayiuse(avx512_common)) {
+        return impl_desc_type::jit_avx512;
+    } else if (mayiuse(avx2)) {
+        return impl_desc_type::jit_avx2;
+    } else if (mayiuse(sse41)) {
+        return impl_desc_type::jit_sse42;
+    }
+    return impl_desc_type::ref_any;
+}
+
+void MKLDNNEmbeddingBagSumNode::prepareParams(const VectorDims& indexStaticShape, const Precision& tablePrc) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    if (_kernel || getOutputPrecision(tablePrc) != Precision::FP32)
+        return;
+
+    jit_embedding_bag_config_params jcp;
+    jcp.src_dt = tablePrc;
+    if (mayiuse(avx512_common)) {
+        _kernel.reset(new jit_uni_embedding_bag_kernel_f32<avx512_common>(jcp));
+    } else if (mayiuse(avx2)) {
+        _kernel.reset(new jit_uni_embedding_bag_kernel_f32<avx2>(jcp));
+    } else if (mayiuse(sse41)) {
+        _kernel.reset(new jit_uni_embedding_bag_kernel_f32<sse41>(jcp));
+    }
+    if (_kernel)
+        _kernel->create_ker();
 }
 
 template<typename T>
@@ -115,8 +375,77 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
     parallel_nt(0, threadBody);
 }
 
+void MKLDNNEmbeddingBagSumNode::processDataJit(const uint8_t* srcData, const float* weightsData, float* dstData, const InferenceEngine::Precision &srcPrc,
+                                               const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outDataDims[0];
+    const size_t rowSize = _embDepth * srcPrc.size();
+    const bool perRowDecompression = _decompressionScales.size() > 1lu;
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        std::vector<const uint8_t*> rows;
+        std::vector<float> coeffs;
+
+        for (size_t obi = start; obi < end; obi++) {
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            withWeights = withWeights & _withWeights;
+            if (indices == nullptr)
+                indicesSize = 0lu;
+
+            rows.resize(indicesSize);
+            coeffs.resize(indicesSize);
+            float bias = 0.f;
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (indices[inIdx] >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+                rows[inIdx] = srcData + indices[inIdx] * rowSize;
+
+                const float weight = withWeights ? weightsData[weightsIdx++] : 1.f;
+                if (withDecompression()) {
+                    const size_t decIdx = perRowDecompression ? indices[inIdx] : 0lu;
+                    coeffs[inIdx] = weight * _decompressionScales[decIdx];
+                    bias += weight * _decompressionShifts[decIdx];
+                } else {
+                    coeffs[inIdx] = weight;
+                }
+            }
+            // the kernel prefetches the rows ahead of the accumulated one, so the tail entries have to be valid
+            rows.insert(rows.end(), jit_uni_embedding_bag_kernel::prefetch_distance, rows.empty() ? srcData : rows.back());
+
+            auto arg = jit_args_embedding_bag();
+            arg.rows = rows.data();
+            arg.coeffs = coeffs.data();
+            arg.bias = &bias;
+            arg.dst = dstData + obi * _embDepth;
+            arg.rows_num = indicesSize;
+            arg.work_amount = _embDepth;
+            (*_kernel)(&arg);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                                         const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
+    if (_kernel) {
+        return processDataJit(srcData, reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), srcPrc, inDims, outDims);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
@@ -13,6 +13,8 @@
 namespace ov {
 namespace intel_cpu {
 
+struct jit_uni_embedding_bag_kernel;
+
 class MKLDNNEmbeddingBagSumNode {
 public:
     MKLDNNEmbeddingBagSumNode(
@@ -27,6 +29,11 @@ public:
 
     ~MKLDNNEmbeddingBagSumNode() = default;
 
+    // Row-wise dequantization (value = table[row] * scale + shift) of the compressed embedding table.
+    // Scales and shifts contain either a single value or a value per table row.
+    void fuseDecompression(std::vector<float> scales, std::vector<float> shifts);
+    bool withDecompression() const { return !_decompressionScales.empty(); }
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -36,12 +43,19 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& tablePrc);
+
+    InferenceEngine::Precision getTablePrecision(const InferenceEngine::Precision& originalPrc) const;
+    InferenceEngine::Precision getOutputPrecision(const InferenceEngine::Precision& tablePrc) const;
+    impl_desc_type getImplType(const InferenceEngine::Precision& tablePrc) const;
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
 
+    void processDataJit(const uint8_t* srcData, const float* weightsData, float* dstData, const InferenceEngine::Precision &srcPrc,
+                        const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
     const size_t PER_SAMPLE_WEIGHTS_IDX;
@@ -50,6 +64,11 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::vector<float> _decompressionScales;
+    std::vector<float> _decompressionShifts;
+
+    std::shared_ptr<jit_uni_embedding_bag_kernel> _kernel;
 };
 
 }   // namespace intel_cpu
@@ -2,13 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cassert>
 #include "fullyconnected.h"
 #include "eltwise.h"
 #include "fake_quantize.h"
+#include "input.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
 #include <vector>
+#include <numeric>
+#include <algorithm>
 #include <extension_utils.h>
 #include <mkldnn.hpp>
 #include "utils/general_utils.h"
@@ -16,13 +20,286 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
 #include <common/primitive_hashing_utils.hpp>
+#include <openvino/core/type/float16.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace ov::intel_cpu;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_args_fc_decompression, field)
+
+struct jit_args_fc_decompression {
+    const float* src;
+    const uint8_t* weights;   // first of the oc_block weights rows
+    size_t weights_stride;    // distance between the weights rows in bytes
+    float* acc;               // oc_block vectors of partial dot products
+    size_t work_amount;       // number of input channels, multiple of simd_w
+};
+
+struct jit_fc_decompression_config_params {
+    Precision wei_dt;
+    int oc_block;
+};
+
+#define GET_SPARSE_OFF(field) offsetof(jit_args_fc_sparse, field)
+
+struct jit_args_fc_sparse {
+    const float* src;           // first of the m_block source rows
+    size_t src_stride;          // distance between the source rows in bytes
+    const float* values;        // non-zero blocks of one output channels block
+    const uint32_t* offsets;    // offset of the input channel of each non-zero block in a source row in bytes
+    size_t blocks_num;
+    float* acc;                 // m_block rows of the output channels block
+};
+
+struct jit_fc_sparse_config_params {
+    int m_block;
+};
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_uni_fc_decompression_kernel {
+    void (*ker_)(const jit_args_fc_decompression *);
+
+    void operator()(const jit_args_fc_decompression *args) { assert(ker_); ker_(args); }
+
+    explicit jit_uni_fc_decompression_kernel(size_t simd_w) : ker_(nullptr), simd_w(simd_w) {}
+    virtual ~jit_uni_fc_decompression_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    const size_t simd_w;
+};
+
+struct jit_uni_fc_sparse_kernel {
+    void (*ker_)(const jit_args_fc_sparse *);
+
+    void operator()(const jit_args_fc_sparse *args) { assert(ker_); ker_(args); }
+
+    jit_uni_fc_sparse_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_fc_sparse_kernel() {}
+
+    virtual void create_ker() = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
 
 namespace {
 
+// Number of output channels processed by the decompression kernel at once
+constexpr size_t decompressionOCBlock = 4;
+
+// Computes the dot products of one source row and oc_block compressed weights rows. The weights are converted to FP32
+// in registers, so the memory traffic is bounded by the compressed weights size.
+template <cpu_isa_t isa>
+struct jit_uni_fc_decompression_kernel_f32 : public jit_uni_fc_decompression_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_decompression_kernel_f32)
+
+    explicit jit_uni_fc_decompression_kernel_f32(jit_fc_decompression_config_params jcp)
+        : jit_uni_fc_decompression_kernel(cpu_isa_traits<isa>::vlen / sizeof(float)), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(get_row(0), ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_stride, ptr[reg_params + GET_OFF(weights_stride)]);
+        mov(reg_acc, ptr[reg_params + GET_OFF(acc)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        for (int i = 1; i < jcp_.oc_block; i++) {
+            mov(get_row(i), get_row(i - 1));
+            add(get_row(i), reg_stride);
+        }
+        for (int i = 0; i < jcp_.oc_block; i++)
+            uni_vpxor(get_acc(i), get_acc(i), get_acc(i));
+
+        const int wei_step = static_cast<int>(simd_w * jcp_.wei_dt.size());
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        L(loop_label);
+        {
+            cmp(reg_work_amount, static_cast<int>(simd_w));
+            jl(loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_src, ptr[reg_src]);
+            for (int i = 0; i < jcp_.oc_block; i++) {
+                load_weights(get_wei(i), ptr[get_row(i)]);
+                uni_vfmadd231ps(get_acc(i), get_wei(i), vmm_src);
+                add(get_row(i), wei_step);
+            }
+
+            add(reg_src, vlen);
+            sub(reg_work_amount, static_cast<int>(simd_w));
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        for (int i = 0; i < jcp_.oc_block; i++)
+            uni_vmovups(ptr[reg_acc + i * vlen], get_acc(i));
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr int max_oc_block = static_cast<int>(decompressionOCBlock);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_stride = r9;
+    Xbyak::Reg64 reg_acc = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 get_row(int i) { return Xbyak::Reg64(r12.getIdx() + i); }
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(0);
+    Vmm get_acc(int i) { return Vmm(1 + i); }
+    Vmm get_wei(int i) { return Vmm(1 + max_oc_block + i); }
+
+    jit_fc_decompression_config_params jcp_;
+
+    inline void load_weights(Vmm vmm_wei, const Xbyak::Address &op) {
+        switch (jcp_.wei_dt) {
+            case Precision::FP16:
+                vcvtph2ps(vmm_wei, op);
+                break;
+            case Precision::I8:
+                uni_vpmovsxbd(vmm_wei, op);
+                uni_vcvtdq2ps(vmm_wei, vmm_wei);
+                break;
+            case Precision::U8:
+                uni_vpmovzxbd(vmm_wei, op);
+                uni_vcvtdq2ps(vmm_wei, vmm_wei);
+                break;
+            default:
+                assert(!"unknown wei_dt");
+        }
+    }
+};
+
+// Number of output channels in a block of the sparse weights, one cache line of FP32 weights
+constexpr size_t sparseOCBlock = 16;
+// Maximal number of source rows processed by the sparse kernel at once (half of it without avx512)
+constexpr size_t sparseMaxMBlock = 8;
+// Number of source rows processed by one task, the weights of the output channels block stay in cache meanwhile
+constexpr size_t sparseMChunk = 4 * sparseMaxMBlock;
+
+// Multiplies m_block source rows by the non-zero blocks of one output channels block. A block is a column of
+// sparseOCBlock weights of one input channel: the source value is broadcasted and accumulated with the block, so the
+// zero blocks are skipped without any horizontal reduction.
+template <cpu_isa_t isa>
+struct jit_uni_fc_sparse_kernel_f32 : public jit_uni_fc_sparse_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_sparse_kernel_f32)
+
+    explicit jit_uni_fc_sparse_kernel_f32(jit_fc_sparse_config_params jcp)
+        : jit_uni_fc_sparse_kernel(), jit_generator(), jcp_(jcp) {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_values, ptr[reg_params + GET_SPARSE_OFF(values)]);
+        mov(reg_offsets, ptr[reg_params + GET_SPARSE_OFF(offsets)]);
+        mov(reg_blocks_num, ptr[reg_params + GET_SPARSE_OFF(blocks_num)]);
+        mov(get_row(0), ptr[reg_params + GET_SPARSE_OFF(src)]);
+        mov(reg_tmp, ptr[reg_params + GET_SPARSE_OFF(src_stride)]);
+
+        for (int m = 1; m < jcp_.m_block; m++) {
+            mov(get_row(m), get_row(m - 1));
+            add(get_row(m), reg_tmp);
+        }
+        for (int m = 0; m < jcp_.m_block; m++) {
+            for (int v = 0; v < vecs; v++)
+                uni_vpxor(get_acc(m, v), get_acc(m, v), get_acc(m, v));
+        }
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        L(loop_label);
+        {
+            cmp(reg_blocks_num, 0);
+            je(loop_end_label, T_NEAR);
+
+            mov(reg_offset.cvt32(), dword[reg_offsets]);
+            for (int v = 0; v < vecs; v++)
+                uni_vmovups(get_wei(v), ptr[reg_values + v * vlen]);
+            for (int m = 0; m < jcp_.m_block; m++) {
+                uni_vbroadcastss(vmm_src, ptr[get_row(m) + reg_offset]);
+                for (int v = 0; v < vecs; v++)
+                    uni_vfmadd231ps(get_acc(m, v), get_wei(v), vmm_src);
+            }
+
+            add(reg_values, static_cast<int>(sparseOCBlock * sizeof(float)));
+            add(reg_offsets, static_cast<int>(sizeof(uint32_t)));
+            dec(reg_blocks_num);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        mov(reg_tmp, ptr[reg_params + GET_SPARSE_OFF(acc)]);
+        for (int m = 0; m < jcp_.m_block; m++) {
+            for (int v = 0; v < vecs; v++)
+                uni_vmovups(ptr[reg_tmp + (m * vecs + v) * vlen], get_acc(m, v));
+        }
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    // vectors in an output channels block
+    const int vecs = static_cast<int>(sparseOCBlock * sizeof(float)) / cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_values = rax;
+    Xbyak::Reg64 reg_offsets = rbx;
+    Xbyak::Reg64 reg_blocks_num = rdx;
+    Xbyak::Reg64 reg_offset = rsi;
+    Xbyak::Reg64 reg_tmp = rsi;
+    Xbyak::Reg64 get_row(int m) { return Xbyak::Reg64(r8.getIdx() + m); }
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(0);
+    Vmm get_wei(int v) { return Vmm(1 + v); }
+    Vmm get_acc(int m, int v) { return Vmm(1 + vecs + m * vecs + v); }
+
+    jit_fc_sparse_config_params jcp_;
+};
+
+/**
+ * The packed sparse weights: the number of the non-zero blocks before each output channels block (ocBlocks + 1 values),
+ * the byte offsets of the input channels of the non-zero blocks and, aligned to the cache line, their weights.
+ * The output channels of the last block are padded with zeros.
+ */
+struct SparseWeightsLayout {
+    SparseWeightsLayout(size_t ocBlocks, size_t blocksNum)
+        : offsetsOffset((ocBlocks + 1) * sizeof(uint32_t)),
+          valuesOffset(mkldnn::impl::utils::rnd_up(offsetsOffset + blocksNum * sizeof(uint32_t), 64)),
+          size(valuesOffset + blocksNum * sparseOCBlock * sizeof(float)) {}
+
+    const size_t offsetsOffset;
+    const size_t valuesOffset;
+    const size_t size;
+};
+
 struct FCKey {
     DnnlMemoryDescCPtr inp0;
     DnnlMemoryDescCPtr inp1;
@@ -162,6 +439,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    // the compressed and sparse weights are processed by the own kernels instead of the oneDNN primitive
+    if (withDecompression() || withSparseWeights())
+        return;
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -201,6 +482,101 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::fuseDecompression(std::vector<float> scales, std::vector<float> shifts) {
+    if (scales.empty() || scales.size() != shifts.size())
+        IE_THROW() << errorPrefix << " has inconsistent decompression parameters.";
+
+    decompressionScales = std::move(scales);
+    decompressionShifts = std::move(shifts);
+}
+
+bool MKLDNNFullyConnectedNode::useSparseWeights(float threshold) {
+    const auto weightsNode = std::dynamic_pointer_cast<MKLDNNInputNode>(getParentEdgesAtPort(WEIGHTS_ID)[0]->getParent());
+    if (!weightsNode)
+        return false;
+    const auto weightsMemory = weightsNode->getMemoryPtr();
+    if (!weightsMemory || weightsMemory->getDesc().getPrecision() != Precision::FP32)
+        return false;
+
+    const auto& weiDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weiDims[0];
+    const size_t IC = weiDims[1];
+    const size_t ocBlocks = mkldnn::impl::utils::div_up(OC, sparseOCBlock);
+    const auto weights = reinterpret_cast<const float*>(weightsMemory->GetPtr());
+    auto isZeroBlock = [&](size_t ocBlock, size_t ic) {
+        for (size_t oc = ocBlock * sparseOCBlock; oc < std::min(OC, (ocBlock + 1) * sparseOCBlock); oc++) {
+            if (weights[oc * IC + ic] != 0.0f)
+                return false;
+        }
+        return true;
+    };
+
+    std::vector<uint32_t> blocksBefore(ocBlocks + 1, 0);
+    parallel_for(ocBlocks, [&](size_t ocBlock) {
+        uint32_t blocksNum = 0;
+        for (size_t ic = 0; ic < IC; ic++)
+            blocksNum += isZeroBlock(ocBlock, ic) ? 0 : 1;
+        blocksBefore[ocBlock + 1] = blocksNum;
+    });
+    std::partial_sum(blocksBefore.begin(), blocksBefore.end(), blocksBefore.begin());
+
+    const size_t blocksNum = blocksBefore.back();
+    const float sparsityRate = 1.0f - static_cast<float>(blocksNum) / (ocBlocks * IC);
+    if (sparsityRate < threshold)
+        return false;
+
+    auto create = [&]() {
+        const SparseWeightsLayout layout(ocBlocks, blocksNum);
+        MKLDNNMemoryPtr packed = std::make_shared<MKLDNNMemory>(getEngine());
+        packed->Create(CpuBlockedMemoryDesc(Precision::U8, Shape(VectorDims{layout.size})));
+        auto data = reinterpret_cast<uint8_t*>(packed->GetPtr());
+        std::copy(blocksBefore.begin(), blocksBefore.end(), reinterpret_cast<uint32_t*>(data));
+        const auto offsets = reinterpret_cast<uint32_t*>(data + layout.offsetsOffset);
+        const auto values = reinterpret_cast<float*>(data + layout.valuesOffset);
+        parallel_for(ocBlocks, [&](size_t ocBlock) {
+            size_t block = blocksBefore[ocBlock];
+            for (size_t ic = 0; ic < IC; ic++) {
+                if (isZeroBlock(ocBlock, ic))
+                    continue;
+                offsets[block] = static_cast<uint32_t>(ic * sizeof(float));
+                float* blockValues = values + block * sparseOCBlock;
+                for (size_t i = 0; i < sparseOCBlock; i++) {
+                    const size_t oc = ocBlock * sparseOCBlock + i;
+                    blockValues[i] = oc < OC ? weights[oc * IC + ic] : 0.0f;
+                }
+                block++;
+            }
+        });
+        return packed;
+    };
+
+    if (weightCache != nullptr) {
+        const size_t byteSize = OC * IC * sizeof(float);
+        const uint64_t dataHash = weightCache->GetHashFunc().hash(reinterpret_cast<const unsigned char*>(weights), byteSize);
+        const std::string key = getName() + "_sparse_" + std::to_string(byteSize) + "_" + std::to_string(dataHash);
+        sparseWeights = *weightCache->findOrCreate(key, create);
+    } else {
+        sparseWeights = create();
+    }
+    sparseWeightsDims = weiDims;
+    inputShapes[WEIGHTS_ID] = Shape(sparseWeights->getStaticDims());
+    setOriginalInputPrecisionAtPort(WEIGHTS_ID, Precision::U8);
+    return true;
+}
+
+std::vector<VectorDims> MKLDNNFullyConnectedNode::shapeInfer() const {
+    if (!withSparseWeights())
+        return MKLDNNNode::shapeInfer();
+
+    // the weights input holds the packed sparse weights, so the output shape is inferred from the dense ones
+    std::vector<Shape> inShapes = {Shape(getParentEdgesAtPort(DATA_ID)[0]->getMemory().getStaticDims()),
+                                   Shape(sparseWeightsDims)};
+    if (withBiases) {
+        inShapes.emplace_back(getInputShapeAtPort(BIAS_ID));
+    }
+    return shapeInferGeneric(inShapes);
+}
+
 void MKLDNNFullyConnectedNode::prepareParams() {
     auto srcMemPtr = getParentEdgesAtPort(0)[0]->getMemoryPtr();
     auto wghMemPtr = getParentEdgesAtPort(1)[0]->getMemoryPtr();
@@ -222,6 +598,53 @@ void MKLDNNFullyConnectedNode::prepareParams() {
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
 
+    if (withDecompression()) {
+        if (decompressionKernel)
+            return;
+
+        jit_fc_decompression_config_params jcp;
+        jcp.wei_dt = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+        auto createKernel = [&](int ocBlock) -> std::shared_ptr<jit_uni_fc_decompression_kernel> {
+            jcp.oc_block = ocBlock;
+            std::shared_ptr<jit_uni_fc_decompression_kernel> kernel;
+            if (mayiuse(avx512_common)) {
+                kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx512_common>(jcp));
+            } else if (mayiuse(avx2)) {
+                kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx2>(jcp));
+            } else {
+                IE_THROW() << errorPrefix << " doesn't support compressed weights on the current platform.";
+            }
+            kernel->create_ker();
+            return kernel;
+        };
+        decompressionKernel = createKernel(decompressionOCBlock);
+        decompressionTailKernel = createKernel(1);
+        initDecompressionPostOps(dstMemPtr->getStaticDims());
+        return;
+    }
+
+    if (withSparseWeights()) {
+        if (!sparseKernels.empty())
+            return;
+
+        const size_t maxMBlock = mayiuse(avx512_common) ? sparseMaxMBlock : sparseMaxMBlock / 2;
+        for (size_t mBlock = 1; mBlock <= maxMBlock; mBlock++) {
+            jit_fc_sparse_config_params jcp;
+            jcp.m_block = static_cast<int>(mBlock);
+            std::shared_ptr<jit_uni_fc_sparse_kernel> kernel;
+            if (mayiuse(avx512_common)) {
+                kernel.reset(new jit_uni_fc_sparse_kernel_f32<avx512_common>(jcp));
+            } else if (mayiuse(avx2)) {
+                kernel.reset(new jit_uni_fc_sparse_kernel_f32<avx2>(jcp));
+            } else {
+                IE_THROW() << errorPrefix << " doesn't support sparse weights on the current platform.";
+            }
+            kernel->create_ker();
+            sparseKernels.push_back(kernel);
+        }
+        return;
+    }
+
     AttrPtr attr = std::make_shared<mkldnn::primitive_attr>();
     setPostOps(*attr, dstMemPtr->getStaticDims());
 
@@ -328,6 +751,8 @@ void MKLDNNFullyConnectedNode::prepareParams() {
 
 void MKLDNNFullyConnectedNode::setDynamicBatchLim(int lim) {
     dynBatchLim = lim;
+    if (withDecompression() || withSparseWeights())
+        return;
 
     auto setBatchPrimArgs = [this](int argType, const mkldnn::memory& oldMem) {
         mkldnn::memory::desc newMemDesc(oldMem.get_desc());
@@ -347,7 +772,195 @@ void MKLDNNFullyConnectedNode::setDynamicBatchLim(int lim) {
     setBatchPrimArgs(DNNL_ARG_DST, getChildEdgesAtPort(0)[0]->getMemory().GetPrimitive());
 }
 
+void MKLDNNFullyConnectedNode::initDecompressionPostOps(const VectorDims &dims) {
+    mkldnn::post_ops ops;
+    for (auto &node : fusedWith) {
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (!eltwiseNode)
+            IE_THROW() << "Fusing of " << NameFromType(node->getType()) << " operation to " << NameFromType(this->getType())
+                       << " node with compressed weights is not implemented";
+        eltwiseNode->appendPostOps(ops, dims, decompressionPostOpsData);
+    }
+    decompressionAttr.set_post_ops(ops);
+
+    const auto &p = (*decompressionAttr.get()).post_ops_;
+    for (int i = 0; i < p.len(); i++) {
+        const auto &postOp = p.entry_[i];
+        if (postOp.is_eltwise()) {
+            decompressionEltwiseRefs.push_back(std::make_shared<mkldnn::impl::cpu::ref_eltwise_scalar_fwd_t>(
+                    postOp.eltwise.alg, postOp.eltwise.alpha, postOp.eltwise.beta, postOp.eltwise.scale));
+        } else if (postOp.is_depthwise()) {
+            decompressionDepthwiseRefs.push_back(std::make_shared<mkldnn::impl::cpu::ref_depthwise_scalar_fwd_t>(postOp.depthwise.alg));
+        }
+    }
+}
+
+float MKLDNNFullyConnectedNode::applyDecompressionPostOps(float value, size_t oc) const {
+    const auto &p = (*decompressionAttr.get()).post_ops_;
+    size_t eltwiseIdx = 0;
+    size_t depthwiseIdx = 0;
+    for (int i = 0; i < p.len(); i++) {
+        const auto &postOp = p.entry_[i];
+        if (postOp.is_eltwise()) {
+            value = decompressionEltwiseRefs[eltwiseIdx++]->compute_scalar(value);
+        } else if (postOp.is_depthwise()) {
+            const auto data = reinterpret_cast<const float*>(decompressionPostOpsData[depthwiseIdx]);
+            const auto weights = data + postOp.depthwise.offset[postOp.depthwise.scales] + oc;
+            const auto bias = data + postOp.depthwise.offset[postOp.depthwise.shifts] + oc;
+            value = decompressionDepthwiseRefs[depthwiseIdx++]->compute_scalar(value, weights, bias);
+        }
+    }
+    return value;
+}
+
+void MKLDNNFullyConnectedNode::executeDecompression() {
+    const auto& srcMem = getParentEdgesAtPort(DATA_ID)[0]->getMemory();
+    const auto& weiMem = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemory();
+    auto& dstMem = getChildEdgesAtPort(0)[0]->getMemory();
+
+    const auto& srcDims = srcMem.getStaticDims();
+    const auto& weiDims = weiMem.getStaticDims();
+    const size_t OC = weiDims[0];
+    const size_t IC = weiDims[1];
+    size_t M = isDynamicNode() ? srcDims[0] : static_cast<size_t>(batchToProcess());
+    for (size_t i = 1; i < srcDims.size() - 1; i++)
+        M *= srcDims[i];
+
+    const auto src = reinterpret_cast<const float*>(srcMem.GetPtr());
+    const auto weights = reinterpret_cast<const uint8_t*>(weiMem.GetPtr());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemory().GetPtr()) : nullptr;
+    const auto dst = reinterpret_cast<float*>(dstMem.GetPtr());
+
+    const auto weiPrc = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+    const size_t weiRowSize = IC * weiPrc.size();
+    const size_t simdW = decompressionKernel->simd_w;
+    const size_t vecIC = IC / simdW * simdW;
+
+    auto getWeight = [&](const uint8_t* row, size_t ic) -> float {
+        switch (weiPrc) {
+            case Precision::FP16: return static_cast<float>(ov::float16::from_bits(reinterpret_cast<const uint16_t*>(row)[ic]));
+            case Precision::I8: return static_cast<float>(reinterpret_cast<const int8_t*>(row)[ic]);
+            default: return static_cast<float>(row[ic]);
+        }
+    };
+
+    // the shifts are applied to the sum of the source row: sum(x * (w * scale + shift)) = scale * dot(x, w) + shift * sum(x)
+    const bool withShifts = std::any_of(decompressionShifts.begin(), decompressionShifts.end(), [](float shift) { return shift != 0.0f; });
+    if (withShifts) {
+        srcRowSums.resize(M);
+        parallel_for(M, [&](size_t m) {
+            const float* srcRow = src + m * IC;
+            srcRowSums[m] = std::accumulate(srcRow, srcRow + IC, 0.0f);
+        });
+    }
+
+    const bool perChannel = decompressionScales.size() > 1;
+    const bool withPostOps = !fusedWith.empty();
+    const size_t blocksNum = mkldnn::impl::utils::div_up(OC, decompressionOCBlock);
+    parallel_for(blocksNum, [&](size_t block) {
+        // the rows of the weights block stay in cache while all the source rows are processed
+        float acc[decompressionOCBlock * 16];
+        const size_t ocEnd = std::min(OC, (block + 1) * decompressionOCBlock);
+        for (size_t m = 0; m < M; m++) {
+            const float* srcRow = src + m * IC;
+            size_t oc = block * decompressionOCBlock;
+            while (oc < ocEnd) {
+                const bool fullBlock = ocEnd - oc == decompressionOCBlock;
+                const size_t ocNum = fullBlock ? decompressionOCBlock : 1;
+                const uint8_t* weiRows = weights + oc * weiRowSize;
+
+                jit_args_fc_decompression args;
+                args.src = srcRow;
+                args.weights = weiRows;
+                args.weights_stride = weiRowSize;
+                args.acc = acc;
+                args.work_amount = vecIC;
+                (fullBlock ? *decompressionKernel : *decompressionTailKernel)(&args);
+
+                for (size_t i = 0; i < ocNum; i++) {
+                    const float* accRow = acc + i * simdW;
+                    float sum = std::accumulate(accRow, accRow + simdW, 0.0f);
+                    for (size_t ic = vecIC; ic < IC; ic++)
+                        sum += srcRow[ic] * getWeight(weiRows + i * weiRowSize, ic);
+
+                    const size_t decIdx = perChannel ? oc + i : 0;
+                    float value = sum * decompressionScales[decIdx];
+                    if (withShifts)
+                        value += decompressionShifts[decIdx] * srcRowSums[m];
+                    if (bias)
+                        value += bias[oc + i];
+                    if (withPostOps)
+                        value = applyDecompressionPostOps(value, oc + i);
+                    dst[m * OC + oc + i] = value;
+                }
+                oc += ocNum;
+            }
+        }
+    });
+}
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    const auto& srcMem = getParentEdgesAtPort(DATA_ID)[0]->getMemory();
+    auto& dstMem = getChildEdgesAtPort(0)[0]->getMemory();
+
+    const auto& srcDims = srcMem.getStaticDims();
+    const size_t OC = sparseWeightsDims[0];
+    const size_t IC = sparseWeightsDims[1];
+    size_t M = isDynamicNode() ? srcDims[0] : static_cast<size_t>(batchToProcess());
+    for (size_t i = 1; i < srcDims.size() - 1; i++)
+        M *= srcDims[i];
+
+    const auto src = reinterpret_cast<const float*>(srcMem.GetPtr());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemory().GetPtr()) : nullptr;
+    const auto dst = reinterpret_cast<float*>(dstMem.GetPtr());
+
+    const size_t ocBlocks = mkldnn::impl::utils::div_up(OC, sparseOCBlock);
+    const auto packed = reinterpret_cast<const uint8_t*>(sparseWeights->GetPtr());
+    const auto blocksBefore = reinterpret_cast<const uint32_t*>(packed);
+    const SparseWeightsLayout layout(ocBlocks, blocksBefore[ocBlocks]);
+    const auto offsets = reinterpret_cast<const uint32_t*>(packed + layout.offsetsOffset);
+    const auto values = reinterpret_cast<const float*>(packed + layout.valuesOffset);
+
+    const size_t maxMBlock = sparseKernels.size();
+    const size_t mChunks = mkldnn::impl::utils::div_up(M, sparseMChunk);
+    parallel_for2d(mChunks, ocBlocks, [&](size_t mChunk, size_t ocBlock) {
+        float acc[sparseMaxMBlock * sparseOCBlock];
+        const size_t ocStart = ocBlock * sparseOCBlock;
+        const size_t ocNum = std::min(sparseOCBlock, OC - ocStart);
+        const size_t mEnd = std::min(M, (mChunk + 1) * sparseMChunk);
+
+        jit_args_fc_sparse args;
+        args.src_stride = IC * sizeof(float);
+        args.values = values + blocksBefore[ocBlock] * sparseOCBlock;
+        args.offsets = offsets + blocksBefore[ocBlock];
+        args.blocks_num = blocksBefore[ocBlock + 1] - blocksBefore[ocBlock];
+        args.acc = acc;
+        for (size_t m = mChunk * sparseMChunk; m < mEnd; m += maxMBlock) {
+            const size_t mBlock = std::min(maxMBlock, mEnd - m);
+            args.src = src + m * IC;
+            (*sparseKernels[mBlock - 1])(&args);
+
+            for (size_t i = 0; i < mBlock; i++) {
+                float* dstRow = dst + (m + i) * OC + ocStart;
+                const float* accRow = acc + i * sparseOCBlock;
+                for (size_t oc = 0; oc < ocNum; oc++)
+                    dstRow[oc] = bias ? accRow[oc] + bias[ocStart + oc] : accRow[oc];
+            }
+        }
+    });
+}
+
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (withDecompression()) {
+        executeDecompression();
+        return;
+    }
+
+    if (withSparseWeights()) {
+        executeSparse();
+        return;
+    }
+
     if (prim) {
         // in cases parameter -> FullyConnected or dynamic shapes
         // we keep old pointer to data in primArgs on second iteration with same input shapes
@@ -375,6 +988,11 @@ void MKLDNNFullyConnectedNode::executeDynamicImpl(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    if (withSparseWeights())
+        return false;
+    // the decompression kernel applies the activations and the per channel scales/shifts only
+    if (withDecompression() && (node->getType() != Eltwise || node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32))
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -520,6 +1138,9 @@ void MKLDNNFullyConnectedNode::createDescriptorInternal(const mkldnn::memory::de
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (withDecompression() || withSparseWeights())
+        return;
+
     MemoryDescPtr inpDesc;
     if (inputDesc[0]->isDefined()) {
         inpDesc = inputDesc[0];
@@ -541,6 +1162,21 @@ void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (withDecompression() || withSparseWeights()) {
+        std::vector<PortConfigurator> inConfs{{LayoutType::ncsp, Precision::FP32},
+                                              {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+        if (withBiases)
+            inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+        impl_desc_type implType = mayiuse(avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+        if (withSparseWeights())
+            implType = mayiuse(avx512_common) ? impl_desc_type::jit_avx512_sparse : impl_desc_type::jit_avx2_sparse;
+        addSupportedPrimDesc(inConfs,
+                             {{LayoutType::ncsp, Precision::FP32}},
+                             implType,
+                             true);
+        return;
+    }
+
     for (auto& desc : descs) {
         auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
         while (static_cast<bool>(itpd)) {
@@ -6,6 +6,8 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include <cpu/ref_eltwise.hpp>
+#include <cpu/ref_depthwise_injector.hpp>
 #include <memory>
 #include <string>
 #include <vector>
@@ -13,6 +15,9 @@
 namespace ov {
 namespace intel_cpu {
 
+struct jit_uni_fc_decompression_kernel;
+struct jit_uni_fc_sparse_kernel;
+
 class MKLDNNFullyConnectedNode : public MKLDNNNode {
 public:
     MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -55,7 +60,25 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    // Compressed weights (U8/I8/FP16) are dequantized by the node itself: W[n][k] * scales[n] + shifts[n]
+    void fuseDecompression(std::vector<float> scales, std::vector<float> shifts);
+    bool withDecompression() const { return !decompressionScales.empty(); }
+
+    // Constant FP32 weights whose share of zero blocks (sparse OC block x 1 input channel) is at least the threshold
+    // are packed into the block sparse format, and only the non-zero blocks are multiplied.
+    // The weights port then expects the packed U8 weights, the caller replaces the weights input with them.
+    bool useSparseWeights(float threshold);
+    bool withSparseWeights() const { return sparseWeights != nullptr; }
+    MKLDNNMemoryCPtr getSparseWeights() const { return sparseWeights; }
+
+    std::vector<VectorDims> shapeInfer() const override;
+
 private:
+    void initDecompressionPostOps(const VectorDims &dims);
+    float applyDecompressionPostOps(float value, size_t oc) const;
+    void executeDecompression();
+    void executeSparse();
+
     void createDescriptorInternal(const mkldnn::memory::desc &inputDesc,
                                   const mkldnn::memory::desc &outputDesc);
 
@@ -69,6 +92,23 @@ private:
 
     bool withBiases = false;
 
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionShifts;
+    std::vector<float> srcRowSums;
+    std::shared_ptr<jit_uni_fc_decompression_kernel> decompressionKernel;
+    std::shared_ptr<jit_uni_fc_decompression_kernel> decompressionTailKernel;
+    // the fused operations are applied to the outputs of the decompression kernel one by one
+    mkldnn::primitive_attr decompressionAttr;
+    std::vector<const void*> decompressionPostOpsData;
+    std::vector<std::shared_ptr<mkldnn::impl::cpu::ref_eltwise_scalar_fwd_t>> decompressionEltwiseRefs;
+    std::vector<std::shared_ptr<mkldnn::impl::cpu::ref_depthwise_scalar_fwd_t>> decompressionDepthwiseRefs;
+
+    MKLDNNMemoryPtr sparseWeights;
+    // the shape of the original dense weights
+    VectorDims sparseWeightsDims;
+    // the kernel for i + 1 source rows
+    std::vector<std::shared_ptr<jit_uni_fc_sparse_kernel>> sparseKernels;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
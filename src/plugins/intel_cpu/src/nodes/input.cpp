@@ -379,6 +379,13 @@ MKLDNNInputNode::MKLDNNInputNode(MemoryDescPtr memDesc, const std::string &name,
     extMemDesc = memDesc;
 }
 
+MKLDNNInputNode::MKLDNNInputNode(MKLDNNMemoryCPtr mem, const std::string &name, const mkldnn::engine &eng,
+                                 MKLDNNWeightsSharing::Ptr &cache) :
+    MKLDNNInputNode(mem->getDesc().getShape(), mem->getDesc().getPrecision(), name, "Input", eng, cache) {
+    constant = ConstantType::Const;
+    memoryPtr = std::move(mem);
+}
+
 void MKLDNNInputNode::withMeanImage() {
     isMeanImage = true;
 }
@@ -19,6 +19,9 @@ public:
                     const std::string &type, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
     MKLDNNInputNode(MemoryDescPtr memDesc, const std::string &name, const std::string &type, const mkldnn::engine& eng,
                     MKLDNNWeightsSharing::Ptr &cache);
+    // The constant input with the data prepared by the plugin, e.g. the weights repacked by a node
+    MKLDNNInputNode(MKLDNNMemoryCPtr mem, const std::string &name, const mkldnn::engine& eng,
+                    MKLDNNWeightsSharing::Ptr &cache);
 
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
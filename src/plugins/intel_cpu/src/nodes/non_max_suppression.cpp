@@ -1018,30 +1018,68 @@ void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const
                     boxCoord2[0] = boxesPtr[sorted_boxes[0].second * 4 + 2];
                     boxCoord3[0] = boxesPtr[sorted_boxes[0].second * 4 + 3];
 
-                    auto arg = jit_nms_args();
-                    arg.iou_threshold = static_cast<float*>(&iouThreshold);
-                    arg.score_threshold = static_cast<float*>(&scoreThreshold);
-                    arg.scale = static_cast<float*>(&scale);
-                    // box start index do not change for hard supresion
-                    arg.selected_boxes_coord[0] = static_cast<float*>(&boxCoord0[0]);
-                    arg.selected_boxes_coord[1] = static_cast<float*>(&boxCoord1[0]);
-                    arg.selected_boxes_coord[2] = static_cast<float*>(&boxCoord2[0]);
-                    arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[0]);
-
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
+                    // checks the candidate against the selected boxes [selected_begin, selected_end)
+                    auto checkCandidate = [&](size_t candidate_idx, size_t selected_begin, size_t selected_end) {
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
-                        arg.selected_boxes_num = io_selection_size;
+                        auto arg = jit_nms_args();
+                        arg.iou_threshold = static_cast<float*>(&iouThreshold);
+                        arg.score_threshold = static_cast<float*>(&scoreThreshold);
+                        arg.scale = static_cast<float*>(&scale);
+                        arg.selected_boxes_coord[0] = static_cast<float*>(&boxCoord0[selected_begin]);
+                        arg.selected_boxes_coord[1] = static_cast<float*>(&boxCoord1[selected_begin]);
+                        arg.selected_boxes_coord[2] = static_cast<float*>(&boxCoord2[selected_begin]);
+                        arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[selected_begin]);
+                        arg.selected_boxes_num = selected_end - selected_begin;
                         arg.candidate_box = static_cast<const float*>(&boxesPtr[sorted_boxes[candidate_idx].second * 4]);
                         arg.candidate_status = static_cast<int*>(&candidateStatus);
                         (*nms_kernel)(&arg);
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4];
-                            boxCoord1[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 1];
-                            boxCoord2[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 2];
-                            boxCoord3[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 3];
-                            filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
-                            io_selection_size++;
+                        return candidateStatus;
+                    };
+
+                    auto selectCandidate = [&](size_t candidate_idx) {
+                        boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4];
+                        boxCoord1[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 1];
+                        boxCoord2[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 2];
+                        boxCoord3[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 3];
+                        filtBoxes[offset + io_selection_size] =
+                            filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                        io_selection_size++;
+                    };
+
+                    if (sortedBoxSize >= blockedSuppressionMinBoxes) {
+                        // Candidates are processed by blocks. The candidates of a block are checked against the boxes selected
+                        // before the block in parallel and the result is stored in a suppression bitmask. The remaining
+                        // candidates are then checked sequentially against the boxes selected within the block only,
+                        // so every candidate is compared with exactly the same boxes as in the sequential selection.
+                        const size_t maskBits = 8 * sizeof(uint64_t);
+                        std::vector<uint64_t> suppressedMask(div_up(suppressionBlockSize, maskBits));
+
+                        for (size_t blockStart = 1; (blockStart < sortedBoxSize) && (io_selection_size < max_out_box);
+                                blockStart += suppressionBlockSize) {
+                            const size_t blockSize = std::min(suppressionBlockSize, sortedBoxSize - blockStart);
+                            const size_t selectedBeforeBlock = io_selection_size;
+
+                            parallel_for(div_up(blockSize, maskBits), [&](size_t word) {
+                                uint64_t mask = 0;
+                                const size_t bitsNum = std::min(maskBits, blockSize - word * maskBits);
+                                for (size_t bit = 0; bit < bitsNum; bit++) {
+                                    if (checkCandidate(blockStart + word * maskBits + bit, 0, selectedBeforeBlock) == NMSCandidateStatus::SUPPRESSED)
+                                        mask |= uint64_t(1) << bit;
+                                }
+                                suppressedMask[word] = mask;
+                            });
+
+                            for (size_t i = 0; (i < blockSize) && (io_selection_size < max_out_box); i++) {
+                                if (suppressedMask[i / maskBits] & (uint64_t(1) << (i % maskBits)))
+                                    continue;
+                                if (checkCandidate(blockStart + i, selectedBeforeBlock, io_selection_size) == NMSCandidateStatus::SELECTED)
+                                    selectCandidate(blockStart + i);
+                            }
+                        }
+                    } else {
+                        for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
+                            if (checkCandidate(candidate_idx, 0, io_selection_size) == NMSCandidateStatus::SELECTED)
+                                selectCandidate(candidate_idx);
                         }
                     }
                 } else {
@@ -135,6 +135,10 @@ private:
     // control placeholder for NMS in new opset.
     bool isSoftSuppressedByIOU = true;
 
+    // hard suppression of the classes with at least blockedSuppressionMinBoxes candidates is done by blocks
+    const size_t blockedSuppressionMinBoxes = 2048lu;
+    const size_t suppressionBlockSize = 1024lu;
+
     std::string errorPrefix;
 
     std::vector<std::vector<size_t>> numFiltBox;
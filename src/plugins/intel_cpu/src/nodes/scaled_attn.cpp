@@ -0,0 +1,446 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_attn.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <ie_parallel.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <cpu/x64/injectors/jit_uni_eltwise_injector.hpp>
+#include "ngraph_transformations/op/scaled_attn.hpp"
+#include "utils/bfloat16.hpp"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_args_scaled_attn_exp, field)
+
+struct jit_args_scaled_attn_exp {
+    const float* src;
+    float* dst;
+    const float* max;
+    float* sum;          // per lane partial sums
+    size_t work_amount;  // number of vectors
+};
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_uni_scaled_attn_exp_kernel {
+    void (*ker_)(const jit_args_scaled_attn_exp *);
+
+    void operator()(const jit_args_scaled_attn_exp *args) { assert(ker_); ker_(args); }
+
+    jit_uni_scaled_attn_exp_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_scaled_attn_exp_kernel() {}
+
+    virtual void create_ker() = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
+
+// Computes exp(src - max) and accumulates the partial sums of the exponents
+template <cpu_isa_t isa>
+struct jit_uni_scaled_attn_exp_kernel_f32 : public jit_uni_scaled_attn_exp_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_scaled_attn_exp_kernel_f32)
+
+    jit_uni_scaled_attn_exp_kernel_f32() : jit_uni_scaled_attn_exp_kernel(), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, mkldnn::impl::alg_kind::eltwise_exp, 0.f, 0.f, 1.0f));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_max, ptr[reg_params + GET_OFF(max)]);
+        mov(reg_sum, ptr[reg_params + GET_OFF(sum)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        uni_vbroadcastss(vmm_max, ptr[reg_max]);
+        uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        L(loop_label); {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_src]);
+            uni_vsubps(vmm_val, vmm_val, vmm_max);
+            exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+            uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+            uni_vmovups(ptr[reg_dst], vmm_val);
+
+            add(reg_src, vlen);
+            add(reg_dst, vlen);
+            sub(reg_work_amount, 1);
+
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        uni_vmovups(ptr[reg_sum], vmm_sum);
+
+        this->postamble();
+
+        exp_injector->prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_max = r10;
+    Xbyak::Reg64 reg_sum = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_val = Vmm(1);
+    Vmm vmm_max = Vmm(2);
+    Vmm vmm_sum = Vmm(3);
+
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+};
+
+namespace {
+
+template <typename T>
+void convertBlock(const T* src, float* dst, size_t rows, size_t cols, size_t srcRowStride, size_t srcColStride,
+                  size_t dstRowStride, size_t dstColStride, float scale) {
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t c = 0; c < cols; c++) {
+            dst[r * dstRowStride + c * dstColStride] = scale * static_cast<float>(src[r * srcRowStride + c * srcColStride]);
+        }
+    }
+}
+
+void convertBlock(const uint8_t* src, Precision prc, float* dst, size_t rows, size_t cols, size_t srcRowStride, size_t srcColStride,
+                  size_t dstRowStride, size_t dstColStride, float scale) {
+    switch (prc) {
+        case Precision::FP32:
+            convertBlock(reinterpret_cast<const float*>(src), dst, rows, cols, srcRowStride, srcColStride, dstRowStride, dstColStride, scale);
+            break;
+        case Precision::BF16:
+            convertBlock(reinterpret_cast<const bfloat16_t*>(src), dst, rows, cols, srcRowStride, srcColStride, dstRowStride, dstColStride, scale);
+            break;
+        case Precision::I8:
+            convertBlock(reinterpret_cast<const int8_t*>(src), dst, rows, cols, srcRowStride, srcColStride, dstRowStride, dstColStride, scale);
+            break;
+        case Precision::U8:
+            convertBlock(reinterpret_cast<const uint8_t*>(src), dst, rows, cols, srcRowStride, srcColStride, dstRowStride, dstColStride, scale);
+            break;
+        default:
+            IE_THROW() << "ScaledDotProductAttention doesn't support precision: " << prc.name();
+    }
+}
+
+template <typename T>
+void storeRow(const float* src, T* dst, size_t count, size_t dstStride, float scale) {
+    for (size_t c = 0; c < count; c++) {
+        dst[c * dstStride] = static_cast<T>(src[c] * scale);
+    }
+}
+
+VectorDims getDenseStrides(const VectorDims& dims) {
+    VectorDims strides(dims.size(), 1);
+    for (size_t i = dims.size() - 1; i > 0; i--)
+        strides[i - 1] = strides[i] * dims[i];
+    return strides;
+}
+
+}  // namespace
+
+bool MKLDNNScaledAttnNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!std::dynamic_pointer_cast<const ov::intel_cpu::ScaledAttnNode>(op)) {
+            errorMessage = "Only ScaledDotProductAttention operation from cpu_plugin_opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNScaledAttnNode::MKLDNNScaledAttnNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                           MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ScaledDotProductAttention node with name '" + getName() + "'";
+    const auto attn = std::dynamic_pointer_cast<const ov::intel_cpu::ScaledAttnNode>(op);
+    scale = attn->get_scale();
+    qOrder = attn->get_q_order();
+    kOrder = attn->get_k_order();
+    vOrder = attn->get_v_order();
+    outOrder = attn->get_out_order();
+    withMask = op->get_input_size() > MASK_ID;
+}
+
+void MKLDNNScaledAttnNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto getDataPrecision = [](Precision prc) {
+        return one_of(prc, Precision::FP32, Precision::BF16, Precision::I8, Precision::U8) ? prc : Precision::FP32;
+    };
+
+    std::vector<PortConfigurator> inPortConfigs;
+    for (size_t i = Q_ID; i <= V_ID; i++)
+        inPortConfigs.push_back({LayoutType::ncsp, getDataPrecision(getOriginalInputPrecisionAtPort(i))});
+    if (withMask)
+        inPortConfigs.push_back({LayoutType::ncsp, Precision::FP32});
+
+    const auto outPrc = getOriginalOutputPrecisionAtPort(0) == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+
+    // only the softmax exponent is computed by the JIT kernel, the products with the keys and values are plain loops
+    addSupportedPrimDesc(inPortConfigs, {{LayoutType::ncsp, outPrc}}, impl_desc_type::ref_any);
+}
+
+void MKLDNNScaledAttnNode::createPrimitive() {
+    if (mayiuse(avx512_common)) {
+        expKernel.reset(new jit_uni_scaled_attn_exp_kernel_f32<avx512_common>());
+        expBlockSize = 16;
+    } else if (mayiuse(avx2)) {
+        expKernel.reset(new jit_uni_scaled_attn_exp_kernel_f32<avx2>());
+        expBlockSize = 8;
+    } else if (mayiuse(sse41)) {
+        expKernel.reset(new jit_uni_scaled_attn_exp_kernel_f32<sse41>());
+        expBlockSize = 4;
+    }
+    if (expKernel)
+        expKernel->create_ker();
+
+    MKLDNNNode::createPrimitive();
+}
+
+void MKLDNNScaledAttnNode::prepareParams() {
+    const auto k = getTensorView(K_ID, kOrder);
+    const auto v = getTensorView(V_ID, vOrder);
+    // FP32 keys and values are read in place if the layout is already suitable for the loops over them
+    packKeys = k.prc != Precision::FP32 || k.strides[2] != 1;
+    packValues = v.prc != Precision::FP32 || v.strides[3] != 1;
+    packedKeys.resize(packKeys ? k.dims[0] * k.dims[1] * k.dims[2] * k.dims[3] : 0);
+    packedValues.resize(packValues ? v.dims[0] * v.dims[1] * v.dims[2] * v.dims[3] : 0);
+}
+
+MKLDNNScaledAttnNode::TensorView MKLDNNScaledAttnNode::getTensorView(size_t port, const std::vector<size_t>& order) const {
+    const auto& memPtr = getParentEdgeAt(port)->getMemoryPtr();
+    const auto& dims = memPtr->getStaticDims();
+    const auto strides = getDenseStrides(dims);
+
+    TensorView view{reinterpret_cast<const uint8_t*>(memPtr->GetPtr()), memPtr->getDesc().getPrecision(), VectorDims(4), VectorDims(4)};
+    for (size_t i = 0; i < 4; i++) {
+        view.dims[i] = dims[order[i]];
+        view.strides[i] = strides[order[i]];
+    }
+    return view;
+}
+
+void MKLDNNScaledAttnNode::packKeysValues(const TensorView& k, const TensorView& v) {
+    const size_t Lk = k.dims[2];
+    const size_t D = k.dims[3];
+    const size_t Dv = v.dims[3];
+
+    // keys are transposed to [D, Lk], so the scores of a query are computed by vector operations over the keys
+    if (packKeys) {
+        parallel_for3d(k.dims[0], k.dims[1], Lk, [&](size_t b, size_t h, size_t j) {
+            const auto src = k.data + (b * k.strides[0] + h * k.strides[1] + j * k.strides[2]) * k.prc.size();
+            const auto dst = packedKeys.data() + (b * k.dims[1] + h) * D * Lk + j;
+            convertBlock(src, k.prc, dst, 1, D, 0, k.strides[3], 0, Lk, 1.f);
+        });
+    }
+
+    if (packValues) {
+        parallel_for3d(v.dims[0], v.dims[1], Lk, [&](size_t b, size_t h, size_t j) {
+            const auto src = v.data + (b * v.strides[0] + h * v.strides[1] + j * v.strides[2]) * v.prc.size();
+            const auto dst = packedValues.data() + ((b * v.dims[1] + h) * Lk + j) * Dv;
+            convertBlock(src, v.prc, dst, 1, Dv, 0, v.strides[3], 0, 1, 1.f);
+        });
+    }
+}
+
+float MKLDNNScaledAttnNode::expAndSum(float* scores, size_t count, float max) const {
+    float sum = 0.f;
+    size_t tailStart = 0;
+    if (expKernel) {
+        float partialSums[16] = {};
+
+        auto arg = jit_args_scaled_attn_exp();
+        arg.src = scores;
+        arg.dst = scores;
+        arg.max = &max;
+        arg.sum = partialSums;
+        arg.work_amount = count / expBlockSize;
+        (*expKernel)(&arg);
+
+        for (size_t i = 0; i < expBlockSize; i++)
+            sum += partialSums[i];
+        tailStart = arg.work_amount * expBlockSize;
+    }
+
+    for (size_t i = tailStart; i < count; i++) {
+        scores[i] = std::exp(scores[i] - max);
+        sum += scores[i];
+    }
+    return sum;
+}
+
+void MKLDNNScaledAttnNode::execute(mkldnn::stream strm) {
+    const auto q = getTensorView(Q_ID, qOrder);
+    const auto k = getTensorView(K_ID, kOrder);
+    const auto v = getTensorView(V_ID, vOrder);
+    packKeysValues(k, v);
+
+    const auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto outPrc = dstMemPtr->getDesc().getPrecision();
+    auto dst = reinterpret_cast<uint8_t*>(dstMemPtr->GetPtr());
+    const auto& dstDims = dstMemPtr->getStaticDims();
+    const auto dstStrides = getDenseStrides(dstDims);
+
+    // output dimension i holds the dimension outOrder[i] of the logical [B, H, Lq, Dv] result
+    VectorDims outDims(4), outStrides(4);
+    for (size_t i = 0; i < 4; i++) {
+        outDims[outOrder[i]] = dstDims[i];
+        outStrides[outOrder[i]] = dstStrides[i];
+    }
+
+    const size_t B = outDims[0];
+    const size_t H = outDims[1];
+    const size_t Lq = outDims[2];
+    const size_t Dv = outDims[3];
+    const size_t Lk = k.dims[2];
+    const size_t D = k.dims[3];
+
+    // the mask is broadcasted to [B, H, Lq, Lk]
+    const float* mask = nullptr;
+    VectorDims maskStrides(4, 0);
+    if (withMask) {
+        const auto& maskMemPtr = getParentEdgeAt(MASK_ID)->getMemoryPtr();
+        mask = reinterpret_cast<const float*>(maskMemPtr->GetPtr());
+        const auto& maskDims = maskMemPtr->getStaticDims();
+        const auto strides = getDenseStrides(maskDims);
+        for (size_t i = 0; i < maskDims.size(); i++) {
+            maskStrides[4 - maskDims.size() + i] = maskDims[i] == 1 ? 0 : strides[i];
+        }
+    }
+
+    // batch dimensions of the inputs are broadcasted like in MatMul
+    const auto batchOffset = [](const TensorView& t, size_t b, size_t h) {
+        return (t.dims[0] == 1 ? 0 : b) * t.strides[0] + (t.dims[1] == 1 ? 0 : h) * t.strides[1];
+    };
+    const auto packedIndex = [](const TensorView& t, size_t b, size_t h) {
+        return (t.dims[0] == 1 ? 0 : b) * t.dims[1] + (t.dims[1] == 1 ? 0 : h);
+    };
+
+    // element strides of the keys along D and of the values along Lk
+    const size_t keyStride = packKeys ? Lk : k.strides[3];
+    const size_t valueStride = packValues ? Dv : v.strides[2];
+
+    const size_t qBlocks = div_up(Lq, queryBlockSize);
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        std::vector<float> queries(queryBlockSize * D);
+        std::vector<float> scores(keyBlockSize);
+        std::vector<float> acc(queryBlockSize * Dv);
+        std::vector<float> maxs(queryBlockSize);
+        std::vector<float> sums(queryBlockSize);
+
+        for_1d(ithr, nthr, B * H * qBlocks, [&](size_t i) {
+            const size_t q0 = (i % qBlocks) * queryBlockSize;
+            const size_t h = (i / qBlocks) % H;
+            const size_t b = i / qBlocks / H;
+            const size_t mq = std::min(queryBlockSize, Lq - q0);
+
+            // the scale is applied to the queries to avoid scaling of every score
+            const auto src = q.data + (batchOffset(q, b, h) + q0 * q.strides[2]) * q.prc.size();
+            convertBlock(src, q.prc, queries.data(), mq, D, q.strides[2], q.strides[3], D, 1, scale);
+
+            const float* keys = packKeys ? packedKeys.data() + packedIndex(k, b, h) * D * Lk
+                                         : reinterpret_cast<const float*>(k.data) + batchOffset(k, b, h);
+            const float* values = packValues ? packedValues.data() + packedIndex(v, b, h) * Lk * Dv
+                                             : reinterpret_cast<const float*>(v.data) + batchOffset(v, b, h);
+
+            std::fill(maxs.begin(), maxs.end(), -std::numeric_limits<float>::infinity());
+            std::fill(sums.begin(), sums.end(), 0.f);
+            std::fill(acc.begin(), acc.end(), 0.f);
+
+            for (size_t k0 = 0; k0 < Lk; k0 += keyBlockSize) {
+                const size_t nk = std::min(keyBlockSize, Lk - k0);
+                for (size_t r = 0; r < mq; r++) {
+                    float* s = scores.data();
+                    std::fill(s, s + nk, 0.f);
+                    const float* query = &queries[r * D];
+                    for (size_t d = 0; d < D; d++) {
+                        const float qd = query[d];
+                        const float* key = keys + d * keyStride + k0;
+                        for (size_t j = 0; j < nk; j++)
+                            s[j] += qd * key[j];
+                    }
+
+                    if (mask) {
+                        const float* m = mask + b * maskStrides[0] + h * maskStrides[1] + (q0 + r) * maskStrides[2] + k0 * maskStrides[3];
+                        for (size_t j = 0; j < nk; j++)
+                            s[j] += m[j * maskStrides[3]];
+                    }
+
+                    // streaming softmax: rescale the accumulated result if the maximum grows
+                    const float newMax = std::max(maxs[r], *std::max_element(s, s + nk));
+                    if (newMax == -std::numeric_limits<float>::infinity())
+                        continue;
+                    const float correction = std::exp(maxs[r] - newMax);
+                    const float blockSum = expAndSum(s, nk, newMax);
+
+                    float* a = &acc[r * Dv];
+                    if (correction != 1.f) {
+                        for (size_t c = 0; c < Dv; c++)
+                            a[c] *= correction;
+                    }
+                    sums[r] = sums[r] * correction + blockSum;
+                    maxs[r] = newMax;
+
+                    for (size_t j = 0; j < nk; j++) {
+                        const float p = s[j];
+                        const float* value = values + (k0 + j) * valueStride;
+                        for (size_t c = 0; c < Dv; c++)
+                            a[c] += p * value[c];
+                    }
+                }
+            }
+
+            for (size_t r = 0; r < mq; r++) {
+                const size_t offset = b * outStrides[0] + h * outStrides[1] + (q0 + r) * outStrides[2];
+                const float norm = 1.f / sums[r];
+                if (outPrc == Precision::BF16) {
+                    storeRow(&acc[r * Dv], reinterpret_cast<bfloat16_t*>(dst) + offset, Dv, outStrides[3], norm);
+                } else {
+                    storeRow(&acc[r * Dv], reinterpret_cast<float*>(dst) + offset, Dv, outStrides[3], norm);
+                }
+            }
+        });
+    });
+}
+
+bool MKLDNNScaledAttnNode::created() const {
+    return getType() == ScaledDotProductAttention;
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_uni_scaled_attn_exp_kernel;
+
+/**
+ * Executes softmax(scale * Q * K^T + mask) * V without materializing the scores matrix.
+ * The queries are processed by blocks and the keys are streamed by blocks as well:
+ * the running maximum and sum of the softmax are updated per key block and the accumulated
+ * result is rescaled when the maximum changes.
+ */
+class MKLDNNScaledAttnNode : public MKLDNNNode {
+public:
+    MKLDNNScaledAttnNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void prepareParams() override;
+
+private:
+    struct TensorView {
+        const uint8_t* data;
+        InferenceEngine::Precision prc;
+        VectorDims dims;     // logical [B, H, L, D] dimensions
+        VectorDims strides;  // strides of the logical dimensions in elements
+    };
+
+    TensorView getTensorView(size_t port, const std::vector<size_t>& order) const;
+    void packKeysValues(const TensorView& k, const TensorView& v);
+    float expAndSum(float* scores, size_t count, float max) const;
+
+    const size_t Q_ID = 0lu;
+    const size_t K_ID = 1lu;
+    const size_t V_ID = 2lu;
+    const size_t MASK_ID = 3lu;
+
+    const size_t queryBlockSize = 16lu;
+    const size_t keyBlockSize = 128lu;
+
+    float scale = 1.f;
+    std::vector<size_t> qOrder;
+    std::vector<size_t> kOrder;
+    std::vector<size_t> vOrder;
+    std::vector<size_t> outOrder;
+    bool withMask = false;
+
+    // [B, H, D, Lk] keys and [B, H, Lk, Dv] values converted to FP32, used unless the inputs are read in place
+    bool packKeys = true;
+    bool packValues = true;
+    std::vector<float> packedKeys;
+    std::vector<float> packedValues;
+
+    std::shared_ptr<jit_uni_scaled_attn_exp_kernel> expKernel;
+    size_t expBlockSize = 1lu;
+
+    std::string errorPrefix;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
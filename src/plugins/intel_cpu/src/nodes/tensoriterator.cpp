@@ -13,6 +13,7 @@
 #include "utils/ngraph_utils.hpp"
 #include "transformations/utils/utils.hpp"
 #include "common/cpu_memcpy.h"
+#include "concat.h"
 
 using namespace mkldnn;
 using namespace ov::intel_cpu;
@@ -144,6 +145,89 @@ private:
     int iter_count;
 };
 
+/**
+ * Binds the body memory to the chunk of the full tensor instead of copying the chunk.
+ * Applicable when the chunk is a dense part of the full tensor: both tensors have plain layout
+ * and all the dimensions before the iteration axis are equal to 1.
+ */
+class PortViewHelper : public PortMapHelper {
+public:
+    PortViewHelper(const MKLDNNMemoryPtr &full_blob, const std::vector<MKLDNNMemoryPtr> &part_blobs, const PortMap &slice_rule)
+                   : part_blobs(part_blobs) {
+        auto axis = slice_rule.axis;
+        auto stride = slice_rule.stride;
+
+        auto abs_stride = std::abs(stride);
+        auto sign_of_stride = stride < 0.0f ? -1 : 1;
+
+        full_mem = full_blob->GetPrimitive();
+        const auto full_desc = full_mem.get_desc();
+        iter_count = full_desc.dims()[axis] / abs_stride;
+
+        auto elem_size = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(full_desc.data.data_type));
+
+        chunk_stride_in_byte = full_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
+        chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= sign_of_stride;
+    }
+
+    static bool isApplicable(const MKLDNNMemoryPtr &full_blob, const MKLDNNMemoryPtr &part_blob, const PortMap &slice_rule) {
+        const auto &full_desc = full_blob->getDesc();
+        const auto &part_desc = part_blob->getDesc();
+        if (!full_desc.hasLayoutType(LayoutType::ncsp) || full_desc.getPrecision() != part_desc.getPrecision())
+            return false;
+
+        const auto &full_dims = full_blob->getStaticDims();
+        if (std::any_of(full_dims.begin(), full_dims.begin() + slice_rule.axis, [](size_t dim) { return dim != 1; }))
+            return false;
+
+        auto chunk_dims = full_dims;
+        chunk_dims[slice_rule.axis] = std::abs(slice_rule.stride);
+        return part_desc.isCompatible(CpuBlockedMemoryDesc(part_desc.getPrecision(), Shape(chunk_dims)));
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (auto &part_blob : part_blobs)
+            part_blob->setDataHandle(chunk_ptr);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    std::vector<MKLDNNMemoryPtr> part_blobs;
+    mkldnn::memory full_mem;
+
+    int iter_count;
+};
+
+/**
+ * Passes the body output to the next iteration input by swapping their memory buffers
+ * (ping-pong) instead of copying the data.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MKLDNNMemoryPtr &from, const std::vector<MKLDNNMemoryPtr> &to) : from(from), to(to) {}
+
+    void execute(mkldnn::stream strm, int iter = -1) override {
+        if (iter != 0) {
+            auto from_ptr = from->GetData();
+            auto to_ptr = to.front()->GetData();
+
+            from->setDataHandle(to_ptr);
+            for (auto &mem : to)
+                mem->setDataHandle(from_ptr);
+        }
+    }
+
+private:
+    MKLDNNMemoryPtr from;
+    std::vector<MKLDNNMemoryPtr> to;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -223,26 +307,89 @@ private:
     int value;
 };
 
+// Memory of the body input can be replaced only if the body doesn't work in-place with it
+static bool canRebindBodyInput(const MKLDNNNodePtr &input) {
+    for (auto &childEdge : input->getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << input->getName() << " contains empty child edge";
+
+        auto &child = ce->getChild();
+        if (child->isConstant() || child->isInPlace())
+            return false;
+
+        if (child->getType() == Concatenation) {
+            auto concat = dynamic_cast<MKLDNNConcatNode*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+
+        // Split is using different ptrs without offsets
+        if (child->getType() == Split)
+            return false;
+
+        for (auto &edge : child->getChildEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == ce->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+// Memory of the body output can be replaced only if it isn't shared with other nodes of the body
+static bool canRebindBodyOutput(const MKLDNNNodePtr &output) {
+    auto parentEdge = output->getParentEdgeAt(0);
+    void* defaultPtr = parentEdge->getMemory().GetData();
+
+    auto parent = parentEdge->getParent();
+    MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+            return false;
+
+        for (auto &edge : parent->getParentEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+
+    return parent->getType() != Input;
+}
+
 DynamicBuffer::DynamicBuffer(const MKLDNNMemoryPtr &from_, const std::vector<MKLDNNMemoryPtr> &to_,
                              const PortMap &map_rule_) : from(from_), to(to_), map_rule(map_rule_) {
     elem_size = MKLDNNExtensionUtils::sizeOfDataType(from->GetDataType());
 }
 
-void DynamicBuffer::execute(const mkldnn::engine& eng, const int iter) {
+void DynamicBuffer::execute(const mkldnn::engine& eng, const int iter, const int expected_iter_count) {
     if (iter == 0) {
-        init(eng);
+        init(eng, expected_iter_count);
         return;
     }
 
-    auto new_buffer = create_buffer(eng);
-    move_buffer(new_buffer);
+    if (from->getStaticDims()[map_rule.axis] != std::abs(map_rule.stride))
+        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << std::abs(map_rule.stride) <<
+        " is expected, but actual: " << from->getStaticDims()[map_rule.axis];
+
+    if (num_execs == max_execs) {
+        const auto new_max_execs = max_execs * 2;
+        move_buffer(create_buffer(eng, new_max_execs), new_max_execs);
+    }
     move_data();
 }
 
-void DynamicBuffer::init(const mkldnn::engine& eng) {
-    chunk_offset_in_byte = 0;
-    buffer_offset_in_byte = 0;
-
+void DynamicBuffer::init(const mkldnn::engine& eng, const int expected_iter_count) {
     const auto axis = map_rule.axis;
     const auto stride = map_rule.stride;
     const auto abs_stride = std::abs(stride);
@@ -257,60 +404,62 @@ void DynamicBuffer::init(const mkldnn::engine& eng) {
 
     count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, 1, std::multiplies<size_t>());
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
-    mem_holder_buffer.reset(new memory(src_desc, eng));
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()), 0, 0, 1, from->GetSize());
+    chunk_unit_in_byte = abs_stride * len;
+
+    num_execs = 0;
+    max_execs = expected_iter_count > 0 ? static_cast<size_t>(expected_iter_count) : 1lu;
+    mem_holder_buffer = create_buffer(eng, max_execs);
+    move_data();
 }
 
-std::shared_ptr<mkldnn::memory> DynamicBuffer::create_buffer(const mkldnn::engine& eng) {
+std::shared_ptr<mkldnn::memory> DynamicBuffer::create_buffer(const mkldnn::engine& eng, const size_t new_max_execs) {
     const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
+    const auto abs_stride = std::abs(map_rule.stride);
 
-    const auto old_desc = mem_holder_buffer->get_desc();
-    auto dims = old_desc.dims();
-
-    if (from->getStaticDims()[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-        " is expected, but actual: " << from->getStaticDims()[axis];
-
-    dims[axis] += abs_stride;
-    mkldnn::memory::desc new_buffer_desc(dims, old_desc.data_type(), MKLDNNExtensionUtils::GetPlainFormatByRank(dims.size()));
-
-    if (stride > 0.0f) {
-        chunk_offset_in_byte += new_buffer_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    } else {
-        buffer_offset_in_byte = from->GetPrimitive().get_desc().data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    }
+    auto dims = from->GetPrimitive().get_desc().dims();
+    dims[axis] = new_max_execs * abs_stride;
+    mkldnn::memory::desc new_buffer_desc(dims, from->GetDataType(), MKLDNNExtensionUtils::GetPlainFormatByRank(dims.size()));
 
     return std::make_shared<mkldnn::memory>(new_buffer_desc, eng);
 }
 
-void DynamicBuffer::move_buffer(std::shared_ptr<mkldnn::memory> new_buffer) {
-    const auto axis = map_rule.axis;
-    const auto src_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-    const auto dst_stride = new_buffer->get_desc().dims()[axis] * len;
+void DynamicBuffer::move_buffer(std::shared_ptr<mkldnn::memory> new_buffer, const size_t new_max_execs) {
+    const auto src_stride = max_execs * chunk_unit_in_byte;
+    const auto dst_stride = new_max_execs * chunk_unit_in_byte;
+    const auto valid_size = num_execs * chunk_unit_in_byte;
+
+    // chunks are placed from the beginning of the buffer for the positive stride and from the end for the negative one
+    const auto src_offset = map_rule.stride > 0 ? 0 : src_stride - valid_size;
+    const auto dst_offset = map_rule.stride > 0 ? 0 : dst_stride - valid_size;
 
-    copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()) + buffer_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+    copy(get_ptr(*mem_holder_buffer.get()) + src_offset, get_ptr(*new_buffer.get()) + dst_offset,
+         src_stride, dst_stride, count, valid_size);
     mem_holder_buffer = new_buffer;
+    max_execs = new_max_execs;
 }
 
 void DynamicBuffer::move_data() {
-    const auto axis = map_rule.axis;
-    const auto src_stride = abs(map_rule.stride) * len;
-    const auto dst_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
+    const auto dst_stride = max_execs * chunk_unit_in_byte;
+    const auto chunk_idx = map_rule.stride > 0 ? num_execs : max_execs - 1 - num_execs;
 
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_idx * chunk_unit_in_byte,
+         chunk_unit_in_byte, dst_stride, count, chunk_unit_in_byte);
+    num_execs++;
 }
 
 void DynamicBuffer::transfer(const MKLDNNNode* node) {
     if (mem_holder_buffer) {
-        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
-                MKLDNNExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims()));
+        auto dims = MKLDNNExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims());
+        dims[map_rule.axis] = num_execs * std::abs(map_rule.stride);
+        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(dims);
         redefineToMemories(to, desc);
 
-        copy(get_ptr(*mem_holder_buffer.get()), reinterpret_cast<uint8_t*>(to.front()->GetPtr()), 0, 0, 1, to.front()->GetSize());
+        const auto src_stride = max_execs * chunk_unit_in_byte;
+        const auto dst_stride = num_execs * chunk_unit_in_byte;
+        const auto src_offset = map_rule.stride > 0 ? 0 : src_stride - dst_stride;
+
+        copy(get_ptr(*mem_holder_buffer.get()) + src_offset, reinterpret_cast<uint8_t*>(to.front()->GetPtr()),
+             src_stride, dst_stride, count, dst_stride);
     } else {
         VectorDims newDims = to.front()->GetShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -373,6 +522,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            input_nodes.push_back(inNode->second);
         }
     }
 
@@ -384,6 +534,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_nodes.push_back(outNode->second);
         }
     }
 
@@ -545,6 +696,8 @@ void MKLDNNTensorIteratorNode::executeDynamicImpl(mkldnn::stream strm) {
 
     bool continue_cond = initial_cond_check->getStatus();
     int max_num_iter = trip_count_check->getStatus();
+    // the number of iterations is known in advance only if the body has no condition output
+    int expected_iter_count = loopBodyConditionOutputIdx == -1 ? max_num_iter : -1;
 
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
@@ -562,7 +715,7 @@ void MKLDNNTensorIteratorNode::executeDynamicImpl(mkldnn::stream strm) {
         continue_cond = continue_cond_check->getStatus();
 
         for (auto& buffer : buffers)
-            buffer->execute(eng, i);
+            buffer->execute(eng, i, expected_iter_count);
 
         // on the last iteration we shouldn't reshape body inputs and init back edges
         if ((i + 1 != max_num_iter) && continue_cond)
@@ -582,6 +735,9 @@ void MKLDNNTensorIteratorNode::prepareInputPorts() {
 
         if (map_rule.axis == -1)
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        else if (!isDynamicNode() && PortViewHelper::isApplicable(from_mem, to_mem, map_rule) &&
+                 canRebindBodyInput(input_nodes[map_rule.to]))
+            before_mappers.emplace_back(std::make_shared<PortViewHelper>(from_mem, input_mems[map_rule.to], map_rule));
         else
             before_mappers.emplace_back(
                     std::make_shared<PortIteratorHelper>(from_mem, to_mem, true, map_rule, eng));
@@ -596,6 +752,10 @@ void MKLDNNTensorIteratorNode::prepareOutputPorts() {
 
         if (map_rule.axis == -1)
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        else if (isExclusiveBodyOutput(map_rule.to) && PortViewHelper::isApplicable(to_mem, from_mem, map_rule) &&
+                 canRebindBodyOutput(output_nodes[map_rule.to]))
+            // the body writes the chunk directly to the output, so the view is bound before the iteration
+            before_mappers.emplace_back(std::make_shared<PortViewHelper>(to_mem, std::vector<MKLDNNMemoryPtr>{from_mem}, map_rule));
         else
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(from_mem, to_mem, false, map_rule, eng));
     }
@@ -605,12 +765,29 @@ void MKLDNNTensorIteratorNode::prepareBackEdges() {
     const auto &eng = getEngine();
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
-        auto to_mem = input_mems[map_rule.to].front();
+        auto &to_mems = input_mems[map_rule.to];
+        auto to_mem = to_mems.front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        if (isExclusiveBodyOutput(map_rule.from) && from_mem->getDesc().isCompatible(to_mem->getDesc()) &&
+            from_mem->GetData() != to_mem->GetData() &&
+            canRebindBodyOutput(output_nodes[map_rule.from]) && canRebindBodyInput(input_nodes[map_rule.to]))
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_mem, to_mems));
+        else
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
     }
 }
 
+// The body output may be rebound if it is the source of only one back edge or one concatenated output
+bool MKLDNNTensorIteratorNode::isExclusiveBodyOutput(const int body_output_idx) const {
+    const auto concat_uses = std::count_if(outputPortMap.begin(), outputPortMap.end(), [&](const PortMap& rule) {
+        return rule.to == body_output_idx && rule.axis != -1;
+    });
+    const auto back_edge_uses = std::count_if(backEdges.begin(), backEdges.end(), [&](const PortMap& rule) {
+        return rule.from == body_output_idx;
+    });
+    return concat_uses + back_edge_uses == 1;
+}
+
 void MKLDNNTensorIteratorNode::prepareDynamicBackEdges() {
     const auto &eng = getEngine();
     back_mappers.clear();
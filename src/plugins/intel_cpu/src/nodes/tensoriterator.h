@@ -59,22 +59,24 @@ protected:
 
 /**
  * Class for storing intermediate output buffer state for dynamism when we don't know
- * final output shape but we should concatenate output after each iteration
+ * final output shape but we should concatenate output after each iteration.
+ * The buffer capacity grows geometrically, so the already concatenated data is moved
+ * only a logarithmic number of times over the loop.
  */
 class DynamicBuffer {
 public:
     DynamicBuffer(const MKLDNNMemoryPtr &from_, const std::vector<MKLDNNMemoryPtr> &to_, const PortMap &map_rule_);
     ~DynamicBuffer() = default;
 
-    void execute(const mkldnn::engine& eng, const int iter);
+    void execute(const mkldnn::engine& eng, const int iter, const int expected_iter_count = -1);
     void transfer(const MKLDNNNode* node);
 
 private:
-    void init(const mkldnn::engine& eng);
+    void init(const mkldnn::engine& eng, const int expected_iter_count);
 
     /* methods for resize and refill buffer */
-    std::shared_ptr<mkldnn::memory> create_buffer(const mkldnn::engine& eng);
-    void move_buffer(std::shared_ptr<mkldnn::memory> new_buffer);
+    std::shared_ptr<mkldnn::memory> create_buffer(const mkldnn::engine& eng, const size_t new_max_execs);
+    void move_buffer(std::shared_ptr<mkldnn::memory> new_buffer, const size_t new_max_execs);
     void move_data();
 
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
@@ -83,8 +85,9 @@ private:
     size_t len = 1lu;
     size_t count = 1lu;
     size_t elem_size = 0lu;
-    ptrdiff_t chunk_offset_in_byte = 0;
-    ptrdiff_t buffer_offset_in_byte = 0;
+    size_t chunk_unit_in_byte = 0lu;  /**< size of one chunk along the axis in the single "count" row */
+    size_t num_execs = 0lu;           /**< number of chunks stored in the buffer */
+    size_t max_execs = 0lu;           /**< number of chunks the buffer can store without reallocation */
 
     MKLDNNMemoryPtr from;
     std::vector<MKLDNNMemoryPtr> to;
@@ -126,6 +129,7 @@ private:
     void prepareContinueCond();
     void prepareInitialCond();
     void prepareTripCount();
+    bool isExclusiveBodyOutput(const int body_output_idx) const;
 
     /* Dynamic support */
     void reshapeSubgraphInput();
@@ -136,6 +140,8 @@ private:
     MKLDNNGraph sub_graph;
     std::vector<std::vector<MKLDNNMemoryPtr>> input_mems;
     std::vector<MKLDNNMemoryPtr> output_mem;
+    std::vector<MKLDNNNodePtr> input_nodes;
+    std::vector<MKLDNNNodePtr> output_nodes;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
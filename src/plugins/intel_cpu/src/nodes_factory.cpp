@@ -85,6 +85,7 @@
 #include "nodes/subgraph.h"
 #include "nodes/priorbox.h"
 #include "nodes/priorbox_clustered.h"
+#include "nodes/scaled_attn.h"
 
 #define MKLDNN_NODE(__prim, __type) \
     registerNodeIfRequired(intel_cpu, __prim, __type, MKLDNNNodeImpl<__prim>)
@@ -178,4 +179,5 @@ ov::intel_cpu::MKLDNNNode::NodesFactory::NodesFactory()
     MKLDNN_NODE(MKLDNNColorConvertNode, ColorConvert);
     MKLDNN_NODE(MKLDNNPriorBoxNode, PriorBox);
     MKLDNN_NODE(MKLDNNPriorBoxClusteredNode, PriorBoxClustered);
+    MKLDNN_NODE(MKLDNNScaledAttnNode, ScaledDotProductAttention);
 }
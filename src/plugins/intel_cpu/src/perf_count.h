@@ -7,6 +7,8 @@
 #include <chrono>
 #include <ratio>
 
+#include "utils/hw_perf_counters.h"
+
 namespace ov {
 namespace intel_cpu {
 
@@ -17,6 +19,10 @@ class PerfCount {
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
+    HwCounterValues total_hw;
+    HwCounterValues __hw_start;
+    uint32_t hw_num = 0;
+
 public:
     PerfCount(): total_duration(0), num(0) {}
 
@@ -26,12 +32,21 @@ public:
 
     uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
 
+    // average hardware counters of the thread which executed the node, zero if they were not collected
+    HwCounterValues hwAvg() const { return total_hw / hw_num; }
+
 private:
-    void start_itr() {
+    void start_itr(const HwPerfCounters* hw) {
         __start = std::chrono::high_resolution_clock::now();
+        if (hw)
+            __hw_start = hw->read();
     }
 
-    void finish_itr() {
+    void finish_itr(const HwPerfCounters* hw) {
+        if (hw) {
+            total_hw += hw->read() - __hw_start;
+            hw_num++;
+        }
         __finish = std::chrono::high_resolution_clock::now();
         total_duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
         num++;
@@ -42,15 +57,18 @@ private:
 
 class PerfHelper {
     PerfCount &counter;
+    const HwPerfCounters* hwCounters;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    explicit PerfHelper(PerfCount &count, const HwPerfCounters* hw = nullptr): counter(count), hwCounters(hw) {
+        counter.start_itr(hwCounters);
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() { counter.finish_itr(hwCounters); }
 };
 
 }   // namespace intel_cpu
 }   // namespace ov
 
-#define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
-#define PERF(_node, _need) auto pc = _need ? GET_PERF(_node) : nullptr;
+#define GET_PERF(_node, _hw) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter(), _hw))
+#define PERF(_node, _need, _hw) auto pc = _need ? GET_PERF(_node, _hw) : nullptr;
@@ -11,6 +11,7 @@
 #include "serialize.h"
 
 #include <threading/ie_executor_manager.hpp>
+#include <cpp/ie_infer_request.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
@@ -19,7 +20,11 @@
 #include <vector>
 #include <tuple>
 #include <unordered_set>
+#include <set>
+#include <chrono>
+#include <cstring>
 #include <ie_system_conf.h>
+#include <ie_tracer.hpp>
 #include <nodes/list.hpp>
 #include <ie_ngraph_utils.hpp>
 
@@ -116,6 +121,9 @@
 #include "nodes/normalize.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
+#include "ngraph_transformations/keep_embedding_table_decompression.hpp"
+#include "ngraph_transformations/keep_matmul_weights_decompression.hpp"
+#include "ngraph_transformations/scaled_attn_fusion.hpp"
 #include "transformations/smart_reshape/smart_reshape.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
@@ -163,6 +171,8 @@ Engine::Engine() :
     deviceFullName(getDeviceFullName()) {
     _pluginName = "CPU";
     extensionManager->AddExtension(std::make_shared<ov::intel_cpu::MKLDNNExtension>());
+    // the plugin has own copy of the itt library, so its tasks are passed to the profilers of the runtime explicitly
+    openvino::itt::setTaskListener(&ov::runtimeTaskListener());
 }
 
 Engine::~Engine() {
@@ -172,7 +182,8 @@ Engine::~Engine() {
 }
 
 static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT,
-                                               const bool _enableSnippets, const bool isLegacyApi) {
+                                               const bool _enableSnippets, const bool _enableScaledAttnFusion,
+                                               const bool isLegacyApi) {
     ngraph::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -192,6 +203,11 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         }
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(defaultPrecisions);
     }
+    manager.register_pass<KeepEmbeddingTableDecompression>();
+    // the compressed weights dequantization of the quantized models is handled by LPT
+    if (!useLpt && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+        manager.register_pass<KeepMatMulWeightsDecompression>();
+    }
     auto get_convert_precisions = []() {
         precisions_array array = {
             {ngraph::element::i64,     ngraph::element::i32},
@@ -508,6 +524,11 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     });
 
     postLPTPassManager.register_pass<ngraph::pass::ConstantFolding>();
+    // the products of the attention node are not JIT-ed yet, so the fusion is enabled on demand only
+    if (_enableScaledAttnFusion && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+        // runs after constant folding, so the scale of the scores is a single constant
+        postLPTPassManager.register_pass<ScaledAttnFusion>();
+    }
     postLPTPassManager.run_passes(nGraphFunc);
 
     if (!useLpt && _enableSnippets && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
@@ -539,9 +560,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     }
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets, const bool isLegacyApi) {
+static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const bool _enableSnippets,
+                           const bool _enableScaledAttnFusion, const bool isLegacyApi) {
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, isLegacyApi);
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT, _enableSnippets, _enableScaledAttnFusion, isLegacyApi);
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
@@ -631,6 +653,90 @@ void Engine::ApplyPerformanceHints(std::map<std::string, std::string> &config, c
     }
 }
 
+static double measureThroughput(const InferenceEngine::IExecutableNetworkInternal::Ptr& execNetwork, const int numRequests) {
+    // a few iterations are enough to compare the configurations as the same work is timed for each of them
+    const int numIterations = 4;
+
+    std::vector<IInferRequestInternal::Ptr> requests;
+    for (int i = 0; i < numRequests; i++) {
+        auto request = execNetwork->CreateInferRequest();
+        for (const auto& input : execNetwork->GetInputsInfo()) {
+            auto blob = as<MemoryBlob>(request->GetBlob(input.first));
+            if (blob) {
+                auto data = blob->wmap();
+                std::memset(data.as<uint8_t*>(), 0, blob->byteSize());
+            }
+        }
+        requests.push_back(request);
+    }
+
+    auto inferAll = [&requests]() {
+        for (auto& request : requests)
+            request->StartAsync();
+        for (auto& request : requests)
+            request->Wait(InferRequest::WaitMode::RESULT_READY);
+    };
+
+    // the first inference initializes the primitives and the memory, so it is not timed
+    inferAll();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numIterations; i++)
+        inferAll();
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+    return numRequests * numIterations / duration.count();
+}
+
+void Engine::CalibrateStreams(Config& conf, const CNNNetwork& network, const CNNNetwork& clonedNetwork) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Engine::CalibrateStreams");
+
+    auto streamsConfig = [](int streams, int threads) {
+        return std::map<std::string, std::string>{{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streams)},
+                                                  {PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(threads)}};
+    };
+
+    const int numCores = getNumberOfCPUCores();
+    const int numThreads = parallel_get_max_threads();
+    int maxStreams = numCores;
+    if (conf.perfHintsConfig.ovPerfHintNumRequests > 0)
+        maxStreams = std::min(maxStreams, conf.perfHintsConfig.ovPerfHintNumRequests);
+
+    // candidate (streams, threads) pairs: powers of two and the heuristic choice of streams,
+    // with or without the hyper-threading
+    std::set<std::pair<int, int>> candidates;
+    auto addCandidate = [&](int streams) {
+        if (streams < 1 || streams > maxStreams)
+            return;
+        candidates.emplace(streams, numCores);
+        candidates.emplace(streams, numThreads);
+    };
+    for (int streams = 1; streams <= maxStreams; streams *= 2)
+        addCandidate(streams);
+    addCandidate(maxStreams);
+    addCandidate(conf.streamExecutorConfig._streams);
+
+    std::pair<int, int> best{conf.streamExecutorConfig._streams, conf.streamExecutorConfig._threads};
+    double bestThroughput = 0.0;
+    for (const auto& candidate : candidates) {
+        Config candidateConf = conf;
+        candidateConf.readProperties(streamsConfig(candidate.first, candidate.second));
+
+        auto execNetwork = std::make_shared<MKLDNNExecNetwork>(clonedNetwork, candidateConf, extensionManager, weightsSharing,
+                                                               shared_from_this());
+        execNetwork->setNetworkInputs(network.getInputsInfo());
+        execNetwork->setNetworkOutputs(network.getOutputsInfo());
+        SetExeNetworkInfo(execNetwork, network.getFunction());
+
+        const auto throughput = measureThroughput(execNetwork, candidate.first);
+        if (throughput > bestThroughput) {
+            bestThroughput = throughput;
+            best = candidate;
+        }
+    }
+
+    conf.readProperties(streamsConfig(best.first, best.second));
+}
+
 InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Engine::LoadExeNetworkImpl");
@@ -673,12 +779,21 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !(enableModelCache || enableDynamicBatch || enableBF16);
+    const auto& scaledAttnProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_CPU_SCALED_ATTN_FUSION);
+    const bool enableScaledAttnFusion = scaledAttnProp != config.end() ? scaledAttnProp->second == PluginConfigParams::YES
+                                                                       : engConfig.scaledAttnFusion;
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, isLegacyAPI());
+    {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CommonTransformations");
+        TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets, enableScaledAttnFusion, isLegacyAPI());
+    }
 
     ApplyPerformanceHints(config, nGraphFunc);
 
-    ConvertToCPUSpecificOpset(nGraphFunc);
+    {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "ConvertToCPUSpecificOpset");
+        ConvertToCPUSpecificOpset(nGraphFunc);
+    }
 
     // update the props after the perf mode translated to configs
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
@@ -689,6 +804,16 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    const bool calibrateStreams = conf.streamsCalibration &&
+            conf.perfHintsConfig.ovPerfHint == CONFIG_VALUE(THROUGHPUT) &&
+            !(streamsSet(orig_config) || streamsExplicitlySetForEngine) &&
+            !(conf.exclusiveAsyncRequests || conf.enableDynamicBatch || nGraphFunc->is_dynamic());
+    if (calibrateStreams) {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CalibrateStreams");
+        CalibrateStreams(conf, network, clonedNetwork);
+    }
+
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CreateExecNetwork");
     return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing, shared_from_this());
 }
 
@@ -756,6 +881,14 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = engConfig.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::weights_placement) {
+        return decltype(ov::intel_cpu::weights_placement)::value_type(engConfig.weightsPlacement);
+    } else if (name == ov::intel_cpu::streams_calibration) {
+        return decltype(ov::intel_cpu::streams_calibration)::value_type(engConfig.streamsCalibration);
+    } else if (name == ov::intel_cpu::hw_perf_counters) {
+        return decltype(ov::intel_cpu::hw_perf_counters)::value_type(engConfig.hwPerfCounters);
+    } else if (name == ov::intel_cpu::sparse_weights_rate) {
+        return decltype(ov::intel_cpu::sparse_weights_rate)::value_type(engConfig.sparseWeightsRate);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -773,6 +906,7 @@ Parameter Engine::GetMetricLegacy(const std::string& name, const std::map<std::s
             METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
             METRIC_KEY(RANGE_FOR_STREAMS),
             METRIC_KEY(IMPORT_EXPORT_SUPPORT),
+            ov::intel_cpu::weights_memory_per_numa_node.name(),
         };
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
@@ -804,6 +938,8 @@ Parameter Engine::GetMetricLegacy(const std::string& name, const std::map<std::s
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
     } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
         IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if (name == ov::intel_cpu::weights_memory_per_numa_node) {
+        return decltype(ov::intel_cpu::weights_memory_per_numa_node)::value_type(weightsSharing.getMemoryUsage());
     }
 
     IE_CPU_PLUGIN_THROW() << "Unsupported metric key: " << name;
@@ -827,6 +963,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RO_property(ov::range_for_streams.name()),
                                                     RO_property(ov::device::full_name.name()),
                                                     RO_property(ov::device::capabilities.name()),
+                                                    RO_property(ov::intel_cpu::weights_memory_per_numa_node.name()),
                                                     RO_property(ov::cache_dir.name())   // WA Can be removed after implementing snippet serialization.
         };
         // the whole config is RW before network is loaded.
@@ -837,6 +974,10 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::hint::inference_precision.name()),
                                                     RW_property(ov::hint::performance_mode.name()),
                                                     RW_property(ov::hint::num_requests.name()),
+                                                    RW_property(ov::intel_cpu::weights_placement.name()),
+                                                    RW_property(ov::intel_cpu::streams_calibration.name()),
+                                                    RW_property(ov::intel_cpu::hw_perf_counters.name()),
+                                                    RW_property(ov::intel_cpu::sparse_weights_rate.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -903,7 +1044,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
                                || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled */;
         const bool enableSnippets = !(conf.cache_dir.empty() || conf.enableDynamicBatch || (conf.enforceBF16
                 && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)));
-        Transformation(clonedNetwork, enableLPT, enableSnippets, isLegacyAPI());
+        Transformation(clonedNetwork, enableLPT, enableSnippets, conf.scaledAttnFusion, isLegacyAPI());
         auto ops = clonedNetwork.getFunction()->get_ordered_ops();
         std::unordered_set<std::string> supported;
         std::unordered_set<std::string> unsupported;
@@ -981,6 +1122,9 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
 
     Config conf = engConfig;
     conf.readProperties(config);
+    // the streams calibrated at the compilation time are restored unless they are set explicitly
+    if (conf.streamsCalibration && !(streamsSet(config) || streamsExplicitlySetForEngine))
+        conf.readProperties(deserializer.getRuntimeConfig());
 
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
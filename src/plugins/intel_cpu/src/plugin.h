@@ -50,6 +50,8 @@ private:
 
     void ApplyPerformanceHints(std::map<std::string, std::string> &config, const std::shared_ptr<ngraph::Function>& ngraphFunc) const;
 
+    void CalibrateStreams(Config& conf, const InferenceEngine::CNNNetwork& network, const InferenceEngine::CNNNetwork& clonedNetwork);
+
     Config engConfig;
     NumaNodesWeights weightsSharing;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
@@ -67,9 +67,11 @@ namespace {
     }
 };  // namespace
 
-CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager)
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager,
+                                           const std::map<std::string, std::string> & runtimeConfig)
     : _ostream(ostream)
-    , _extensionManager(extensionManager) {
+    , _extensionManager(extensionManager)
+    , _runtimeConfig(runtimeConfig) {
 }
 
 void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
@@ -115,6 +117,17 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
                     .set_value(to_string(out.second->getLayout()).c_str());
         }
 
+        if (!_runtimeConfig.empty()) {
+            pugi::xml_node config = root.append_child("config");
+            for (const auto & item : _runtimeConfig) {
+                auto item_node = config.append_child("item");
+                item_node.append_attribute("key")
+                        .set_value(item.first.c_str());
+                item_node.append_attribute("value")
+                        .set_value(item.second.c_str());
+            }
+        }
+
         xml_doc.save(stream);
     };
 
@@ -172,6 +185,20 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     setPrecisionsAndLayouts(inputs.children("in"), network.getInputsInfo());
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
+
+    _runtimeConfig.clear();
+    for (auto item : root.child("config").children("item")) {
+        auto key_attr = item.attribute("key");
+        auto value_attr = item.attribute("value");
+        if (!key_attr || !value_attr) {
+            IE_THROW(NetworkNotRead) << "The runtime configuration is invalid.";
+        }
+        _runtimeConfig[key_attr.value()] = value_attr.value();
+    }
+}
+
+const std::map<std::string, std::string> & CNNNetworkDeserializer::getRuntimeConfig() const {
+    return _runtimeConfig;
 }
 
 }   // namespace intel_cpu
@@ -6,6 +6,8 @@
 
 #include <iostream>
 #include <functional>
+#include <map>
+#include <string>
 #include <cpp/ie_cnn_network.h>
 
 namespace ov {
@@ -13,12 +15,15 @@ namespace intel_cpu {
 
 class CNNNetworkSerializer {
 public:
-    CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager);
+    CNNNetworkSerializer(std::ostream & ostream, MKLDNNExtensionManager::Ptr extensionManager,
+                         const std::map<std::string, std::string> & runtimeConfig = {});
     void operator << (const InferenceEngine::CNNNetwork & network);
 
 private:
     std::ostream & _ostream;
     MKLDNNExtensionManager::Ptr _extensionManager;
+    // configuration chosen at the compilation time to be restored on import (e.g. the calibrated streams)
+    std::map<std::string, std::string> _runtimeConfig;
 };
 
 class CNNNetworkDeserializer {
@@ -29,10 +34,12 @@ public:
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
+    const std::map<std::string, std::string> & getRuntimeConfig() const;
 
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    std::map<std::string, std::string> _runtimeConfig;
 };
 
 // const std::string& model, const Blob::CPtr& weights
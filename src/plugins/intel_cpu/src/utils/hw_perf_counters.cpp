@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hw_perf_counters.h"
+
+#include <cstring>
+#include <memory>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+#ifdef __linux__
+namespace {
+
+int openPerfEvent(uint32_t type, uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    // the group is enabled at once when all the counters are opened
+    attr.disabled = groupFd == -1 ? 1 : 0;
+    attr.exclude_kernel = type == PERF_TYPE_HARDWARE ? 1 : 0;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    // pid 0 and cpu -1 count the calling thread on any CPU
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC));
+}
+
+}  // namespace
+#endif
+
+HwPerfCounters* HwPerfCounters::forCurrentThread() {
+#ifdef __linux__
+    static thread_local std::unique_ptr<HwPerfCounters> counters;
+    static thread_local bool opened = false;
+    if (!opened) {
+        opened = true;
+        std::unique_ptr<HwPerfCounters> group(new HwPerfCounters);
+        const struct {
+            uint32_t type;
+            uint64_t config;
+        } events[COUNTERS_NUM] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK},
+        };
+        for (int i = 0; i < COUNTERS_NUM; i++) {
+            const int fd = openPerfEvent(events[i].type, events[i].config, group->fds[CYCLES]);
+            if (fd < 0) {
+                if (i == CYCLES)
+                    return nullptr;
+                continue;
+            }
+            group->fds[i] = fd;
+            group->positions[i] = group->openedNum++;
+        }
+        if (ioctl(group->fds[CYCLES], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0)
+            return nullptr;
+        counters = std::move(group);
+    }
+    return counters.get();
+#else
+    return nullptr;
+#endif
+}
+
+HwCounterValues HwPerfCounters::read() const {
+    HwCounterValues values;
+#ifdef __linux__
+    // the number of the counters followed by their values
+    uint64_t buffer[1 + COUNTERS_NUM] = {};
+    if (::read(fds[CYCLES], buffer, sizeof(buffer)) <= 0)
+        return values;
+    auto value = [&](Counter counter) {
+        return positions[counter] >= 0 && static_cast<uint64_t>(positions[counter]) < buffer[0] ?
+               buffer[1 + positions[counter]] : 0;
+    };
+    values.cycles = value(CYCLES);
+    values.instructions = value(INSTRUCTIONS);
+    values.llcMisses = value(LLC_MISSES);
+    values.taskClockNs = value(TASK_CLOCK);
+#endif
+    return values;
+}
+
+HwPerfCounters::~HwPerfCounters() {
+#ifdef __linux__
+    for (int i = COUNTERS_NUM - 1; i >= 0; i--) {
+        if (fds[i] >= 0)
+            close(fds[i]);
+    }
+#endif
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace ov {
+namespace intel_cpu {
+
+struct HwCounterValues {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llcMisses = 0;
+    uint64_t taskClockNs = 0;
+
+    HwCounterValues& operator+=(const HwCounterValues& rhs) {
+        cycles += rhs.cycles;
+        instructions += rhs.instructions;
+        llcMisses += rhs.llcMisses;
+        taskClockNs += rhs.taskClockNs;
+        return *this;
+    }
+
+    HwCounterValues operator-(const HwCounterValues& rhs) const {
+        HwCounterValues result;
+        result.cycles = cycles - rhs.cycles;
+        result.instructions = instructions - rhs.instructions;
+        result.llcMisses = llcMisses - rhs.llcMisses;
+        result.taskClockNs = taskClockNs - rhs.taskClockNs;
+        return result;
+    }
+
+    HwCounterValues operator/(uint64_t divisor) const {
+        HwCounterValues result;
+        if (divisor != 0) {
+            result.cycles = cycles / divisor;
+            result.instructions = instructions / divisor;
+            result.llcMisses = llcMisses / divisor;
+            result.taskClockNs = taskClockNs / divisor;
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Group of the perf_event counters (cycles, instructions, last level cache misses and task clock)
+ * of the calling thread, read with a single system call.
+ * The counters are opened in the user space only mode, so they are available with the default
+ * perf_event_paranoid setting. The counters which are not supported by the CPU (e.g. in a virtual machine) read zero.
+ */
+class HwPerfCounters {
+public:
+    /**
+     * @brief Returns the counters of the calling thread, opened on the first call in the thread
+     * @return nullptr if the cycles counter can't be opened (not Linux, no PMU or the access is forbidden)
+     */
+    static HwPerfCounters* forCurrentThread();
+
+    HwCounterValues read() const;
+
+    ~HwPerfCounters();
+
+private:
+    HwPerfCounters() = default;
+    HwPerfCounters(const HwPerfCounters&) = delete;
+    HwPerfCounters& operator=(const HwPerfCounters&) = delete;
+
+    enum Counter { CYCLES, INSTRUCTIONS, LLC_MISSES, TASK_CLOCK, COUNTERS_NUM };
+
+    int fds[COUNTERS_NUM] = {-1, -1, -1, -1};
+    // positions of the counters in the values read from the group, -1 if the counter is not opened
+    int positions[COUNTERS_NUM] = {-1, -1, -1, -1};
+    int openedNum = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
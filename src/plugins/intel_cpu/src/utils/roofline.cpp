@@ -0,0 +1,253 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "roofline.h"
+
+#include "graph.h"
+#include "ie_parallel.hpp"
+#include "utils/hw_perf_counters.h"
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr double cacheLineSize = 64.0;
+// must be much larger than the last level cache
+constexpr size_t bandwidthBufferSize = 256 * 1024 * 1024;
+
+double flopsPerCycle() {
+    using namespace dnnl::impl::cpu::x64;
+    // single precision FMA on two ports
+    if (mayiuse(avx512_core))
+        return 64;
+    if (mayiuse(avx2))
+        return 32;
+    return 8;
+}
+
+double measureFrequencyGHz() {
+    auto counters = HwPerfCounters::forCurrentThread();
+    if (!counters)
+        return 0;
+    const auto start = counters->read();
+    const auto startTime = std::chrono::steady_clock::now();
+    volatile uint64_t sink = 0;
+    uint64_t state = 1;
+    do {
+        for (int i = 0; i < 100000; i++)
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+    } while (std::chrono::steady_clock::now() - startTime < std::chrono::milliseconds(20));
+    sink = state;
+    const auto elapsed = counters->read() - start;
+    // the task clock excludes the time the thread was preempted
+    return elapsed.taskClockNs ? static_cast<double>(elapsed.cycles) / elapsed.taskClockNs : 0;
+}
+
+double measureBandwidthGBs(int threads) {
+    const size_t size = bandwidthBufferSize / sizeof(uint64_t);
+    std::unique_ptr<uint64_t[]> buffer(new uint64_t[size]);
+    std::vector<uint64_t> sums(threads, 0);
+    // the first touch by the reading threads places the pages on their NUMA nodes
+    InferenceEngine::parallel_nt(threads, [&](int ithr, int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(size, nthr, ithr, start, end);
+        std::fill(buffer.get() + start, buffer.get() + end, static_cast<uint64_t>(ithr));
+    });
+    double bestNs = 0;
+    for (int repeat = 0; repeat < 3; repeat++) {
+        const auto startTime = std::chrono::steady_clock::now();
+        InferenceEngine::parallel_nt(threads, [&](int ithr, int nthr) {
+            size_t start = 0, end = 0;
+            InferenceEngine::splitter(size, nthr, ithr, start, end);
+            sums[ithr] += std::accumulate(buffer.get() + start, buffer.get() + end, uint64_t{0});
+        });
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - startTime;
+        if (bestNs == 0 || elapsed.count() < bestNs)
+            bestNs = elapsed.count();
+    }
+    volatile uint64_t sink = std::accumulate(sums.begin(), sums.end(), uint64_t{0});
+    (void)sink;
+    return bestNs > 0 ? bandwidthBufferSize / bestNs : 0;
+}
+
+size_t elementsCount(const MKLDNNEdgePtr& edge) {
+    const auto& desc = edge->getMemory().getDesc();
+    if (!desc.isDefined())
+        return 0;
+    const auto& dims = desc.getShape().getStaticDims();
+    return std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<size_t>());
+}
+
+double tensorsBytes(const MKLDNNNodePtr& node) {
+    // the edges of one port share the memory
+    std::set<const MKLDNNMemory*> memories;
+    double bytes = 0;
+    auto add = [&](const MKLDNNEdgePtr& edge) {
+        if (!edge || !edge->getMemoryPtr() || !memories.insert(edge->getMemoryPtr().get()).second)
+            return;
+        const auto& desc = edge->getMemory().getDesc();
+        if (desc.isDefined())
+            bytes += desc.getCurrentMemSize();
+    };
+    for (size_t i = 0; i < node->getParentEdges().size(); i++)
+        add(node->getParentEdgeAt(i));
+    for (size_t i = 0; i < node->getChildEdges().size(); i++)
+        add(node->getChildEdgeAt(i));
+    return bytes;
+}
+
+std::string escapeJson(const std::string& str) {
+    std::string escaped;
+    for (auto c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped += ' ';
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+}  // namespace
+
+MachinePeaks measureMachinePeaks() {
+    static std::mutex mutex;
+    static std::map<int, MachinePeaks> measured;
+
+    const int threads = std::max(1, parallel_get_max_threads());
+    // the measurements of the streams must not compete for the bandwidth
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = measured.find(threads);
+    if (it != measured.end())
+        return it->second;
+
+    MachinePeaks peaks;
+    peaks.threads = threads;
+    peaks.frequencyGHz = measureFrequencyGHz();
+    peaks.peakGFlops = peaks.frequencyGHz * flopsPerCycle() * threads;
+    peaks.bandwidthGBs = measureBandwidthGBs(threads);
+    measured[threads] = peaks;
+    return peaks;
+}
+
+double estimateFlops(const MKLDNNNodePtr& node) {
+    if (node->getParentEdges().empty() || node->getChildEdges().empty())
+        return 0;
+    const auto& inDesc = node->getParentEdgeAt(0)->getMemory().getDesc();
+    const auto& outDesc = node->getChildEdgeAt(0)->getMemory().getDesc();
+    if (!inDesc.isDefined() || !outDesc.isDefined())
+        return 0;
+    const auto& inDims = inDesc.getShape().getStaticDims();
+    const auto& outDims = outDesc.getShape().getStaticDims();
+    const double inElems = elementsCount(node->getParentEdgeAt(0));
+    const double outElems = elementsCount(node->getChildEdgeAt(0));
+    switch (node->getType()) {
+    case Convolution: {
+        // each output element takes weights / output channels multiply-adds
+        if (node->getParentEdges().size() < 2 || outDims.size() < 2 || outDims[1] == 0)
+            break;
+        return 2 * outElems * elementsCount(node->getParentEdgeAt(1)) / outDims[1];
+    }
+    case Deconvolution: {
+        // each input element takes weights / input channels multiply-adds
+        if (node->getParentEdges().size() < 2 || inDims.size() < 2 || inDims[1] == 0)
+            break;
+        return 2 * inElems * elementsCount(node->getParentEdgeAt(1)) / inDims[1];
+    }
+    case FullyConnected:
+    case MatMul: {
+        // [..., M, K] x [K, N] takes 2 * M * K * N operations
+        if (outDims.empty())
+            break;
+        return 2 * inElems * outDims.back();
+    }
+    default:
+        break;
+    }
+    return outElems;
+}
+
+NodeRoofline getNodeRoofline(const MKLDNNNodePtr& node, const MachinePeaks& peaks) {
+    NodeRoofline roofline;
+    const auto& counter = node->PerfCounter();
+    const auto hw = counter.hwAvg();
+    // the work of a node is split between all the threads of the stream, so the throughput is based on
+    // the wall time, the task clock counts the stream thread only
+    roofline.timeUs = static_cast<double>(counter.avg());
+    roofline.cpuTimeUs = hw.taskClockNs / 1000.0;
+    if (roofline.timeUs <= 0)
+        return roofline;
+
+    roofline.flops = estimateFlops(node);
+    // the counters are read on the stream thread only, the work of the node is split between all the threads
+    roofline.bytes = hw.llcMisses ? hw.llcMisses * cacheLineSize * std::max(1, peaks.threads) : tensorsBytes(node);
+    roofline.gflops = roofline.flops / roofline.timeUs / 1000.0;
+    roofline.arithmeticIntensity = roofline.bytes > 0 ? roofline.flops / roofline.bytes : 0;
+    roofline.ipc = hw.cycles ? static_cast<double>(hw.instructions) / hw.cycles : 0;
+
+    const double memoryRoof = roofline.arithmeticIntensity * peaks.bandwidthGBs;
+    roofline.memoryBound = roofline.bytes > 0 && memoryRoof < peaks.peakGFlops;
+    const double roof = roofline.memoryBound ? memoryRoof : peaks.peakGFlops;
+    roofline.efficiency = roof > 0 ? roofline.gflops / roof : 0;
+    return roofline;
+}
+
+std::string rooflineReport(const MKLDNNGraph& graph) {
+    const auto& peaks = graph.getMachinePeaks();
+    std::stringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "{\"machine\": {\"threads\": " << peaks.threads << ", \"frequency_ghz\": " << peaks.frequencyGHz
+        << ", \"peak_gflops\": " << peaks.peakGFlops << ", \"bandwidth_gbs\": " << peaks.bandwidthGBs
+        << ", \"ridge_point\": " << peaks.ridgePoint() << "}, \"nodes\": [";
+
+    double totalTimeUs = 0, memoryBoundTimeUs = 0, totalFlops = 0;
+    bool first = true;
+    for (const auto& node : graph.GetNodes()) {
+        if (node->isConstant())
+            continue;
+        const auto roofline = getNodeRoofline(node, peaks);
+        if (roofline.timeUs <= 0)
+            continue;
+        totalTimeUs += roofline.timeUs;
+        totalFlops += roofline.flops;
+        if (roofline.memoryBound)
+            memoryBoundTimeUs += roofline.timeUs;
+
+        const auto hw = node->PerfCounter().hwAvg();
+        out << (first ? "" : ", ") << "{\"name\": \"" << escapeJson(node->getName())
+            << "\", \"type\": \"" << escapeJson(node->getTypeStr()) << "\", \"time_us\": " << roofline.timeUs
+            << ", \"cpu_time_us\": " << roofline.cpuTimeUs
+            << ", \"flops\": " << roofline.flops << ", \"bytes\": " << roofline.bytes
+            << ", \"gflops\": " << roofline.gflops << ", \"arithmetic_intensity\": " << roofline.arithmeticIntensity
+            << ", \"bound\": \"" << (roofline.memoryBound ? "memory" : "compute")
+            << "\", \"efficiency\": " << roofline.efficiency << ", \"cycles\": " << hw.cycles
+            << ", \"instructions\": " << hw.instructions << ", \"ipc\": " << roofline.ipc
+            << ", \"llc_misses\": " << hw.llcMisses << "}";
+        first = false;
+    }
+
+    out << "], \"total\": {\"time_us\": " << totalTimeUs << ", \"gflops\": "
+        << (totalTimeUs > 0 ? totalFlops / totalTimeUs / 1000.0 : 0) << ", \"memory_bound_time_share\": "
+        << (totalTimeUs > 0 ? memoryBoundTimeUs / totalTimeUs : 0) << "}}";
+    return out.str();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
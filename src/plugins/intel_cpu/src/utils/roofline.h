@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node.h"
+
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+class MKLDNNGraph;
+
+/**
+ * @brief Peak compute throughput and memory bandwidth available to the threads of a stream
+ */
+struct MachinePeaks {
+    int threads = 0;
+    double frequencyGHz = 0;
+    double peakGFlops = 0;
+    double bandwidthGBs = 0;
+
+    // arithmetic intensity (FLOP per byte) above which a node is compute bound
+    double ridgePoint() const {
+        return bandwidthGBs > 0 ? peakGFlops / bandwidthGBs : 0;
+    }
+};
+
+/**
+ * @brief Measures the peaks for the threads of the calling thread's parallel region (i.e. of the stream).
+ * The frequency is measured with the cycles counter and multiplied by the FLOP per cycle of the best
+ * supported ISA, the bandwidth is measured by reading a buffer much larger than the last level cache.
+ * The result is measured once per number of threads in the process.
+ */
+MachinePeaks measureMachinePeaks();
+
+/**
+ * @brief Roofline placement of one execution of a node, based on the hardware counters collected by its PerfCount
+ */
+struct NodeRoofline {
+    double flops = 0;
+    // bytes transferred from DRAM estimated by the last level cache misses, or the size of the node's tensors
+    // if the misses are not counted
+    double bytes = 0;
+    // wall time of the node, the throughput and the share of the memory bound time are based on it
+    double timeUs = 0;
+    // CPU time of the stream thread only, zero if the task clock is not counted
+    double cpuTimeUs = 0;
+    double gflops = 0;
+    double arithmeticIntensity = 0;
+    bool memoryBound = false;
+    // achieved throughput relative to the roofline at the node's arithmetic intensity
+    double efficiency = 0;
+    double ipc = 0;
+};
+
+/**
+ * @brief Estimated number of floating point operations of one execution of the node:
+ * 2 * MAC for convolutions and matrix multiplications, one operation per output element otherwise
+ */
+double estimateFlops(const MKLDNNNodePtr& node);
+
+NodeRoofline getNodeRoofline(const MKLDNNNodePtr& node, const MachinePeaks& peaks);
+
+/**
+ * @brief JSON report of the machine peaks and the roofline placement of the executed nodes of the graph
+ */
+std::string rooflineReport(const MKLDNNGraph& graph);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -5,20 +5,91 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <algorithm>
 #include <memory>
+#include <vector>
+
+#if defined(__linux__)
+# include <unistd.h>
+# include <sys/syscall.h>
+# include <linux/mempolicy.h>
+#endif
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+# define CPU_NUMA_PAGES_PLACEMENT
+#endif
+
+// Spreads the whole pages of the buffer across all the NUMA nodes in round-robin.
+// The pages which are already touched are migrated, so the buffer may be interleaved after it has been filled.
+void interleavePages(void* data, size_t size) {
+#ifdef CPU_NUMA_PAGES_PLACEMENT
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    if (numaNodes.size() < 2)
+        return;
+
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<uintptr_t>(data) + pageSize - 1) / pageSize * pageSize;
+    const auto end = (reinterpret_cast<uintptr_t>(data) + size) / pageSize * pageSize;
+    if (begin >= end)
+        return;
+
+    constexpr size_t bitsPerMask = sizeof(unsigned long) * 8;
+    const auto maxNode = static_cast<size_t>(*std::max_element(numaNodes.begin(), numaNodes.end()));
+    std::vector<unsigned long> nodeMask(maxNode / bitsPerMask + 1, 0);
+    for (auto numaNode : numaNodes)
+        nodeMask[numaNode / bitsPerMask] |= 1ul << (numaNode % bitsPerMask);
+
+    // the placement is an optimization only, the memory stays usable if the policy can't be applied
+    syscall(SYS_mbind, begin, end - begin, MPOL_INTERLEAVE, nodeMask.data(), nodeMask.size() * bitsPerMask + 1, MPOL_MF_MOVE);
+#endif
+}
+
+// Adds the size of the resident pages of the buffer to the NUMA nodes they are placed on
+void accountPages(const void* data, size_t size, int defaultNumaNodeId, std::map<int64_t, uint64_t>& usage) {
+#ifdef CPU_NUMA_PAGES_PLACEMENT
+    if (InferenceEngine::getAvailableNUMANodes().size() > 1) {
+        const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        const auto dataBegin = reinterpret_cast<uintptr_t>(data);
+        const auto dataEnd = dataBegin + size;
+
+        std::vector<void*> pages;
+        for (auto page = dataBegin / pageSize * pageSize; page < dataEnd; page += pageSize)
+            pages.push_back(reinterpret_cast<void*>(page));
+        std::vector<int> status(pages.size(), -1);
+
+        // move_pages without the target nodes only reports the node of each page
+        if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) == 0) {
+            for (size_t i = 0; i < pages.size(); i++) {
+                if (status[i] < 0)
+                    continue;  // the page isn't resident yet
+                const auto page = reinterpret_cast<uintptr_t>(pages[i]);
+                usage[status[i]] += std::min(page + pageSize, dataEnd) - std::max(page, dataBegin);
+            }
+            return;
+        }
+    }
+#endif
+    usage[defaultNumaNodeId] += size;
+}
+
+}  // namespace
+
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MKLDNNMemoryInfo::Ptr & memory,
-        MKLDNNMemoryPtr newPtr)
+        MKLDNNMemoryPtr newPtr,
+        bool interleave)
     : lock(std::move(lock))
     , memory(memory)
     , newPtr(newPtr)
+    , interleave(interleave)
 {}
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::operator MKLDNNMemoryPtr() const {
@@ -30,6 +101,9 @@ bool MKLDNNWeightsSharing::MKLDNNSharedMemory::isValid() const {
 }
 
 void MKLDNNWeightsSharing::MKLDNNSharedMemory::valid(bool b) {
+    // the memory is filled by the owner of the lock before it's published, so it's interleaved with the data in place
+    if (b && interleave && newPtr)
+        interleavePages(newPtr->GetData(), newPtr->GetSize());
     memory->valid.store(b, std::memory_order_release);
 }
 
@@ -46,13 +120,15 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
+            if (valid && interleave)
+                interleavePages(newPtr->GetData(), newPtr->GetSize());
             ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
     }
     return std::make_shared<MKLDNNSharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                                 ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
+                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr, interleave);
 }
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const std::string& key) const {
@@ -71,11 +147,45 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
-NumaNodesWeights::NumaNodesWeights() {
+void MKLDNNWeightsSharing::getMemoryUsage(std::map<int64_t, uint64_t>& usage, int defaultNumaNodeId) const {
+    std::unique_lock<std::mutex> lock(guard);
+    for (const auto& weights : sharedWeights) {
+        // the memory which is being filled is accounted as well, only the pages placement may change later
+        if (auto memory = weights.second->sharedMemory.lock())
+            accountPages(memory->GetData(), memory->GetSize(), defaultNumaNodeId, usage);
+    }
+}
+
+NumaNodesWeights::NumaNodesWeights()
+    : _interleaved_cache(std::make_shared<MKLDNNWeightsSharing>(true))
+    , _first_touch_cache(std::make_shared<MKLDNNWeightsSharing>()) {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
 }
 
+MKLDNNWeightsSharing::Ptr& NumaNodesWeights::get(int numa_id, ov::intel_cpu::WeightsPlacement placement) {
+    switch (placement) {
+    case ov::intel_cpu::WeightsPlacement::INTERLEAVE:
+        return _interleaved_cache;
+    case ov::intel_cpu::WeightsPlacement::FIRST_TOUCH:
+        return _first_touch_cache;
+    default:
+        return (*this)[numa_id];
+    }
+}
+
+std::map<int64_t, uint64_t> NumaNodesWeights::getMemoryUsage() const {
+    std::map<int64_t, uint64_t> usage;
+    for (const auto& cache : _cache_map) {
+        usage[cache.first];
+        cache.second->getMemoryUsage(usage, cache.first);
+    }
+    const int defaultNumaNodeId = _cache_map.empty() ? 0 : _cache_map.begin()->first;
+    _interleaved_cache->getMemoryUsage(usage, defaultNumaNodeId);
+    _first_touch_cache->getMemoryUsage(usage, defaultNumaNodeId);
+    return usage;
+}
+
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
     auto found = _cache_map.find(numa_id);
     if (found == _cache_map.end())
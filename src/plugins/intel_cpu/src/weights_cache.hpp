@@ -5,6 +5,7 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #include <unordered_map>
 #include <functional>
@@ -70,13 +71,16 @@ class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
 
+    explicit MKLDNNWeightsSharing(bool interleave = false) : interleave(interleave) {}
+
     class MKLDNNSharedMemory {
     public:
         typedef std::shared_ptr<MKLDNNSharedMemory> Ptr;
 
         MKLDNNSharedMemory(std::unique_lock<std::mutex> && lock,
                            const MKLDNNMemoryInfo::Ptr & memory,
-                           MKLDNNMemoryPtr newPtr = nullptr);
+                           MKLDNNMemoryPtr newPtr = nullptr,
+                           bool interleave = false);
 
         operator MKLDNNMemoryPtr() const;
         bool isValid() const;
@@ -86,6 +90,7 @@ public:
         std::unique_lock<std::mutex> lock;
         MKLDNNMemoryInfo::Ptr memory;
         MKLDNNMemoryPtr newPtr;
+        bool interleave;
     };
 
     MKLDNNSharedMemory::Ptr findOrCreate(const std::string& key,
@@ -96,7 +101,14 @@ public:
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    /**
+     * Adds the size of the cached memory resident on each NUMA node to the usage map.
+     * The memory is accounted to the defaultNumaNodeId if the pages placement can't be queried.
+     */
+    void getMemoryUsage(std::map<int64_t, uint64_t>& usage, int defaultNumaNodeId) const;
+
 protected:
+    const bool interleave;
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
     static const SimpleDataHash simpleCRC;
@@ -104,6 +116,7 @@ protected:
 
 /**
  * Collection of memory caching store per NUMA node(former socket)
+ * and of the single copy stores used by the non replicating placement policies
  *
  * Is a thread safe
  */
@@ -114,8 +127,14 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    MKLDNNWeightsSharing::Ptr& get(int numa_id, ov::intel_cpu::WeightsPlacement placement);
+
+    std::map<int64_t, uint64_t> getMemoryUsage() const;
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    MKLDNNWeightsSharing::Ptr _interleaved_cache;
+    MKLDNNWeightsSharing::Ptr _first_touch_cache;
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,292 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "low_precision/low_precision.hpp"
+#include "low_precision/markup_can_be_quantized.hpp"
+#include "low_precision/markup_precisions.hpp"
+#include "low_precision/markup_per_tensor_quantization.hpp"
+#include "low_precision/markup_avg_pool_precision_preserved.hpp"
+#include "low_precision/propagate_precisions.hpp"
+#include "low_precision/align_quantization_intervals.hpp"
+#include "low_precision/align_quantization_parameters.hpp"
+#include "low_precision/rt_info/avg_pool_precision_preserved_attribute.hpp"
+#include "low_precision/rt_info/intervals_alignment_attribute.hpp"
+#include "low_precision/rt_info/per_tensor_quantization_attribute.hpp"
+#include "low_precision/rt_info/precision_preserved_attribute.hpp"
+#include "low_precision/rt_info/precisions_attribute.hpp"
+#include "low_precision/rt_info/quantization_alignment_attribute.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ngraph;
+using namespace ngraph::pass;
+
+namespace {
+
+std::vector<low_precision::OperationPrecisionRestriction> getPrecisionRestrictions() {
+    return {
+        low_precision::OperationPrecisionRestriction::create<opset1::Convolution>({
+            {0, {element::u8}},
+            {1, {element::i8}}
+        }),
+    };
+}
+
+std::vector<low_precision::OperationPerTensorQuantizationRestriction> getQuantizationRestrictions() {
+    return {
+        low_precision::OperationPerTensorQuantizationRestriction::create<opset1::Convolution>({0})
+    };
+}
+
+std::shared_ptr<Node> makeFakeQuantize(const Output<Node>& input, const float low, const float high) {
+    return builder::makeFakeQuantize(input, element::f32, 256ul, {}, { low }, { high }, { low }, { high });
+}
+
+std::shared_ptr<Node> makeConvolution(const Output<Node>& input, const size_t channels) {
+    const auto inputChannels = input.get_partial_shape()[1].get_length();
+    const auto weights = opset1::Constant::create(
+        element::f32,
+        Shape{ channels, static_cast<size_t>(inputChannels), 1, 1 },
+        std::vector<float>(channels * inputChannels, 1.f));
+    const auto fakeQuantizeOnWeights = makeFakeQuantize(weights, -1.28f, 1.27f);
+    return std::make_shared<opset1::Convolution>(
+        input,
+        fakeQuantizeOnWeights,
+        Strides{ 1, 1 },
+        CoordinateDiff{ 0, 0 },
+        CoordinateDiff{ 0, 0 },
+        Strides{ 1, 1 });
+}
+
+std::shared_ptr<Node> makeQuantizedConvolution(const Output<Node>& input, const size_t channels) {
+    return makeConvolution(makeFakeQuantize(input, 0.f, 2.55f), channels);
+}
+
+// The quantized AvgPool and the quantized input are concatenated before the convolution, so all the markup
+// and the alignment passes set their attributes
+std::shared_ptr<Function> makeConcatModel() {
+    const auto input1 = std::make_shared<opset1::Parameter>(element::f32, Shape{ 1, 3, 16, 16 });
+    const auto avgPool = std::make_shared<opset1::AvgPool>(
+        makeFakeQuantize(input1, 0.f, 2.55f),
+        Strides{ 2, 2 },
+        Shape{ 0, 0 },
+        Shape{ 0, 0 },
+        Shape{ 2, 2 },
+        true,
+        op::RoundingType::FLOOR);
+
+    const auto input2 = std::make_shared<opset1::Parameter>(element::f32, Shape{ 1, 3, 8, 8 });
+    const auto concat = std::make_shared<opset1::Concat>(
+        OutputVector{ avgPool, makeFakeQuantize(input2, 0.f, 1.275f) }, 1);
+    const auto convolution = makeConvolution(concat, 4);
+    return std::make_shared<Function>(NodeVector{ convolution }, ParameterVector{ input1, input2 });
+}
+
+// Describes the low precision attributes of the runtime info. The attributes sharing the value get the same index of
+// the shared value, so the sharing of the values between the operations is compared too.
+class AttributesDescriber {
+public:
+    std::string describe(const ov::RTMap& rt) {
+        std::map<std::string, std::string> attributes;
+        for (const auto& it : rt) {
+            attributes.emplace(it.first, describeAttribute(it.second));
+        }
+
+        std::ostringstream result;
+        for (const auto& it : attributes) {
+            result << it.first << ": " << it.second << "; ";
+        }
+        return result.str();
+    }
+
+private:
+    std::string describeAttribute(const ov::Any& attribute) {
+        std::ostringstream result;
+        if (attribute.is<PrecisionsAttribute>()) {
+            const auto& precisions = attribute.as<PrecisionsAttribute>();
+            result << "shared value " << getSharedValueIndex(precisions) << " precisions {";
+            for (const auto& precision : precisions.value()) {
+                result << " " << precision;
+            }
+            result << " }";
+        } else if (attribute.is<AvgPoolPrecisionPreservedAttribute>()) {
+            const auto& precisionPreserved = attribute.as<AvgPoolPrecisionPreservedAttribute>();
+            result << "shared value " << getSharedValueIndex(precisionPreserved) << " " << precisionPreserved.value();
+        } else if (attribute.is<PrecisionPreservedAttribute>()) {
+            const auto& precisionPreserved = attribute.as<PrecisionPreservedAttribute>();
+            result << "shared value " << getSharedValueIndex(precisionPreserved) << " " << precisionPreserved.value();
+        } else if (attribute.is<QuantizationAlignmentAttribute>()) {
+            const auto& quantizationAlignment = attribute.as<QuantizationAlignmentAttribute>();
+            result << "shared value " << getSharedValueIndex(quantizationAlignment) << " " <<
+                quantizationAlignment.value();
+        } else if (attribute.is<IntervalsAlignmentAttribute>()) {
+            const auto& intervalsAlignment = attribute.as<IntervalsAlignmentAttribute>();
+            const auto& value = intervalsAlignment.value();
+            result << "shared value " << getSharedValueIndex(intervalsAlignment) <<
+                " levels " << intervalsAlignment.levels <<
+                " combined { " << value.combinedInterval.low << ", " << value.combinedInterval.high << " }" <<
+                " min { " << value.minInterval.low << ", " << value.minInterval.high << " }" <<
+                " minLevels " << value.minLevels << " preferable precisions {";
+            for (const auto& precision : value.preferablePrecisions) {
+                result << " " << precision;
+            }
+            result << " }";
+        } else if (attribute.is<PerTensorQuantizationAttribute>()) {
+            result << "per tensor";
+        } else {
+            result << "not low precision attribute";
+        }
+        return result.str();
+    }
+
+    template <typename T>
+    size_t getSharedValueIndex(const SharedAttribute<T>& attribute) {
+        const void* sharedValue = attribute.attribute->sharedValue.get();
+        return sharedValues.emplace(sharedValue, sharedValues.size()).first->second;
+    }
+
+    std::unordered_map<const void*, size_t> sharedValues;
+};
+
+// The runtime info of the operations, their inputs and outputs in the topological order. The operations are identified
+// by the type and the position, since the names are unique for each built model.
+std::vector<std::string> describeAttributes(const std::shared_ptr<Function>& function) {
+    AttributesDescriber describer;
+    std::vector<std::string> attributes;
+    size_t index = 0;
+    for (const auto& node : function->get_ordered_ops()) {
+        const auto name = std::string(node->get_type_name()) + "_" + std::to_string(index++);
+        attributes.push_back(name + ": " + describer.describe(node->get_rt_info()));
+        for (const auto& input : node->inputs()) {
+            attributes.push_back(
+                name + " input " + std::to_string(input.get_index()) + ": " + describer.describe(input.get_rt_info()));
+        }
+        for (const auto& output : node->outputs()) {
+            attributes.push_back(
+                name + " output " + std::to_string(output.get_index()) + ": " + describer.describe(output.get_rt_info()));
+        }
+    }
+    return attributes;
+}
+
+void runLowPrecision(const std::shared_ptr<Function>& function) {
+    pass::Manager manager;
+    manager.register_pass<low_precision::LowPrecision>(getPrecisionRestrictions());
+    manager.run_passes(function);
+}
+
+} // namespace
+
+TEST(LPT, LowPrecisionDoesNotDecomposeFakeQuantizeBeforeResult) {
+    const auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{ 1, 3, 16, 16 });
+    const auto fakeQuantize = makeFakeQuantize(input, 0.f, 2.55f);
+    const auto function = std::make_shared<Function>(NodeVector{ fakeQuantize }, ParameterVector{ input });
+
+    runLowPrecision(function);
+
+    ASSERT_EQ(1ul, count_ops_of_type<opset1::FakeQuantize>(function));
+    ASSERT_EQ(0ul, count_ops_of_type<opset1::Convert>(function));
+    ASSERT_EQ(0ul, count_ops_of_type<opset1::Multiply>(function));
+    ASSERT_EQ(element::f32, function->get_results()[0]->get_input_element_type(0));
+}
+
+TEST(LPT, LowPrecisionDoesNotDecomposeFakeQuantizeBeforeSeveralResults) {
+    const auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{ 1, 3, 16, 16 });
+    const auto fakeQuantize = makeFakeQuantize(input, 0.f, 2.55f);
+    const auto function = std::make_shared<Function>(
+        ResultVector{ std::make_shared<opset1::Result>(fakeQuantize), std::make_shared<opset1::Result>(fakeQuantize) },
+        ParameterVector{ input });
+
+    runLowPrecision(function);
+
+    ASSERT_EQ(1ul, count_ops_of_type<opset1::FakeQuantize>(function));
+    ASSERT_EQ(0ul, count_ops_of_type<opset1::Convert>(function));
+    ASSERT_EQ(0ul, count_ops_of_type<opset1::Multiply>(function));
+    for (const auto& result : function->get_results()) {
+        ASSERT_EQ(element::f32, result->get_input_element_type(0));
+    }
+}
+
+TEST(LPT, LowPrecisionDecomposesFakeQuantizeBeforeResultAndConvolution) {
+    const auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{ 1, 3, 16, 16 });
+    const auto fakeQuantize = makeFakeQuantize(input, 0.f, 2.55f);
+    const auto convolution = makeConvolution(fakeQuantize, 4);
+    const auto function = std::make_shared<Function>(
+        ResultVector{ std::make_shared<opset1::Result>(fakeQuantize), std::make_shared<opset1::Result>(convolution) },
+        ParameterVector{ input });
+
+    runLowPrecision(function);
+
+    // the Result consumer doesn't prevent the decomposition required by the convolution
+    ASSERT_NE(nullptr, ov::as_type_ptr<opset1::Multiply>(function->get_results()[0]->get_input_node_shared_ptr(0)));
+    const auto multiply = ov::as_type_ptr<opset1::Multiply>(function->get_results()[1]->get_input_node_shared_ptr(0));
+    ASSERT_NE(nullptr, multiply);
+    ASSERT_EQ(element::u8, multiply->get_input_node_ptr(0)->get_input_element_type(0));
+}
+
+TEST(LPT, LowPrecisionDecomposesFakeQuantizeBeforeConvolution) {
+    const auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{ 1, 3, 16, 16 });
+    const auto convolution = makeQuantizedConvolution(input, 4);
+    const auto function = std::make_shared<Function>(NodeVector{ convolution }, ParameterVector{ input });
+
+    runLowPrecision(function);
+
+    const auto result = function->get_results()[0];
+    const auto multiply = ov::as_type_ptr<opset1::Multiply>(result->get_input_node_shared_ptr(0));
+    ASSERT_NE(nullptr, multiply);
+    ASSERT_EQ(element::u8, multiply->get_input_node_ptr(0)->get_input_element_type(0));
+}
+
+// MarkupOptimizations applies the markups in one traversal, the attributes have to be the same as after the separate
+// markup passes
+TEST(LPT, MarkupOptimizationsIsEquivalentToSeparateMarkupPasses) {
+    const auto precisionRestrictions = getPrecisionRestrictions();
+    const auto quantizationRestrictions = getQuantizationRestrictions();
+    const AttributeParameters params;
+
+    const auto reference = makeConcatModel();
+    {
+        pass::Manager markup;
+        markup.register_pass<low_precision::MarkupCanBeQuantized>(params.defaultPrecisions);
+        markup.register_pass<low_precision::MarkupPrecisions>(precisionRestrictions, params.defaultPrecisions);
+        markup.register_pass<low_precision::MarkupPerTensorQuantization>(quantizationRestrictions);
+        markup.register_pass<low_precision::MarkupAvgPoolPrecisionPreserved>(params.defaultPrecisions);
+        markup.register_pass<low_precision::PropagatePrecisions>(params);
+        markup.register_pass<low_precision::AlignQuantizationIntervals>(params.defaultPrecisions);
+        markup.register_pass<low_precision::AlignQuantizationParameters>(params.defaultPrecisions);
+        markup.run_passes(reference);
+    }
+
+    const auto actual = makeConcatModel();
+    {
+        pass::Manager markup;
+        markup.register_pass<low_precision::MarkupOptimizations>(precisionRestrictions, quantizationRestrictions, params);
+        markup.run_passes(actual);
+    }
+
+    const auto referenceAttributes = describeAttributes(reference);
+    const auto actualAttributes = describeAttributes(actual);
+    // the intervals are aligned for the concatenated quantized operations
+    const std::string intervalsAlignment = IntervalsAlignmentAttribute::get_type_info_static();
+    ASSERT_TRUE(std::any_of(referenceAttributes.begin(), referenceAttributes.end(), [&](const std::string& attributes) {
+        return attributes.find(intervalsAlignment) != std::string::npos;
+    }));
+    ASSERT_EQ(referenceAttributes.size(), actualAttributes.size());
+    for (size_t i = 0; i < referenceAttributes.size(); i++) {
+        EXPECT_EQ(referenceAttributes[i], actualAttributes[i]);
+    }
+}
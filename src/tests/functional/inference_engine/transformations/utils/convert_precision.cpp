@@ -16,6 +16,7 @@
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph/opsets/opset8.hpp>
 #include <transformations/convert_precision.hpp>
+#include <transformations/rt_info/keep_const_precision.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <ngraph_ops/type_relaxed.hpp>
@@ -299,6 +300,35 @@ TEST(TransformationTests, ConvertPrecision_ConvertElimination) {
     ASSERT_TRUE(res.first) << res.second;
 }
 
+TEST(TransformationTests, ConvertPrecision_KeepConstPrecision) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<opset4::Parameter>(element::f32, Shape{1, 16});
+        auto weights = opset4::Constant::create(element::f16, Shape{8, 16}, {1});
+        ov::enable_keep_const_precision(weights);
+        auto convert = std::make_shared<opset4::Convert>(weights, element::f32);
+        auto matmul = std::make_shared<opset4::MatMul>(input, convert, false, true);
+
+        f = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{input});
+
+        pass::Manager manager;
+        manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::f16, ngraph::element::f32 }});
+        manager.run_passes(f);
+    }
+
+    {
+        auto input = std::make_shared<opset4::Parameter>(element::f32, Shape{1, 16});
+        auto weights = opset4::Constant::create(element::f16, Shape{8, 16}, {1});
+        auto convert = std::make_shared<opset4::Convert>(weights, element::f32);
+        auto matmul = std::make_shared<opset4::MatMul>(input, convert, false, true);
+
+        f_ref = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
 TEST(TransformationTests, ConvertPrecision_TopK) {
     std::shared_ptr<Function> f(nullptr);
     {
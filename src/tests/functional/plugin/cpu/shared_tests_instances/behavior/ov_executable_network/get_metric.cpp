@@ -9,9 +9,12 @@
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 using namespace ov::test::behavior;
 namespace {
 
@@ -57,6 +60,16 @@ TEST_F(OVClassConfigTestCPU, smoke_SetROPropertiesThrow) {
     }
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_GetEliminatedReordersDoesNotThrow) {
+    ov::Core ie;
+    uint32_t value = 0;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+    OV_ASSERT_NO_THROW(value = compiledModel.get_property(ov::intel_cpu::eliminated_reorders));
+    // the layout assignment never adds reorders, so the count is bounded by the number of edges in the graph
+    ASSERT_LT(value, compiledModel.get_runtime_model()->get_ops().size() * 2);
+}
+
 TEST_F(OVClassConfigTestCPU, smoke_CheckCoreStreamsHasHigherPriorityThanThroughputHint) {
     ov::Core ie;
     int32_t streams = 1; // throughput hint should apply higher number of streams
@@ -113,6 +126,124 @@ TEST_F(OVClassConfigTestCPU, smoke_CheckModelStreamsHasHigherPriorityThanThrough
     ASSERT_EQ(streams, value);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CheckStreamsCalibrationForThroughputHint) {
+    ov::Core ie;
+    int32_t value;
+
+    ov::AnyMap config;
+    config[ov::hint::performance_mode.name()] = ov::hint::PerformanceMode::THROUGHPUT;
+    config[ov::intel_cpu::streams_calibration.name()] = true;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, config);
+
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::streams_calibration));
+    ASSERT_NO_THROW(value = compiledModel.get_property(ov::num_streams));
+    ASSERT_GE(value, 1);
+    ASSERT_LE(value, static_cast<int32_t>(std::get<1>(ie.get_property(deviceName, ov::range_for_streams))));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CheckModelStreamsHasHigherPriorityThanStreamsCalibration) {
+    ov::Core ie;
+    int32_t streams = 3;
+    int32_t value;
+
+    ov::AnyMap config;
+    config[ov::hint::performance_mode.name()] = ov::hint::PerformanceMode::THROUGHPUT;
+    config[ov::intel_cpu::streams_calibration.name()] = true;
+    config[ov::num_streams.name()] = streams;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, config);
+
+    ASSERT_NO_THROW(value = compiledModel.get_property(ov::num_streams));
+    ASSERT_EQ(streams, value);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CheckCalibratedStreamsAreRestoredOnImport) {
+    ov::Core ie;
+    int32_t streams, threads, value;
+
+    ov::AnyMap config;
+    config[ov::hint::performance_mode.name()] = ov::hint::PerformanceMode::THROUGHPUT;
+    config[ov::hint::num_requests.name()] = 2;
+    config[ov::intel_cpu::streams_calibration.name()] = true;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, config);
+    ASSERT_NO_THROW(streams = compiledModel.get_property(ov::num_streams));
+    ASSERT_NO_THROW(threads = compiledModel.get_property(ov::inference_num_threads));
+
+    std::stringstream exported;
+    compiledModel.export_model(exported);
+
+    // the number of requests limits the candidates to 1 or 2 streams: the stored value is replaced by the other one,
+    // so the imported model shows whether the streams are taken from the blob or calibrated again
+    std::string blob = exported.str();
+    const std::string storedStreams = "key=\"CPU_THROUGHPUT_STREAMS\" value=\"" + std::to_string(streams) + "\"";
+    const auto pos = blob.find(storedStreams);
+    ASSERT_NE(std::string::npos, pos);
+    const int32_t expectedStreams = streams == 1 ? 2 : 1;
+    blob.replace(pos, storedStreams.size(),
+                 "key=\"CPU_THROUGHPUT_STREAMS\" value=\"" + std::to_string(expectedStreams) + "\"");
+
+    std::stringstream imported(blob);
+    ov::CompiledModel importedModel;
+    ASSERT_NO_THROW(importedModel = ie.import_model(imported, deviceName, {ov::intel_cpu::streams_calibration(true)}));
+
+    ASSERT_NO_THROW(value = importedModel.get_property(ov::num_streams));
+    ASSERT_EQ(expectedStreams, value);
+    ASSERT_NO_THROW(value = importedModel.get_property(ov::inference_num_threads));
+    ASSERT_EQ(threads, value);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_GetRooflineReportWithHwPerfCounters) {
+    ov::Core ie;
+    std::string report;
+
+    ov::AnyMap config;
+    config[ov::enable_profiling.name()] = true;
+    config[ov::intel_cpu::hw_perf_counters.name()] = true;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, config);
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::hw_perf_counters));
+    auto request = compiledModel.create_infer_request();
+    OV_ASSERT_NO_THROW(request.infer());
+
+    // the counters may be unavailable on the machine, the report is still built from the timings
+    OV_ASSERT_NO_THROW(report = compiledModel.get_property(ov::intel_cpu::roofline_report));
+    ASSERT_EQ(0u, report.find("{\"machine\": {"));
+    ASSERT_NE(std::string::npos, report.find("\"nodes\": ["));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_ReleasedRequestTensorIsNotReused) {
+    ov::Core ie;
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+
+    ov::Tensor tensor;
+    {
+        auto request = compiledModel.create_infer_request();
+        tensor = request.get_input_tensor();
+    }
+    // the tensor is still referenced, so the released request can't be given to the next user
+    auto request = compiledModel.create_infer_request();
+    ASSERT_NE(tensor.data(), request.get_input_tensor().data());
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_RecycledRequestRestoresDefaultTensors) {
+    ov::Core ie;
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+
+    ov::Tensor userTensor(model->input().get_element_type(), model->input().get_shape());
+    {
+        auto request = compiledModel.create_infer_request();
+        request.set_input_tensor(userTensor);
+        OV_ASSERT_NO_THROW(request.infer());
+    }
+    for (size_t i = 0; i < 4; i++) {
+        auto request = compiledModel.create_infer_request();
+        ASSERT_NE(userTensor.data(), request.get_input_tensor().data());
+        OV_ASSERT_NO_THROW(request.infer());
+    }
+}
+
 const std::vector<ov::AnyMap> multiDevicePriorityConfigs = {
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU)}};
 
@@ -4,6 +4,7 @@
 
 #include "behavior/ov_plugin/core_integration.hpp"
 #include <openvino/runtime/properties.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
 #include "ie_system_conf.h"
 #include "openvino/runtime/core.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -186,6 +187,29 @@ TEST(OVClassBasicTest, smoke_SetConfigEnableProfiling) {
     ASSERT_EQ(enableProfiling, value);
 }
 
+TEST(OVClassBasicTest, smoke_SetConfigWeightsPlacement) {
+    ov::Core ie;
+    auto value = ov::intel_cpu::WeightsPlacement::INTERLEAVE;
+
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::intel_cpu::weights_placement));
+    ASSERT_EQ(ov::intel_cpu::WeightsPlacement::REPLICATE, value);
+
+    const auto placement = ov::intel_cpu::WeightsPlacement::FIRST_TOUCH;
+
+    OV_ASSERT_NO_THROW(ie.set_property("CPU", ov::intel_cpu::weights_placement(placement)));
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::intel_cpu::weights_placement));
+    ASSERT_EQ(placement, value);
+}
+
+TEST(OVClassBasicTest, smoke_GetMetricWeightsMemoryPerNumaNode) {
+    ov::Core ie;
+    std::map<int64_t, uint64_t> usage;
+
+    OV_ASSERT_NO_THROW(usage = ie.get_property("CPU", ov::intel_cpu::weights_memory_per_numa_node));
+    for (auto numaNode : InferenceEngine::getAvailableNUMANodes())
+        ASSERT_NE(usage.end(), usage.find(numaNode));
+}
+
 // IE Class Query network
 
 INSTANTIATE_TEST_SUITE_P(
@@ -74,7 +74,8 @@ public:
         size_t defaultIndex;
         std::tie(inputShapes, indices, offsets, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // FP32 tables are accumulated by the JIT kernel
+        selectedType = makeSelectedTypeStr(inType == ElementType::f32 ? getPrimitiveType() : "ref", inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -67,7 +67,8 @@ protected:
         bool withWeights;
         std::tie(inputShapes, indices, withWeights) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // FP32 tables are accumulated by the JIT kernel
+        selectedType = makeSelectedTypeStr(inType == ElementType::f32 ? getPrimitiveType() : "ref", inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
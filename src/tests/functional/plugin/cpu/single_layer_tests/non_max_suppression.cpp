@@ -436,4 +436,28 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 
 INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest, NmsLayerCPUTest, nmsParams, NmsLayerCPUTest::getTestCaseName);
 
+// classes with a large number of candidates are suppressed by blocks
+const std::vector<InputShapeParams> inShapeParamsLargeClasses = {
+    InputShapeParams{std::vector<ov::Dimension>{}, std::vector<TargetShapeParams>{TargetShapeParams{1, 5000, 2}}},
+    InputShapeParams{std::vector<ov::Dimension>{-1, -1, -1}, std::vector<TargetShapeParams>{TargetShapeParams{2, 3000, 1},
+                                                                                            TargetShapeParams{1, 100, 3}}}
+};
+
+const auto nmsParamsLargeClasses = ::testing::Combine(::testing::ValuesIn(inShapeParamsLargeClasses),
+                                                      ::testing::Combine(::testing::Values(ElementType::f32),
+                                                                         ::testing::Values(ElementType::i32),
+                                                                         ::testing::Values(ElementType::f32)),
+                                                      ::testing::Values(100, 3000),
+                                                      ::testing::Combine(::testing::ValuesIn(threshold),
+                                                                         ::testing::Values(0.3f),
+                                                                         ::testing::Values(0.0f)),
+                                                      ::testing::Values(ngraph::helpers::InputLayerType::CONSTANT),
+                                                      ::testing::ValuesIn(encodType),
+                                                      ::testing::Values(true),
+                                                      ::testing::Values(element::i32),
+                                                      ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest_LargeClasses, NmsLayerCPUTest, nmsParamsLargeClasses, NmsLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
@@ -143,6 +143,21 @@ std::vector<std::vector<InputShape>> inputs = {
                 {5, 5, 5}
             }
         },
+    },
+
+    {  //third test suit: static shapes, sliced ports are bound as views without copying
+        {   //static shape for first input
+            {1, 12, 10},
+            {  // target static shapes
+                {1, 12, 10}
+            }
+        },
+        {   //static shape for second input
+            {1, 12, 1},
+            {  // target static shapes
+                {1, 12, 1}
+            }
+        },
     }
 };
 
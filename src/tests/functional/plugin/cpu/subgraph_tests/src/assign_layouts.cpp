@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <openvino/runtime/intel_cpu/properties.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+   The layout of a node is selected greedily by the layouts of its parents, so MaxPool inherits the planar layout
+   of the network input, while both convolutions prefer the blocked one:
+
+          Parameter (planar)
+              |
+           MaxPool
+           /     \
+     Convolution  Convolution
+           \     /
+             Add
+
+   Two reorders are inserted between MaxPool and the convolutions. The layout assignment over the whole graph
+   switches MaxPool to the blocked layout, so a single reorder of the network input is left instead of them.
+*/
+class AssignLayoutsTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const auto type = element::f32;
+        const size_t channels = 32;
+
+        auto params = builder::makeParams(type, {{1, channels, 20, 20}});
+        auto pool = std::make_shared<opset1::MaxPool>(params[0], Strides{1, 1}, Shape{1, 1}, Shape{1, 1}, Shape{3, 3},
+                                                      op::RoundingType::FLOOR, op::PadType::EXPLICIT);
+        auto makeConv = [&](const Output<Node>& input) {
+            return builder::makeConvolution(input, type, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, op::PadType::EXPLICIT, channels);
+        };
+        auto add = std::make_shared<opset8::Add>(makeConv(pool), makeConv(pool));
+        function = std::make_shared<Function>(add, params, "AssignLayouts");
+    }
+};
+
+TEST_F(AssignLayoutsTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the blocked layouts are preferred by the convolutions starting with avx2
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        return;
+
+    const auto eliminatedReorders = executableNetwork.GetMetric(ov::intel_cpu::eliminated_reorders.name()).as<uint32_t>();
+    ASSERT_GE(eliminatedReorders, 1);
+
+    size_t reorders = 0;
+    const auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+    for (const auto& node : execGraph->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        const auto layerType = rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>();
+        if (layerType == "Reorder") {
+            reorders++;
+        } else if (layerType == "Pooling") {
+            const auto layout = rtInfo.at(ExecGraphInfoSerialization::OUTPUT_LAYOUTS).as<std::string>();
+            ASSERT_TRUE(layout == "aBcd8b" || layout == "aBcd16b") << layout;
+        }
+    }
+    // the reorders of the network input and output are left only, the greedy selection needs one more
+    ASSERT_LE(reorders, 2);
+}
+
+} // namespace SubgraphTestsDefinitions
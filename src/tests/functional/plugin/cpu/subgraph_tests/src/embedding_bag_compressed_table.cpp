@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        Shape,                                             // Embedding table shape
+        element::Type,                                     // Embedding table precision
+        bool                                               // With zero points
+> EmbeddingBagCompressedTableParams;
+
+class EmbeddingBagCompressedTableTest : public testing::WithParamInterface<EmbeddingBagCompressedTableParams>,
+                                        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagCompressedTableParams> &obj) {
+        Shape tableShape;
+        element::Type tablePrecision;
+        bool withZeroPoints;
+        std::tie(tableShape, tablePrecision, withZeroPoints) = obj.param;
+
+        std::ostringstream results;
+        results << "TS=" << tableShape
+                << "_TablePRC=" << tablePrecision
+                << "_ZP=" << withZeroPoints;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        Shape tableShape;
+        element::Type tablePrecision;
+        bool withZeroPoints;
+        std::tie(tableShape, tablePrecision, withZeroPoints) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = Precision::FP32;
+        outPrc = Precision::FP32;
+
+        const size_t batch = 3;
+        const size_t indicesPerBag = 4;
+        std::vector<int32_t> indices(batch * indicesPerBag);
+        for (size_t i = 0; i < indices.size(); i++)
+            indices[i] = static_cast<int32_t>((i * 7) % tableShape[0]);
+
+        const auto table = tablePrecision == element::u8 ?
+                builder::makeConstant<uint8_t>(element::u8, tableShape, {}, true, 255, 0) :
+                builder::makeConstant<int8_t>(element::i8, tableShape, {}, true, 127, -128);
+        std::shared_ptr<Node> decompression = std::make_shared<opset3::Convert>(table, element::f32);
+
+        // row-wise dequantization parameters
+        Shape rowWiseShape(tableShape.size(), 1);
+        rowWiseShape[0] = tableShape[0];
+        if (withZeroPoints) {
+            const auto zeroPoints = builder::makeConstant<float>(element::f32, rowWiseShape, {}, true, 10.f, -10.f);
+            decompression = std::make_shared<opset3::Subtract>(decompression, zeroPoints);
+        }
+        const auto scales = builder::makeConstant<float>(element::f32, rowWiseShape, {}, true, 0.1f, 0.01f);
+        decompression = std::make_shared<opset3::Multiply>(decompression, scales);
+
+        const auto weights = std::make_shared<opset3::Parameter>(element::f32, Shape{batch, indicesPerBag});
+        const auto indicesNode = opset3::Constant::create(element::i32, Shape{batch, indicesPerBag}, indices);
+        const auto embBag = std::make_shared<opset3::EmbeddingBagPackedSum>(decompression, indicesNode, weights);
+
+        ResultVector results{std::make_shared<opset3::Result>(embBag)};
+        function = std::make_shared<Function>(results, ParameterVector{weights}, "EmbeddingBagCompressedTable");
+    }
+};
+
+/* Test that the embedding table is kept compressed and dequantized by the EmbeddingBag node.
+
+    Constant[U8/I8]
+          |
+     Convert[FP32]   (dropped)
+          |
+       Subtract      (dropped, row-wise zero points)
+          |
+       Multiply      (dropped, row-wise scales)
+          |
+  EmbeddingBagPackedSum[U8/I8->FP32]
+          |
+     Output[FP32]
+*/
+TEST_P(EmbeddingBagCompressedTableTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    if (InferenceEngine::with_cpu_x86_sse42()) {
+        CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+        CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+    }
+    CheckNumberOfNodesWithType(executableNetwork, "EmbeddingBagPackedSum", 1);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagCompressedTable, EmbeddingBagCompressedTableTest,
+    ::testing::Combine(
+        ::testing::Values(Shape{10, 35}, Shape{16, 4, 17}),
+        ::testing::Values(element::u8, element::i8),
+        ::testing::Values(true, false)),
+    EmbeddingBagCompressedTableTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
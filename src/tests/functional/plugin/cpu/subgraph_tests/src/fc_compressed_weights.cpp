@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        Shape,                                             // Input shape
+        size_t,                                            // Output channels
+        element::Type,                                     // Weights precision
+        bool,                                              // Transposed weights
+        bool,                                              // With zero points
+        bool                                               // With activation
+> FullyConnectedCompressedWeightsParams;
+
+class FullyConnectedCompressedWeightsTest : public testing::WithParamInterface<FullyConnectedCompressedWeightsParams>,
+                                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FullyConnectedCompressedWeightsParams> &obj) {
+        Shape inputShape;
+        size_t outChannels;
+        element::Type weightsPrecision;
+        bool transposeWeights, withZeroPoints, withActivation;
+        std::tie(inputShape, outChannels, weightsPrecision, transposeWeights, withZeroPoints, withActivation) = obj.param;
+
+        std::ostringstream results;
+        results << "IS=" << inputShape
+                << "_OC=" << outChannels
+                << "_WeightsPRC=" << weightsPrecision
+                << "_TransposeB=" << transposeWeights
+                << "_ZP=" << withZeroPoints
+                << "_Activation=" << withActivation;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        Shape inputShape;
+        size_t outChannels;
+        element::Type weightsPrecision;
+        bool transposeWeights, withZeroPoints, withActivation;
+        std::tie(inputShape, outChannels, weightsPrecision, transposeWeights, withZeroPoints, withActivation) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = Precision::FP32;
+        outPrc = Precision::FP32;
+
+        const size_t inChannels = inputShape.back();
+        const Shape weightsShape = transposeWeights ? Shape{outChannels, inChannels} : Shape{inChannels, outChannels};
+        std::shared_ptr<Node> weights;
+        if (weightsPrecision == element::u8) {
+            weights = builder::makeConstant<uint8_t>(element::u8, weightsShape, {}, true, 255, 0);
+        } else if (weightsPrecision == element::i8) {
+            weights = builder::makeConstant<int8_t>(element::i8, weightsShape, {}, true, 127, -128);
+        } else {
+            weights = builder::makeConstant<float>(element::f16, weightsShape, {}, true, 1.f, -1.f);
+        }
+        std::shared_ptr<Node> decompression = std::make_shared<opset1::Convert>(weights, element::f32);
+
+        // per output channel dequantization parameters
+        const Shape channelWiseShape = transposeWeights ? Shape{outChannels, 1} : Shape{1, outChannels};
+        if (weightsPrecision != element::f16) {
+            if (withZeroPoints) {
+                const auto zeroPoints = builder::makeConstant<float>(element::f32, channelWiseShape, {}, true, 10.f, -10.f);
+                decompression = std::make_shared<opset1::Subtract>(decompression, zeroPoints);
+            }
+            const auto scales = builder::makeConstant<float>(element::f32, channelWiseShape, {}, true, 0.01f, 0.001f);
+            decompression = std::make_shared<opset1::Multiply>(decompression, scales);
+        }
+
+        const auto param = std::make_shared<opset1::Parameter>(element::f32, inputShape);
+        std::shared_ptr<Node> matMul = std::make_shared<opset1::MatMul>(param, decompression, false, transposeWeights);
+        if (withActivation)
+            matMul = std::make_shared<opset1::Relu>(matMul);
+
+        ResultVector results{std::make_shared<opset1::Result>(matMul)};
+        function = std::make_shared<Function>(results, ParameterVector{param}, "FullyConnectedCompressedWeights");
+    }
+};
+
+/* Test that the compressed weights are kept in memory and dequantized by the FullyConnected node for the small
+   number of rows, and that the activation is fused into it. The large number of rows is executed over the folded weights.
+
+    Constant[U8/I8/FP16]
+          |
+     Convert[FP32]   (dropped)
+          |
+       Subtract      (dropped, per output channel zero points)
+          |
+       Multiply      (dropped, per output channel scales)
+          |
+  FullyConnected[U8/I8/FP16 weights]
+          |
+        Relu         (optional, fused)
+          |
+     Output[FP32]
+*/
+TEST_P(FullyConnectedCompressedWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+        CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+    }
+    CheckNumberOfNodesWithType(executableNetwork, "FullyConnected", 1);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedCompressedWeights, FullyConnectedCompressedWeightsTest,
+    ::testing::Combine(
+        ::testing::Values(Shape{1, 64}, Shape{3, 37}, Shape{2, 5, 48}, Shape{64, 32}),
+        ::testing::Values(16, 19),
+        ::testing::Values(element::u8, element::i8, element::f16),
+        ::testing::Values(true, false),
+        ::testing::Values(true, false),
+        ::testing::Values(true, false)),
+    FullyConnectedCompressedWeightsTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
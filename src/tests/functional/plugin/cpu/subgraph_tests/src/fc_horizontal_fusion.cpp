@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        Shape,                                             // Input shape
+        std::vector<size_t>,                               // Output channels of the sibling FullyConnected nodes
+        bool,                                              // With bias
+        bool                                               // With common activation
+> FullyConnectedHorizontalFusionParams;
+
+class FullyConnectedHorizontalFusionTest : public testing::WithParamInterface<FullyConnectedHorizontalFusionParams>,
+                                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FullyConnectedHorizontalFusionParams> &obj) {
+        Shape inputShape;
+        std::vector<size_t> outChannels;
+        bool withBias, withActivation;
+        std::tie(inputShape, outChannels, withBias, withActivation) = obj.param;
+
+        std::ostringstream results;
+        results << "IS=" << inputShape
+                << "_OC=" << CommonTestUtils::vec2str(outChannels)
+                << "_Bias=" << withBias
+                << "_Activation=" << withActivation;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        Shape inputShape;
+        std::vector<size_t> outChannels;
+        bool withBias, withActivation;
+        std::tie(inputShape, outChannels, withBias, withActivation) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = Precision::FP32;
+        outPrc = Precision::FP32;
+
+        const auto param = std::make_shared<opset1::Parameter>(element::f32, inputShape);
+        ResultVector results;
+        for (const auto oc : outChannels) {
+            const auto weights = builder::makeConstant<float>(element::f32, Shape{inputShape.back(), oc}, {}, true, 1.f, -1.f);
+            std::shared_ptr<Node> fc = std::make_shared<opset1::MatMul>(param, weights);
+            if (withBias) {
+                const auto bias = builder::makeConstant<float>(element::f32, Shape{oc}, {}, true, 1.f, -1.f);
+                fc = std::make_shared<opset1::Add>(fc, bias);
+            }
+            if (withActivation) {
+                fc = std::make_shared<opset1::Relu>(fc);
+            }
+            // the outputs of the merged node are consumed by other operations as in the attention block
+            const auto scale = opset1::Constant::create(element::f32, Shape{}, {0.5f});
+            results.push_back(std::make_shared<opset1::Result>(std::make_shared<opset1::Multiply>(fc, scale)));
+        }
+        function = std::make_shared<Function>(results, ParameterVector{param}, "FullyConnectedHorizontalFusion");
+    }
+};
+
+/* Test that sibling FullyConnected nodes reading the same input are executed as one node.
+
+                Input
+           /      |      \
+         FC      FC      FC     (merged into one FC with concatenated weights and biases)
+          |       |       |
+        Relu    Relu    Relu    (moved before the split and fused into the FC)
+          |       |       |
+         ...     ...     ...
+*/
+TEST_P(FullyConnectedHorizontalFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNumberOfNodesWithType(executableNetwork, "FullyConnected", 1);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedHorizontalFusion, FullyConnectedHorizontalFusionTest,
+    ::testing::Combine(
+        ::testing::Values(Shape{4, 64}, Shape{1, 10, 48}),
+        ::testing::Values(std::vector<size_t>{16, 16, 16}, std::vector<size_t>{32, 8}),
+        ::testing::Values(true, false),
+        ::testing::Values(true, false)),
+    FullyConnectedHorizontalFusionTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,155 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/data_utils.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        Shape,                                             // Input shape
+        size_t,                                            // Output channels
+        float,                                             // Share of the zero blocks in the weights
+        bool                                               // With bias
+> FullyConnectedSparseWeightsParams;
+
+namespace {
+
+const float sparseWeightsRate = 0.5f;
+
+size_t zeroBlocksNum(size_t outChannels, size_t inChannels, float sparsityRate) {
+    const size_t ocBlocks = (outChannels + 15) / 16;
+    return static_cast<size_t>(sparsityRate * ocBlocks * inChannels);
+}
+
+// The blocks of 16 output channels x 1 input channel are zeroed with the given rate, like the input channels
+// pruned per group of output channels
+std::shared_ptr<Node> makeSparseWeights(size_t outChannels, size_t inChannels, float sparsityRate) {
+    auto values = CommonTestUtils::generate_float_numbers(outChannels * inChannels, -1.f, 1.f);
+    const size_t ocBlocks = (outChannels + 15) / 16;
+    const size_t zeroBlocks = zeroBlocksNum(outChannels, inChannels, sparsityRate);
+    for (size_t i = 0; i < zeroBlocks; i++) {
+        // the stride is coprime with the number of the blocks (when it's not a multiple of 7), so the zero blocks are scattered
+        const size_t block = (i * 7) % (ocBlocks * inChannels);
+        const size_t ocBlock = block / inChannels;
+        const size_t ic = block % inChannels;
+        for (size_t oc = ocBlock * 16; oc < std::min(outChannels, (ocBlock + 1) * 16); oc++)
+            values[oc * inChannels + ic] = 0.f;
+    }
+    return builder::makeConstant<float>(element::f32, Shape{outChannels, inChannels}, values);
+}
+
+std::shared_ptr<Function> makeFullyConnected(const Shape& inputShape, size_t outChannels, float sparsityRate, bool withBias) {
+    const auto param = std::make_shared<opset1::Parameter>(element::f32, inputShape);
+    const auto weights = makeSparseWeights(outChannels, inputShape.back(), sparsityRate);
+    std::shared_ptr<Node> output = std::make_shared<opset1::MatMul>(param, weights, false, true);
+    if (withBias) {
+        const auto bias = builder::makeConstant<float>(element::f32, Shape{outChannels}, {}, true, 1.f, -1.f);
+        output = std::make_shared<opset1::Add>(output, bias);
+    }
+
+    ResultVector results{std::make_shared<opset1::Result>(output)};
+    return std::make_shared<Function>(results, ParameterVector{param}, "FullyConnectedSparseWeights");
+}
+
+} // namespace
+
+class FullyConnectedSparseWeightsTest : public testing::WithParamInterface<FullyConnectedSparseWeightsParams>,
+                                        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FullyConnectedSparseWeightsParams> &obj) {
+        Shape inputShape;
+        size_t outChannels;
+        float sparsityRate;
+        bool withBias;
+        std::tie(inputShape, outChannels, sparsityRate, withBias) = obj.param;
+
+        std::ostringstream results;
+        results << "IS=" << inputShape
+                << "_OC=" << outChannels
+                << "_SparsityRate=" << sparsityRate
+                << "_Bias=" << withBias;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        Shape inputShape;
+        size_t outChannels;
+        float sparsityRate;
+        bool withBias;
+        std::tie(inputShape, outChannels, sparsityRate, withBias) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = Precision::FP32;
+        outPrc = Precision::FP32;
+        configuration[ov::intel_cpu::sparse_weights_rate.name()] = std::to_string(sparseWeightsRate);
+
+        function = makeFullyConnected(inputShape, outChannels, sparsityRate, withBias);
+
+        // the rate of the generated weights is rounded down to the whole number of the zero blocks
+        const size_t blocksNum = (outChannels + 15) / 16 * inputShape.back();
+        const size_t zeroBlocks = zeroBlocksNum(outChannels, inputShape.back(), sparsityRate);
+        expectSparse = InferenceEngine::with_cpu_x86_avx2() && zeroBlocks >= sparseWeightsRate * blocksNum;
+    }
+
+    void CheckFullyConnectedImpl() {
+        CheckNumberOfNodesWithType(executableNetwork, "FullyConnected", 1);
+
+        std::string expectedImpl = "sparse";
+        if (expectSparse)
+            expectedImpl = InferenceEngine::with_cpu_x86_avx512f() ? "jit_avx512_sparse" : "jit_avx2_sparse";
+        const auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        for (const auto& node : execGraph->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "FullyConnected")
+                continue;
+            const auto implType = rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+            if (expectSparse) {
+                ASSERT_EQ(expectedImpl, implType);
+                // the packed weights replace the dense ones
+                ASSERT_EQ(ov::element::u8, node->get_input_element_type(1));
+            } else {
+                ASSERT_EQ(std::string::npos, implType.find(expectedImpl));
+            }
+        }
+    }
+
+    bool expectSparse = false;
+};
+
+/* Test that the weights with the sparsity rate above the threshold are executed by the sparse kernel,
+   and the dense ones by oneDNN.
+
+    Constant[FP32, zero blocks]
+          |
+  FullyConnected[packed sparse weights]
+          |
+     Output[FP32]
+*/
+TEST_P(FullyConnectedSparseWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckFullyConnectedImpl();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedSparseWeights, FullyConnectedSparseWeightsTest,
+    ::testing::Combine(
+        ::testing::Values(Shape{1, 64}, Shape{3, 37}, Shape{2, 5, 48}, Shape{11, 128}),
+        ::testing::Values(16, 19, 64),
+        ::testing::Values(0.f, 0.5f, 0.8f, 0.9f),
+        ::testing::Values(true, false)),
+    FullyConnectedSparseWeightsTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
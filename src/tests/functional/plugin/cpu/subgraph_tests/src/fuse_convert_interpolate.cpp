@@ -0,0 +1,148 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        Shape,                                             // Input shape
+        Shape,                                             // Target spatial shape
+        element::Type,                                     // Input precision
+        std::string                                        // Input image layout: NCHW, NHWC or NV12
+> FuseConvertAndInterpolateParams;
+
+class FuseConvertAndInterpolateTest : public testing::WithParamInterface<FuseConvertAndInterpolateParams>,
+                                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FuseConvertAndInterpolateParams> &obj) {
+        Shape inputShape;
+        Shape targetShape;
+        element::Type inputPrecision;
+        std::string inputLayout;
+        std::tie(inputShape, targetShape, inputPrecision, inputLayout) = obj.param;
+
+        std::ostringstream results;
+        results << "IS=" << inputShape
+                << "_TS=" << targetShape
+                << "_InPRC=" << inputPrecision
+                << "_InLayout=" << inputLayout;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        Shape inputShape;
+        Shape targetShape;
+        element::Type inputPrecision;
+        std::string inputLayout;
+        std::tie(inputShape, targetShape, inputPrecision, inputLayout) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = inputPrecision == element::u8 ? Precision::U8 : Precision::I8;
+        outPrc = Precision::FP32;
+
+        // the image in the NHWC layout is converted to the model layout as ov::preprocess::PrePostProcessor does
+        // and ngraph::pass::WrapInterpolateIntoTransposes leaves it
+        const auto toNCHW = opset4::Constant::create(element::i64, Shape{4}, {0, 3, 1, 2});
+        ParameterVector params;
+        std::shared_ptr<Node> image;
+        if (inputLayout == "NV12") {
+            const auto y = std::make_shared<opset4::Parameter>(inputPrecision, Shape{inputShape[0], inputShape[2], inputShape[3], 1});
+            const auto uv = std::make_shared<opset4::Parameter>(inputPrecision, Shape{inputShape[0], inputShape[2] / 2, inputShape[3] / 2, 2});
+            params = {y, uv};
+            image = std::make_shared<opset8::NV12toRGB>(y, uv);
+        } else if (inputLayout == "NHWC") {
+            params = {std::make_shared<opset4::Parameter>(inputPrecision, Shape{inputShape[0], inputShape[2], inputShape[3], inputShape[1]})};
+            image = params[0];
+        } else {
+            params = {std::make_shared<opset4::Parameter>(inputPrecision, inputShape)};
+            image = params[0];
+        }
+        std::shared_ptr<Node> convert = std::make_shared<opset4::Convert>(image, element::f32);
+        if (inputLayout != "NCHW") {
+            convert = std::make_shared<opset4::Transpose>(convert, toNCHW);
+        }
+
+        opset4::Interpolate::InterpolateAttrs attrs;
+        attrs.mode = opset4::Interpolate::InterpolateMode::LINEAR_ONNX;
+        attrs.shape_calculation_mode = opset4::Interpolate::ShapeCalcMode::SIZES;
+        attrs.coordinate_transformation_mode = opset4::Interpolate::CoordinateTransformMode::HALF_PIXEL;
+        attrs.nearest_mode = opset4::Interpolate::NearestMode::ROUND_PREFER_FLOOR;
+        attrs.pads_begin = std::vector<size_t>(inputShape.size(), 0);
+        attrs.pads_end = std::vector<size_t>(inputShape.size(), 0);
+        attrs.antialias = false;
+        attrs.cube_coeff = -0.75f;
+
+        const auto sizes = opset4::Constant::create(element::i64, Shape{targetShape.size()}, targetShape);
+        const auto scales = opset4::Constant::create(element::f32, Shape{2}, {
+                static_cast<float>(targetShape[0]) / inputShape[2], static_cast<float>(targetShape[1]) / inputShape[3]});
+        const auto axes = opset4::Constant::create(element::i64, Shape{2}, {2, 3});
+        const auto interpolate = std::make_shared<opset4::Interpolate>(convert, sizes, scales, axes, attrs);
+
+        // mean/scale normalization as generated by ov::preprocess::PrePostProcessor
+        const Shape constShape{1, inputShape[1], 1, 1};
+        const auto mean = builder::makeConstant<float>(element::f32, constShape, {}, true, 255.f, 0.f);
+        const auto subtract = std::make_shared<opset4::Subtract>(interpolate, mean);
+        const auto scale = builder::makeConstant<float>(element::f32, constShape, {}, true, 2.f, 0.5f);
+        const auto multiply = std::make_shared<opset4::Multiply>(subtract, scale);
+
+        ResultVector results{std::make_shared<opset4::Result>(multiply)};
+        function = std::make_shared<Function>(results, params, "FuseConvertAndInterpolate");
+    }
+};
+
+/* Test that the preprocessing chain is executed by a single node.
+
+    Parameter[U8]      (NV12 planes are converted to RGB by a separate ColorConvert node in U8)
+          |
+       Convert[FP32]   (dropped, Interpolate reads U8 directly)
+          |
+     Transpose[NHWC->NCHW] (only for NHWC and NV12 images, merged with the Reorder to nspc layout, so it's in place)
+          |
+     Interpolate[U8->FP32]
+          |
+       Subtract        (fused into Interpolate)
+          |
+       Multiply        (fused into Interpolate)
+          |
+     Output[FP32]
+*/
+TEST_P(FuseConvertAndInterpolateTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    if (InferenceEngine::with_cpu_x86_sse42()) {
+        CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+        CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+        CheckNumberOfNodesWithType(executableNetwork, "Transpose", 0);
+    }
+    CheckNumberOfNodesWithType(executableNetwork, "Interpolate", 1);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_FuseConvertAndInterpolate, FuseConvertAndInterpolateTest,
+    ::testing::Combine(
+        ::testing::Values(Shape{1, 3, 32, 48}, Shape{2, 16, 15, 20}),
+        ::testing::Values(Shape{64, 64}, Shape{8, 10}),
+        ::testing::Values(element::u8, element::i8),
+        ::testing::Values("NCHW", "NHWC")),
+    FuseConvertAndInterpolateTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FuseConvertAndInterpolate_NV12, FuseConvertAndInterpolateTest,
+    ::testing::Combine(
+        ::testing::Values(Shape{1, 3, 32, 48}, Shape{2, 3, 16, 20}),
+        ::testing::Values(Shape{64, 64}, Shape{8, 10}),
+        ::testing::Values(element::u8),
+        ::testing::Values("NV12")),
+    FuseConvertAndInterpolateTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
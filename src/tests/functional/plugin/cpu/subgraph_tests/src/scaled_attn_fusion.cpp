@@ -0,0 +1,229 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        size_t,                                            // Batch
+        size_t,                                            // Sequence length
+        size_t,                                            // Number of heads
+        size_t,                                            // Head size
+        bool,                                              // With mask
+        bool,                                              // Fused QKV projection
+        Precision                                          // Attention precision: FP32, BF16 or I8 queries and keys
+> ScaledAttnFusionParams;
+
+class ScaledAttnFusionTest : public testing::WithParamInterface<ScaledAttnFusionParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ScaledAttnFusionParams> &obj) {
+        size_t batch, seqLen, heads, headSize;
+        bool withMask, fusedQKV;
+        Precision precision;
+        std::tie(batch, seqLen, heads, headSize, withMask, fusedQKV, precision) = obj.param;
+
+        std::ostringstream results;
+        results << "B=" << batch
+                << "_L=" << seqLen
+                << "_H=" << heads
+                << "_D=" << headSize
+                << "_Mask=" << withMask
+                << "_FusedQKV=" << fusedQKV
+                << "_Prc=" << precision.name();
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        size_t batch, seqLen, heads, headSize;
+        bool withMask, fusedQKV;
+        std::tie(batch, seqLen, heads, headSize, withMask, fusedQKV, precision) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        inPrc = Precision::FP32;
+        outPrc = Precision::FP32;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SCALED_ATTN_FUSION, PluginConfigParams::YES});
+        if (precision == Precision::BF16) {
+            configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES});
+            threshold = 0.1f;
+        } else {
+            configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+        }
+
+        const size_t hidden = heads * headSize;
+        ParameterVector params;
+        OutputVector qkv;
+        if (fusedQKV) {
+            params.push_back(std::make_shared<opset8::Parameter>(element::f32, Shape{batch, seqLen, 3 * hidden}));
+            const auto axis = opset8::Constant::create(element::i64, Shape{}, {2});
+            const auto lengths = opset8::Constant::create(element::i64, Shape{3}, {hidden, hidden, hidden});
+            const auto split = std::make_shared<opset8::VariadicSplit>(params[0], axis, lengths);
+            qkv = split->outputs();
+        } else {
+            for (size_t i = 0; i < 3; i++) {
+                params.push_back(std::make_shared<opset8::Parameter>(element::f32, Shape{batch, seqLen, hidden}));
+                qkv.push_back(params.back());
+            }
+        }
+
+        const auto headsShape = opset8::Constant::create(element::i64, Shape{4}, {0, 0, heads, headSize});
+        const auto headsOrder = opset8::Constant::create(element::i64, Shape{4}, {0, 2, 1, 3});
+        const auto splitHeads = [&](const Output<Node>& input) {
+            const auto reshape = std::make_shared<opset8::Reshape>(input, headsShape, true);
+            return std::make_shared<opset8::Transpose>(reshape, headsOrder);
+        };
+        // the low precision transformations move the dequantization scales after the MatMul of the queries and keys,
+        // so the attention node reads I8 queries and keys and folds the scales into the attention scale
+        const auto quantize = [&](const Output<Node>& input) -> Output<Node> {
+            if (precision != Precision::I8)
+                return input;
+            return builder::makeFakeQuantize(input, element::f32, 256, {}, {-12.8f}, {12.7f}, {-12.8f}, {12.7f});
+        };
+
+        const auto scores = std::make_shared<opset8::MatMul>(splitHeads(quantize(qkv[0])), splitHeads(quantize(qkv[1])), false, true);
+        const auto norm = opset8::Constant::create(element::f32, Shape{}, {std::sqrt(static_cast<float>(headSize))});
+        std::shared_ptr<Node> logits = std::make_shared<opset8::Divide>(scores, norm);
+        if (withMask) {
+            params.push_back(std::make_shared<opset8::Parameter>(element::f32, Shape{batch, 1, 1, seqLen}));
+            logits = std::make_shared<opset8::Add>(logits, params.back());
+        }
+        const auto softmax = std::make_shared<opset8::Softmax>(logits, 3);
+        const auto context = std::make_shared<opset8::MatMul>(softmax, splitHeads(qkv[2]));
+
+        const auto transpose = std::make_shared<opset8::Transpose>(context, headsOrder);
+        const auto mergeShape = opset8::Constant::create(element::i64, Shape{3}, {0, 0, hidden});
+        const auto merge = std::make_shared<opset8::Reshape>(transpose, mergeShape, true);
+
+        ResultVector results{std::make_shared<opset8::Result>(merge)};
+        function = std::make_shared<Function>(results, params, "ScaledAttnFusion");
+    }
+
+    void CheckAttentionNode() {
+        if (!InferenceEngine::with_cpu_x86_avx2())
+            return;
+
+        CheckNumberOfNodesWithType(executableNetwork, "ScaledDotProductAttention", 1);
+        CheckNumberOfNodesWithType(executableNetwork, "Softmax", 0);
+        CheckNumberOfNodesWithType(executableNetwork, "MatMul", 0);
+
+        // the products with the keys and values are not JIT-ed, only the softmax exponent is
+        const auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+        for (const auto& node : execGraph->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() == "ScaledDotProductAttention") {
+                ASSERT_EQ("ref_any", rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>());
+            }
+        }
+    }
+
+    Precision precision;
+};
+
+/* Test that the attention subgraph is executed by a single node.
+
+     Q          K          V
+     |          |          |
+  Reshape    Reshape    Reshape
+     |          |          |
+  Transpose  Transpose  Transpose   (absorbed as the input orders)
+      \        /           |
+       MatMul              |
+         |                 |
+       Divide              |        (folded into the scale)
+         |                 |
+     Add(mask)             |
+         |                 |
+      Softmax              |
+          \               /
+             MatMul                 (ScaledDotProductAttention)
+               |
+           Transpose                (absorbed as the output order)
+               |
+            Reshape
+*/
+TEST_P(ScaledAttnFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    if (precision == Precision::BF16 && !InferenceEngine::with_cpu_x86_avx512_core())
+        GTEST_SKIP();
+
+    Run();
+    CheckAttentionNode();
+}
+
+class ScaledAttnFusionDisabledTest : public ScaledAttnFusionTest {
+protected:
+    void SetUp() override {
+        ScaledAttnFusionTest::SetUp();
+        configuration.erase(PluginConfigInternalParams::KEY_CPU_SCALED_ATTN_FUSION);
+    }
+};
+
+// The fusion is disabled by default, the attention subgraph is executed by the MatMul and Softmax nodes
+TEST_P(ScaledAttnFusionDisabledTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNumberOfNodesWithType(executableNetwork, "ScaledDotProductAttention", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Softmax", 1);
+    CheckNumberOfNodesWithType(executableNetwork, "MatMul", 2);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledAttnFusion, ScaledAttnFusionTest,
+    ::testing::Combine(
+        ::testing::Values(1, 2),
+        ::testing::Values(7, 33),
+        ::testing::Values(2),
+        ::testing::Values(16, 17),
+        ::testing::Values(true, false),
+        ::testing::Values(true, false),
+        ::testing::Values(Precision::FP32)),
+    ScaledAttnFusionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledAttnFusion_LowPrecision, ScaledAttnFusionTest,
+    ::testing::Combine(
+        ::testing::Values(2),
+        ::testing::Values(33),
+        ::testing::Values(2),
+        ::testing::Values(16),
+        ::testing::Values(true, false),
+        ::testing::Values(false),
+        ::testing::Values(Precision::BF16, Precision::I8)),
+    ScaledAttnFusionTest::getTestCaseName);
+
+// BERT-base attention shape, covers several key blocks of the streaming softmax
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledAttnFusion_Bert, ScaledAttnFusionTest,
+    ::testing::Combine(
+        ::testing::Values(1),
+        ::testing::Values(128, 384),
+        ::testing::Values(12),
+        ::testing::Values(64),
+        ::testing::Values(true),
+        ::testing::Values(false),
+        ::testing::Values(Precision::FP32)),
+    ScaledAttnFusionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledAttnFusion_Disabled, ScaledAttnFusionDisabledTest,
+    ::testing::Combine(
+        ::testing::Values(2),
+        ::testing::Values(33),
+        ::testing::Values(2),
+        ::testing::Values(16),
+        ::testing::Values(true),
+        ::testing::Values(false),
+        ::testing::Values(Precision::FP32)),
+    ScaledAttnFusionTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <vector>
 
 #include <ie_core.hpp>
@@ -1004,4 +1005,98 @@ TEST_P(InferRequestPreprocessTest, InferWithRGB2BGRConversion) {
     ASSERT_NO_THROW(req.Infer());
 }
 
+TEST_P(InferRequestPreprocessTest, InferWithResizeInConcurrentRequests) {
+    std::shared_ptr<ngraph::Function> ngraphFunc;
+    const unsigned int shape_size = 16, channels = 3, batch = 1;
+    {
+        ngraph::PartialShape shape({batch, channels, shape_size, shape_size});
+        ngraph::element::Type type(InferenceEngine::details::convertPrecision(netPrecision));
+        auto param = std::make_shared<ngraph::op::Parameter>(type, shape);
+        param->set_friendly_name("param");
+        auto relu = std::make_shared<ngraph::op::Relu>(param);
+        relu->set_friendly_name("relu");
+        auto result = std::make_shared<ngraph::op::Result>(relu);
+        result->set_friendly_name("result");
+
+        ngraph::ParameterVector params = {param};
+        ngraph::ResultVector results = {result};
+
+        ngraphFunc = std::make_shared<ngraph::Function>(results, params);
+    }
+
+    // Create CNNNetwork from ngraph::Function
+    InferenceEngine::CNNNetwork cnnNet(ngraphFunc);
+
+    auto &inputInfo = cnnNet.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(InferenceEngine::Precision::U8);
+    inputInfo->getPreProcess().setResizeAlgorithm(InferenceEngine::ResizeAlgorithm::RESIZE_BILINEAR);
+    cnnNet.getOutputsInfo().begin()->second->setPrecision(InferenceEngine::Precision::FP32);
+    // Load CNNNetwork to target plugins
+    auto execNet = ie->LoadNetwork(cnnNet, targetDevice, configuration);
+    const auto inputName = cnnNet.getInputsInfo().begin()->first;
+    const auto outputName = cnnNet.getOutputsInfo().begin()->first;
+
+    // The inputs are linear in the rows and the columns. The bilinear resize keeps them linear, so the
+    // output is compared to the function sampled at the source coordinates of the output pixels
+    struct LinearImage {
+        unsigned int size;
+        float rowStep;
+        float colStep;
+    };
+    const std::vector<LinearImage> images = {{2 * shape_size + 5, 6.f, 1.f}, {shape_size / 2, 20.f, 10.f}};
+    std::vector<InferenceEngine::Blob::Ptr> inputs;
+    for (const auto &image : images) {
+        InferenceEngine::Blob::Ptr blob = InferenceEngine::make_shared_blob<std::uint8_t>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {batch, channels, image.size, image.size},
+                                        InferenceEngine::Layout::NCHW));
+        blob->allocate();
+        auto lockedMem = blob->buffer();
+        auto *inData = lockedMem.as<std::uint8_t*>();
+        for (unsigned int c = 0; c < channels; c++)
+            for (unsigned int y = 0; y < image.size; y++)
+                for (unsigned int x = 0; x < image.size; x++)
+                    inData[(c * image.size + y) * image.size + x] =
+                        static_cast<std::uint8_t>(image.rowStep * y + image.colStep * x);
+        inputs.push_back(blob);
+    }
+
+    auto checkResized = [&](const InferenceEngine::Blob::Ptr &outBlob, const LinearImage &image) {
+        const float scale = static_cast<float>(image.size) / shape_size;
+        auto source = [&](unsigned int i) {
+            return std::min(std::max((i + 0.5f) * scale - 0.5f, 0.f), static_cast<float>(image.size - 1));
+        };
+        auto outMem = outBlob->cbuffer();
+        const auto* outData = outMem.as<const float*>();
+        ASSERT_EQ(batch * channels * shape_size * shape_size, outBlob->size());
+        for (unsigned int c = 0; c < channels; c++)
+            for (unsigned int y = 0; y < shape_size; y++)
+                for (unsigned int x = 0; x < shape_size; x++)
+                    // the resize computes in the fixed point
+                    ASSERT_NEAR(image.rowStep * source(y) + image.colStep * source(x),
+                                outData[(c * shape_size + y) * shape_size + x], 2.f)
+                        << "input size " << image.size << " channel " << c << " row " << y << " column " << x;
+    };
+
+    // the requests with the same index parity get the same input, the requests of the different
+    // parity take the compiled preprocessing of the other input size from the shared cache
+    const size_t requests_num = 4;
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (size_t i = 0; i < requests_num; i++) {
+        requests.push_back(execNet.CreateInferRequest());
+        requests.back().SetBlob(inputName, inputs[i % inputs.size()]);
+    }
+
+    for (size_t iteration = 0; iteration < 2; iteration++) {
+        for (auto &request : requests) {
+            ASSERT_NO_THROW(request.StartAsync());
+        }
+        for (auto &request : requests) {
+            ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY));
+        }
+        for (size_t i = 0; i < requests_num; i++) {
+            checkResized(requests[i].GetBlob(outputName), images[i % images.size()]);
+        }
+    }
+}
+
 }  // namespace BehaviorTestsDefinitions
@@ -22,6 +22,11 @@ public:
             const std::map<std::string, std::string> &,
             const std::function<void(const InferenceEngine::CNNNetwork&)> &));
 
+    MOCK_METHOD3(FindCachedNetwork, size_t(
+        const InferenceEngine::CNNNetwork&, const std::string&, const std::vector<std::map<std::string, std::string>>&));
+    MOCK_METHOD3(FindCachedNetwork, size_t(
+        const std::string&, const std::string&, const std::vector<std::map<std::string, std::string>>&));
+
     MOCK_METHOD3(ImportNetwork, InferenceEngine::SoExecutableNetworkInternal(
         std::istream&, const std::string&, const std::map<std::string, std::string>&));
     MOCK_METHOD3(ImportNetwork, InferenceEngine::SoExecutableNetworkInternal(
@@ -0,0 +1,152 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_metric_helpers.hpp>
+#include <common_test_utils/test_constants.hpp>
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_icore.hpp"
+#include "unit_test_utils/mocks/mock_iinfer_request.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/impl/mock_inference_plugin_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_ivariable_state_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinference_plugin.hpp"
+#include <ie_core.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "plugin/mock_auto_device_plugin.hpp"
+#include "cpp/ie_plugin.hpp"
+#include "mock_common.hpp"
+
+using ::testing::_;
+using ::testing::StrEq;
+using ::testing::Return;
+using ::testing::Property;
+using ::testing::Eq;
+using ::testing::NiceMock;
+using Config = std::map<std::string, std::string>;
+using namespace MockMultiDevice;
+
+using ConfigParams = std::tuple<
+        bool                  // accelerator network is in cache
+        >;
+class AutoLoadCachedNetworkTest : public ::testing::TestWithParam<ConfigParams> {
+public:
+    std::shared_ptr<ngraph::Function>                         function;
+    InferenceEngine::CNNNetwork                               cnnNet;
+    std::shared_ptr<NiceMock<MockICore>>                      core;
+    std::shared_ptr<NiceMock<MockMultiDeviceInferencePlugin>> plugin;
+
+    //mock exeNetwork helper
+    ov::SoPtr<IExecutableNetworkInternal>  mockExeNetwork;
+    //mock exeNetwork actual
+    ov::SoPtr<IExecutableNetworkInternal>  mockExeNetworkActual;
+    // config for Auto device
+    std::map<std::string, std::string>              config;
+    std::vector<DeviceInformation>                  metaDevices;
+    std::shared_ptr<NiceMock<MockIInferRequestInternal>>     inferReqInternal;
+    std::shared_ptr<NiceMock<MockIInferRequestInternal>>     inferReqInternalActual;
+    size_t optimalNum;
+
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ConfigParams> obj) {
+        bool accCached;
+        std::tie(accCached) = obj.param;
+        std::ostringstream result;
+        result << (accCached ? "accelerator_cached" : "accelerator_not_cached");
+        return result.str();
+    }
+
+    void TearDown() override {
+        core.reset();
+        plugin.reset();
+        mockExeNetwork = {};
+        mockExeNetworkActual = {};
+        config.clear();
+        metaDevices.clear();
+        inferReqInternal.reset();
+        inferReqInternalActual.reset();
+    }
+
+    void SetUp() override {
+       // prepare mockExeNetwork
+       auto mockIExeNet = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+       mockExeNetwork = {mockIExeNet, {}};
+
+       auto mockIExeNetActual = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+       mockExeNetworkActual = {mockIExeNetActual, {}};
+
+       // prepare mockicore and cnnNetwork for loading
+       core = std::make_shared<NiceMock<MockICore>>();
+       NiceMock<MockMultiDeviceInferencePlugin>* mock_multi = new NiceMock<MockMultiDeviceInferencePlugin>();
+       plugin.reset(mock_multi);
+       function = ngraph::builder::subgraph::makeConvPoolRelu();
+       cnnNet = InferenceEngine::CNNNetwork(function);
+       // replace core with mock Icore
+       plugin->SetCore(core);
+       // mock execNetwork can work
+       inferReqInternal = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+       ON_CALL(*mockIExeNet.get(), CreateInferRequest()).WillByDefault(Return(inferReqInternal));
+       IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, optimalNum, 1);
+       ON_CALL(*mockIExeNet.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+           .WillByDefault(Return(optimalNum));
+       inferReqInternalActual = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+       ON_CALL(*mockIExeNetActual.get(), CreateInferRequest()).WillByDefault(Return(inferReqInternalActual));
+       ON_CALL(*mockIExeNetActual.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+           .WillByDefault(Return(optimalNum));
+       IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, supportConfigs, {});
+       ON_CALL(*core, GetMetric(_, StrEq(METRIC_KEY(SUPPORTED_CONFIG_KEYS)), _))
+           .WillByDefault(Return(supportConfigs));
+       ON_CALL(*core, GetConfig(_, StrEq(GPU_CONFIG_KEY(MAX_NUM_THREADS))))
+           .WillByDefault(Return(12));
+    }
+};
+
+TEST_P(AutoLoadCachedNetworkTest, skipCPUHelperIfAcceleratorIsCached) {
+    bool accCached;
+    std::tie(accCached) = this->GetParam();
+    config.insert({CONFIG_KEY_INTERNAL(MULTI_WORK_MODE_AS_AUTO), InferenceEngine::PluginConfigParams::YES});
+
+    // the network is hashed once for the accelerator and never for the CPU helper
+    EXPECT_CALL(*core, FindCachedNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_GPU)),
+                ::testing::Matcher<const std::vector<Config>&>(_)))
+                .Times(1)
+                .WillOnce(::testing::Invoke([accCached](const InferenceEngine::CNNNetwork&,
+                                                        const std::string&,
+                                                        const std::vector<Config>& configs) {
+                    return accCached ? size_t{0} : configs.size();
+                }));
+    EXPECT_CALL(*core, FindCachedNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_CPU)),
+                ::testing::Matcher<const std::vector<Config>&>(_))).Times(0);
+    ON_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_GPU)),
+                ::testing::Matcher<const Config&>(_))).WillByDefault(Return(mockExeNetworkActual));
+    EXPECT_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_CPU)),
+                ::testing::Matcher<const Config&>(_)))
+                .Times(accCached ? 0 : 1).WillRepeatedly(Return(mockExeNetwork));
+
+    metaDevices = {{CommonTestUtils::DEVICE_CPU, {}, -1}, {CommonTestUtils::DEVICE_GPU, {}, -1}};
+    ON_CALL(*plugin, ParseMetaDevices(_, _)).WillByDefault(Return(metaDevices));
+    ON_CALL(*plugin, SelectDevice(Property(&std::vector<DeviceInformation>::size, Eq(2)), _, _))
+            .WillByDefault(Return(metaDevices[1]));
+    config.insert({InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                  CommonTestUtils::DEVICE_CPU + std::string(",") + CommonTestUtils::DEVICE_GPU});
+    std::shared_ptr<InferenceEngine::IExecutableNetworkInternal> exeNetwork;
+    ASSERT_NO_THROW(exeNetwork = plugin->LoadExeNetworkImpl(cnnNet, config));
+
+    const std::string expectedPath = accCached ? "ACTUAL_DEVICE_FROM_CACHE" : "CPU_HELP";
+    EXPECT_EQ(exeNetwork->GetMetric(METRIC_KEY(AUTO_STARTUP_PATH)).as<std::string>(), expectedPath);
+    EXPECT_EQ(exeNetwork->GetMetric(METRIC_KEY(AUTO_TIME_TO_FIRST_INFERENCE_MS)).as<double>(), -1.0);
+}
+
+const std::vector<ConfigParams> testConfigs = {ConfigParams {true},
+                                               ConfigParams {false}
+                                              };
+
+INSTANTIATE_TEST_SUITE_P(smoke_Auto_BehaviorTests, AutoLoadCachedNetworkTest,
+                ::testing::ValuesIn(testConfigs),
+            AutoLoadCachedNetworkTest::getTestCaseName);
@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_metric_helpers.hpp>
+#include <common_test_utils/test_constants.hpp>
+#include "unit_test_utils/mocks/mock_iinfer_request.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinference_plugin.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include <multi-device/multi_device_config.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "plugin/mock_auto_device_plugin.hpp"
+#include "mock_common.hpp"
+
+using ::testing::_;
+using ::testing::StrEq;
+using ::testing::Return;
+using ::testing::NiceMock;
+using namespace MockMultiDevice;
+
+using ConfigParams = std::tuple<
+        double,                      // average latency of GPU, 0 if GPU was not measured yet
+        unsigned int,                // GPU requests in flight
+        double,                      // average latency of CPU
+        std::string                  // expected device
+        >;
+class LatencyAwareSchedulingTest : public ::testing::TestWithParam<ConfigParams> {
+public:
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> gpuMockIExeNet;
+    std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>> cpuMockIExeNet;
+    std::shared_ptr<NiceMock<MockIInferRequestInternal>>      inferReqInternal;
+    std::vector<DeviceInformation>                            devices;
+    std::shared_ptr<MultiDeviceExecutableNetwork>             multiExeNetwork;
+
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ConfigParams> obj) {
+        double gpuLatency;
+        unsigned int gpuInFlight;
+        double cpuLatency;
+        std::string expectedDevice;
+        std::tie(gpuLatency, gpuInFlight, cpuLatency, expectedDevice) = obj.param;
+        std::ostringstream result;
+        result << "gpuLatency_" << gpuLatency << "_gpuInFlight_" << gpuInFlight
+               << "_cpuLatency_" << cpuLatency << "_expectedDevice_" << expectedDevice;
+        return result.str();
+    }
+
+    void TearDown() override {
+        multiExeNetwork.reset();
+        gpuMockIExeNet.reset();
+        cpuMockIExeNet.reset();
+        inferReqInternal.reset();
+        devices.clear();
+    }
+
+    void SetUp() override {
+        inferReqInternal = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+        IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, optimalNum, 1);
+        gpuMockIExeNet = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+        ON_CALL(*gpuMockIExeNet.get(), CreateInferRequest()).WillByDefault(Return(inferReqInternal));
+        ON_CALL(*gpuMockIExeNet.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+            .WillByDefault(Return(optimalNum));
+        cpuMockIExeNet = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+        ON_CALL(*cpuMockIExeNet.get(), CreateInferRequest()).WillByDefault(Return(inferReqInternal));
+        ON_CALL(*cpuMockIExeNet.get(), GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+            .WillByDefault(Return(optimalNum));
+
+        // GPU has the higher priority
+        devices.push_back({CommonTestUtils::DEVICE_GPU, {}, -1, ""});
+        devices.push_back({CommonTestUtils::DEVICE_CPU, {}, -1, ""});
+        DeviceMap<SoExecutableNetworkInternal> networksPerDevice;
+        networksPerDevice[CommonTestUtils::DEVICE_GPU] = {gpuMockIExeNet, {}};
+        networksPerDevice[CommonTestUtils::DEVICE_CPU] = {cpuMockIExeNet, {}};
+        std::unordered_map<std::string, InferenceEngine::Parameter> config = {
+            {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+             std::string(InferenceEngine::MultiDeviceConfigParams::MULTI_LATENCY_AWARE)}};
+        multiExeNetwork = std::make_shared<MultiDeviceExecutableNetwork>(networksPerDevice, devices, config);
+    }
+
+    void setStatistics(const std::string& device, double latency, unsigned int inFlight) {
+        auto& statistics = multiExeNetwork->_dispatchStatistics[device];
+        statistics._avgLatency = latency;
+        statistics._hasSamples = latency > 0.0;
+        statistics._inFlight = inFlight;
+    }
+};
+
+TEST_P(LatencyAwareSchedulingTest, selectDeviceWithLowestCompletionTime) {
+    double gpuLatency;
+    unsigned int gpuInFlight;
+    double cpuLatency;
+    std::string expectedDevice;
+    std::tie(gpuLatency, gpuInFlight, cpuLatency, expectedDevice) = this->GetParam();
+    setStatistics(CommonTestUtils::DEVICE_GPU, gpuLatency, gpuInFlight);
+    setStatistics(CommonTestUtils::DEVICE_CPU, cpuLatency, 0);
+
+    EXPECT_EQ(expectedDevice, multiExeNetwork->SelectFastestDevice(devices).deviceName);
+}
+
+TEST_F(LatencyAwareSchedulingTest, completionTimeGrowsWithRequestsInFlight) {
+    setStatistics(CommonTestUtils::DEVICE_GPU, 2.0, 0);
+    const double idleTime = multiExeNetwork->EstimateCompletionTime(CommonTestUtils::DEVICE_GPU);
+    EXPECT_DOUBLE_EQ(2.0, idleTime);
+
+    // a single worker request drains the queue of 4 requests one by one
+    setStatistics(CommonTestUtils::DEVICE_GPU, 2.0, 3);
+    EXPECT_DOUBLE_EQ(8.0, multiExeNetwork->EstimateCompletionTime(CommonTestUtils::DEVICE_GPU));
+}
+
+TEST_F(LatencyAwareSchedulingTest, dispatchStatisticsMetricReportsEstimation) {
+    setStatistics(CommonTestUtils::DEVICE_GPU, 2.0, 0);
+    setStatistics(CommonTestUtils::DEVICE_CPU, 10.0, 0);
+
+    auto statistics = multiExeNetwork->GetMetric(METRIC_KEY(MULTI_DEVICE_DISPATCH_STATISTICS))
+                          .as<std::map<std::string, std::map<std::string, double>>>();
+    ASSERT_EQ(2, statistics.size());
+    EXPECT_DOUBLE_EQ(2.0, statistics[CommonTestUtils::DEVICE_GPU]["EXPECTED_COMPLETION_MS"]);
+    EXPECT_DOUBLE_EQ(10.0, statistics[CommonTestUtils::DEVICE_CPU]["EXPECTED_COMPLETION_MS"]);
+}
+
+// ConfigParams {double, unsigned int, double, std::string}
+//
+// every element for ConfigParams
+// {GPU average latency, GPU requests in flight, CPU average latency, expected device}
+//
+const std::vector<ConfigParams> testConfigs = {
+                                               // the faster device wins
+                                               ConfigParams {2.0, 0, 10.0, CommonTestUtils::DEVICE_GPU},
+                                               ConfigParams {10.0, 0, 2.0, CommonTestUtils::DEVICE_CPU},
+                                               // the faster device is busy, waiting for it takes longer than the slower idle one
+                                               ConfigParams {2.0, 9, 10.0, CommonTestUtils::DEVICE_CPU},
+                                               // the faster device is busy, but waiting for it still takes less time
+                                               ConfigParams {2.0, 3, 10.0, CommonTestUtils::DEVICE_GPU},
+                                               // the higher priority device wins if the estimations are equal
+                                               ConfigParams {5.0, 0, 5.0, CommonTestUtils::DEVICE_GPU},
+                                               // the not measured device takes a request to get the first latency sample
+                                               ConfigParams {0.0, 0, 2.0, CommonTestUtils::DEVICE_GPU},
+                                               ConfigParams {0.0, 1, 2.0, CommonTestUtils::DEVICE_CPU},
+                                              };
+
+INSTANTIATE_TEST_SUITE_P(smoke_Multi_LatencyAwareScheduling, LatencyAwareSchedulingTest,
+                ::testing::ValuesIn(testConfigs),
+            LatencyAwareSchedulingTest::getTestCaseName);
@@ -15,6 +15,7 @@
 #include <ngraph_transformations/fc_bias_fusion.hpp>
 #include <transformations/init_node_info.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <ngraph/pass/manager.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
@@ -509,3 +510,35 @@ TEST(TransformationTests, ConvertMatMulToFCTest_second_input_rank_adj_3) {
     auto res = compare_functions(f, f_ref, true);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompressed_weights) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto makeWeights = []() {
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 3, 2 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        ov::disable_constant_folding(convert);
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 3, 1 }, { 0.5f });
+        return std::make_shared<ngraph::opset1::Multiply>(convert, scales);
+    };
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 3, 2, 2 });
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, makeWeights(), false, true);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ConvertMatMulToFC>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 3, 2, 2 });
+        auto matmul = std::make_shared<FullyConnectedNode>(input1, makeWeights(), ngraph::Rank(3));
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
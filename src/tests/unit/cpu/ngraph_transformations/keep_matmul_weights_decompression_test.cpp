@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_transformations/keep_matmul_weights_decompression.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+#include <transformations/rt_info/keep_const_precision.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+TEST(TransformationTests, KeepMatMulWeightsDecompressionTest_f16) {
+    std::shared_ptr<ngraph::Function> f(nullptr);
+    std::shared_ptr<ngraph::Node> weights, convert;
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16 });
+        weights = ngraph::opset1::Constant::create(ngraph::element::f16, ngraph::Shape{ 8, 16 }, { 1 });
+        convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input, convert, false, true);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<KeepMatMulWeightsDecompression>();
+        m.run_passes(f);
+    }
+
+    ASSERT_TRUE(ov::pass::constant_folding_is_disabled(convert));
+    ASSERT_TRUE(ov::is_keep_const_precision(weights));
+}
+
+TEST(TransformationTests, KeepMatMulWeightsDecompressionTest_u8_transposed) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 3 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 3, 2 }, { 1, 2, 3, 4, 5, 6 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zeroPoints = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 2 }, { 1.f, 2.f });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zeroPoints);
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 2 }, { 0.5f, 0.25f });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scales);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input, multiply);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<KeepMatMulWeightsDecompression>();
+        m.run_passes(f);
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 3 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 2, 3 }, { 1, 3, 5, 2, 4, 6 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zeroPoints = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 2, 1 }, { 1.f, 2.f });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zeroPoints);
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 2, 1 }, { 0.5f, 0.25f });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scales);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input, multiply, false, true);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, KeepMatMulWeightsDecompressionTest_per_input_channel_scales) {
+    std::shared_ptr<ngraph::Function> f(nullptr);
+    std::shared_ptr<ngraph::Node> convert;
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 16 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 8, 16 }, { 1 });
+        convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto scales = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 16 }, { 0.5f });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scales);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input, multiply, false, true);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<KeepMatMulWeightsDecompression>();
+        m.run_passes(f);
+    }
+
+    // the scales are applied per input channel, so the FullyConnected node can't apply them to the result
+    ASSERT_FALSE(ov::pass::constant_folding_is_disabled(convert));
+}
+
+TEST(TransformationTests, KeepMatMulWeightsDecompressionTest_rows) {
+    auto isApplied = [](const ngraph::PartialShape& inputShape) {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, inputShape);
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f16, ngraph::Shape{ 8, 16 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input, convert, false, true);
+
+        auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<KeepMatMulWeightsDecompression>(16);
+        m.run_passes(f);
+        return ov::pass::constant_folding_is_disabled(convert);
+    };
+
+    ASSERT_TRUE(isApplied(ngraph::PartialShape{ 16, 16 }));
+    ASSERT_TRUE(isApplied(ngraph::PartialShape{ 2, 8, 16 }));
+    ASSERT_TRUE(isApplied(ngraph::PartialShape{ ngraph::Dimension(1, 4), ngraph::Dimension(1, 4), 16 }));
+    // the large matrices are multiplied by oneDNN over the folded weights
+    ASSERT_FALSE(isApplied(ngraph::PartialShape{ 17, 16 }));
+    ASSERT_FALSE(isApplied(ngraph::PartialShape{ 4, 5, 16 }));
+    ASSERT_FALSE(isApplied(ngraph::PartialShape{ ngraph::Dimension::dynamic(), 16 }));
+    ASSERT_FALSE(isApplied(ngraph::PartialShape{ 1, ngraph::Dimension(1, 32), 16 }));
+}
@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include <edge.h>
+#include <node.h>
+#include <perf_count.h>
+#include <utils/roofline.h>
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+class RooflineTestNode : public MKLDNNNode {
+public:
+    RooflineTestNode(const std::string& type, const std::string& name, const mkldnn::engine& eng,
+                     MKLDNNWeightsSharing::Ptr& cache)
+        : MKLDNNNode(type, name, eng, cache) {}
+
+    void getSupportedDescriptors() override {}
+    bool created() const override { return true; }
+};
+
+/*
+ * Builds the node of the given type with the FP32 inputs and one output of the given shapes,
+ * the memory of the edges is allocated, so the roofline sees the tensor sizes as after the graph allocation.
+ */
+class RooflineTest : public ::testing::Test {
+protected:
+    MKLDNNNodePtr makeNode(const std::string& type, const std::vector<VectorDims>& inputs, const VectorDims& output) {
+        auto node = std::make_shared<RooflineTestNode>(type, type, cpuEngine, weightsCache);
+        for (size_t i = 0; i < inputs.size(); i++) {
+            auto parent = std::make_shared<RooflineTestNode>("Input", "in" + std::to_string(i),
+                                                             cpuEngine, weightsCache);
+            connect(std::make_shared<MKLDNNEdge>(parent, node, 0, i), inputs[i]);
+            nodes.push_back(parent);
+        }
+        auto child = std::make_shared<RooflineTestNode>("Output", "out", cpuEngine, weightsCache);
+        connect(std::make_shared<MKLDNNEdge>(node, child, 0, 0), output);
+        nodes.push_back(child);
+        return node;
+    }
+
+    const mkldnn::engine cpuEngine{dnnl::engine::kind::cpu, 0};
+    MKLDNNWeightsSharing::Ptr weightsCache;
+
+private:
+    void connect(const MKLDNNEdgePtr& edge, const VectorDims& dims) {
+        edge->changeStatus(MKLDNNEdge::Status::NeedAllocation);
+        auto memory = std::make_shared<MKLDNNMemory>(cpuEngine);
+        memory->Create(CpuBlockedMemoryDesc(InferenceEngine::Precision::FP32, Shape(dims)));
+        edge->reuse(memory);
+        edge->getParent()->addEdge(edge);
+        edges.push_back(edge);
+    }
+
+    // the nodes keep only the weak pointers to the edges and to the other nodes
+    std::vector<MKLDNNEdgePtr> edges;
+    std::vector<MKLDNNNodePtr> nodes;
+};
+
+}  // namespace
+
+TEST_F(RooflineTest, convolutionFlopsAreTwiceMacs) {
+    auto conv = makeNode("Convolution", {{1, 16, 32, 32}, {32, 16, 3, 3}}, {1, 32, 32, 32});
+    // 2 * N * OC * OH * OW * IC * KH * KW
+    EXPECT_DOUBLE_EQ(2.0 * 1 * 32 * 32 * 32 * 16 * 3 * 3, estimateFlops(conv));
+}
+
+TEST_F(RooflineTest, fullyConnectedFlopsAreTwiceMacs) {
+    auto fc = makeNode("FullyConnected", {{8, 64}, {128, 64}}, {8, 128});
+    // 2 * M * K * N
+    EXPECT_DOUBLE_EQ(2.0 * 8 * 64 * 128, estimateFlops(fc));
+}
+
+TEST_F(RooflineTest, otherNodeFlopsAreOutputElements) {
+    auto add = makeNode("Add", {{1, 16, 32, 32}, {1, 16, 32, 32}}, {1, 16, 32, 32});
+    EXPECT_DOUBLE_EQ(1.0 * 16 * 32 * 32, estimateFlops(add));
+}
+
+TEST_F(RooflineTest, nodeWithoutExecutionHasNoRoofline) {
+    auto fc = makeNode("FullyConnected", {{8, 64}, {128, 64}}, {8, 128});
+    MachinePeaks peaks;
+    peaks.threads = 1;
+    peaks.peakGFlops = 100;
+    peaks.bandwidthGBs = 10;
+    const auto roofline = getNodeRoofline(fc, peaks);
+    EXPECT_DOUBLE_EQ(0, roofline.timeUs);
+    EXPECT_DOUBLE_EQ(0, roofline.flops);
+}
+
+TEST_F(RooflineTest, convolutionPlacementFollowsRidgePoint) {
+    auto conv = makeNode("Convolution", {{1, 16, 32, 32}, {32, 16, 3, 3}}, {1, 32, 32, 32});
+    {
+        PerfHelper helper(conv->PerfCounter());
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    // without the hardware counters the traffic is the size of the input, weights and output tensors
+    const double bytes = 4.0 * (1 * 16 * 32 * 32 + 32 * 16 * 3 * 3 + 1 * 32 * 32 * 32);
+    const double intensity = estimateFlops(conv) / bytes;
+
+    MachinePeaks peaks;
+    peaks.threads = 1;
+    peaks.peakGFlops = 1000;
+    // the ridge point is above the intensity of the convolution
+    peaks.bandwidthGBs = 1;
+    auto roofline = getNodeRoofline(conv, peaks);
+    ASSERT_GT(roofline.timeUs, 0);
+    // the throughput is based on the wall time, the CPU time is not known without the hardware counters
+    EXPECT_DOUBLE_EQ(static_cast<double>(conv->PerfCounter().avg()), roofline.timeUs);
+    EXPECT_DOUBLE_EQ(0, roofline.cpuTimeUs);
+    EXPECT_DOUBLE_EQ(bytes, roofline.bytes);
+    EXPECT_DOUBLE_EQ(intensity, roofline.arithmeticIntensity);
+    EXPECT_DOUBLE_EQ(roofline.flops / roofline.timeUs / 1000.0, roofline.gflops);
+    EXPECT_TRUE(roofline.memoryBound);
+    EXPECT_DOUBLE_EQ(roofline.gflops / (intensity * peaks.bandwidthGBs), roofline.efficiency);
+
+    // the ridge point is below the intensity of the convolution
+    peaks.bandwidthGBs = 1000;
+    roofline = getNodeRoofline(conv, peaks);
+    EXPECT_FALSE(roofline.memoryBound);
+    EXPECT_DOUBLE_EQ(roofline.gflops / peaks.peakGFlops, roofline.efficiency);
+}
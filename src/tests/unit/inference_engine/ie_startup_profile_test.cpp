@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "ie_startup_profile.hpp"
+#include "ie_tracer.hpp"
+
+using namespace ov;
+
+namespace {
+size_t count(const std::string& str, const std::string& substr) {
+    size_t result = 0;
+    for (auto pos = str.find(substr); pos != std::string::npos; pos = str.find(substr, pos + 1)) {
+        ++result;
+    }
+    return result;
+}
+}  // namespace
+
+TEST(StartupProfileTests, emptyProfileHasNoPhases) {
+    StartupProfile profile;
+    auto json = profile.to_json();
+    EXPECT_EQ(0u, json.find("{\"phases\": []"));
+    EXPECT_NE(std::string::npos, json.find("\"peak_rss_mb\""));
+}
+
+TEST(StartupProfileTests, claimSucceedsOnlyOnce) {
+    StartupProfile profile;
+    EXPECT_TRUE(profile.claim("first_inference"));
+    EXPECT_FALSE(profile.claim("first_inference"));
+    EXPECT_TRUE(profile.claim("other"));
+}
+
+TEST(StartupProfileTests, sameNamePhasesAreAggregated) {
+    StartupProfile profile;
+    auto parent = profile.begin(nullptr, "compile_model", profile.now_ms());
+    for (int i = 0; i < 3; i++) {
+        auto start = profile.now_ms();
+        profile.end(profile.begin(parent, "pass", start), start);
+    }
+    profile.end(parent, 0);
+    auto json = profile.to_json();
+    EXPECT_EQ(1u, count(json, "\"name\": \"pass\""));
+    EXPECT_NE(std::string::npos, json.find("\"name\": \"pass\", \"count\": 3"));
+}
+
+TEST(StartupProfileTests, listenerIgnoresTasksOutsideOfSession) {
+    auto profile = std::make_shared<StartupProfile>();
+    runtimeTaskListener().taskBegin("outside");
+    runtimeTaskListener().taskEnd();
+    {
+        StartupProfiler profiler(profile, "compile_model");
+        runtimeTaskListener().taskBegin("inside");
+        runtimeTaskListener().taskEnd();
+        // unbalanced end must not close the phase of the session
+        runtimeTaskListener().taskEnd();
+        EXPECT_NE(nullptr, StartupProfiler::current().phase);
+    }
+    EXPECT_EQ(nullptr, StartupProfiler::current().profile);
+    auto json = profile->to_json();
+    EXPECT_EQ(std::string::npos, json.find("outside"));
+    EXPECT_NE(std::string::npos, json.find("{\"name\": \"compile_model\""));
+    EXPECT_NE(std::string::npos, json.find("{\"name\": \"inside\""));
+}
+
+TEST(StartupProfileTests, contextContinuesSessionInOtherThread) {
+    auto profile = std::make_shared<StartupProfile>();
+    {
+        StartupProfiler profiler(profile, "compile_model");
+        auto context = StartupProfiler::current();
+        std::thread worker([&] {
+            StartupProfiler workerProfiler(context, "stream");
+            runtimeTaskListener().taskBegin("CreateGraph");
+            runtimeTaskListener().taskEnd();
+        });
+        worker.join();
+    }
+    auto json = profile->to_json();
+    auto compile = json.find("\"compile_model\"");
+    auto stream = json.find("\"stream\"");
+    auto graph = json.find("\"CreateGraph\"");
+    ASSERT_NE(std::string::npos, graph);
+    EXPECT_LT(compile, stream);
+    EXPECT_LT(stream, graph);
+}
+
+TEST(StartupProfileTests, emptyProfilerDoesNothing) {
+    StartupProfiler profiler(StartupProfile::Ptr{}, "compile_model");
+    EXPECT_EQ(nullptr, StartupProfiler::current().profile);
+}
+
+TEST(StartupProfileTests, listenerIsActiveOnlyInsideSession) {
+    if (Tracer::isStarted()) {
+        GTEST_SKIP() << "The tracer keeps the listener active";
+    }
+    EXPECT_FALSE(StartupProfiler::isActive());
+    EXPECT_FALSE(runtimeTaskListener().isActive());
+    {
+        StartupProfiler profiler(std::make_shared<StartupProfile>(), "compile_model");
+        EXPECT_TRUE(StartupProfiler::isActive());
+        EXPECT_TRUE(runtimeTaskListener().isActive());
+    }
+    EXPECT_FALSE(runtimeTaskListener().isActive());
+}
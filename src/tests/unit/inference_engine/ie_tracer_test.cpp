@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "ie_tracer.hpp"
+
+using namespace ov;
+
+namespace {
+OV_ITT_DOMAIN(TracerTestsDomain);
+}  // namespace
+
+class TracerTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+        path = std::string(testInfo->test_case_name()) + "_" + testInfo->name() + "_trace.json";
+        Tracer::clear();
+    }
+
+    void TearDown() override {
+        Tracer::stop();
+        Tracer::clear();
+        std::remove(path.c_str());
+    }
+
+    std::string dump() {
+        Tracer::dump(path);
+        std::ifstream file(path);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    static size_t count(const std::string& str, const std::string& substr) {
+        size_t result = 0;
+        for (auto pos = str.find(substr); pos != std::string::npos; pos = str.find(substr, pos + 1)) {
+            ++result;
+        }
+        return result;
+    }
+
+    std::string path;
+};
+
+TEST_F(TracerTests, recordsTasksOnlyWhenStarted) {
+    runtimeTaskListener().taskBegin("beforeStart");
+    runtimeTaskListener().taskEnd();
+    Tracer::start();
+    ASSERT_TRUE(Tracer::isStarted());
+    runtimeTaskListener().taskBegin("outer");
+    runtimeTaskListener().taskBegin("inner \"quoted\"");
+    runtimeTaskListener().taskEnd();
+    runtimeTaskListener().taskEnd();
+    Tracer::stop();
+    runtimeTaskListener().taskBegin("afterStop");
+    runtimeTaskListener().taskEnd();
+
+    auto trace = dump();
+    EXPECT_EQ(0u, trace.find("{\"displayTimeUnit\": \"ns\", \"traceEvents\": ["));
+    EXPECT_EQ(std::string::npos, trace.find("beforeStart"));
+    EXPECT_EQ(std::string::npos, trace.find("afterStop"));
+    EXPECT_LT(trace.find("\"name\": \"outer\", \"ph\": \"B\""), trace.find("\"name\": \"inner \\\"quoted\\\"\""));
+    EXPECT_EQ(2u, count(trace, "\"ph\": \"E\""));
+}
+
+TEST_F(TracerTests, recordsThreadNames) {
+    Tracer::start();
+    std::thread worker([] {
+        runtimeTaskListener().threadName("worker_0");
+        runtimeTaskListener().taskBegin("task");
+        runtimeTaskListener().taskEnd();
+    });
+    worker.join();
+    EXPECT_NE(std::string::npos, dump().find("\"args\": {\"name\": \"worker_0\"}"));
+}
+
+TEST_F(TracerTests, keepsLatestEventsOfThread) {
+    Tracer::start(4);
+    std::thread worker([] {
+        for (int i = 0; i < 4; i++) {
+            runtimeTaskListener().taskBegin("old");
+            runtimeTaskListener().taskEnd();
+        }
+        runtimeTaskListener().taskBegin("new");
+        runtimeTaskListener().taskEnd();
+    });
+    worker.join();
+    auto trace = dump();
+    EXPECT_EQ(1u, count(trace, "\"name\": \"old\""));
+    EXPECT_EQ(1u, count(trace, "\"name\": \"new\""));
+}
+
+TEST_F(TracerTests, clearDropsRecordedEvents) {
+    Tracer::start();
+    runtimeTaskListener().taskBegin("cleared");
+    runtimeTaskListener().taskEnd();
+    Tracer::clear();
+    EXPECT_EQ(std::string::npos, dump().find("cleared"));
+}
+
+TEST_F(TracerTests, conditionalScopeRecordsOnlyIfConditionHolds) {
+    // the listener of the tests module, the runtime library registers it for its own tasks only
+    openvino::itt::setTaskListener(&runtimeTaskListener());
+    Tracer::start();
+    const auto handle = openvino::itt::handle("conditional");
+    { OV_ITT_SCOPED_TASK_IF(false, TracerTestsDomain, handle); }
+    { OV_ITT_SCOPED_TASK_IF(Tracer::isStarted(), TracerTestsDomain, handle); }
+#ifdef ENABLE_PROFILING_ALL
+    // the builds with all the counters record the scopes unconditionally
+    EXPECT_EQ(2u, count(dump(), "\"ph\": \"E\""));
+#else
+    EXPECT_EQ(1u, count(dump(), "\"ph\": \"E\""));
+#endif
+}
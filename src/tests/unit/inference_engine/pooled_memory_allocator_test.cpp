@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "system_allocator.hpp"
+
+using namespace InferenceEngine;
+
+class PooledMemoryAllocatorTests : public CommonTestUtils::TestsCommon {
+};
+
+TEST_F(PooledMemoryAllocatorTests, returnsAlignedMemory) {
+    PooledMemoryAllocator allocator;
+    for (size_t size : {0, 1, 64, 65, 1000, 100000, 1 << 26, (1 << 26) + 1}) {
+        void *handle = allocator.alloc(size);
+        ASSERT_NE(handle, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(handle) % 64, 0);
+        if (size) {
+            char *ptr = reinterpret_cast<char *>(allocator.lock(handle));
+            ptr[0] = 11;
+            ptr[size - 1] = 11;
+            allocator.unlock(ptr);
+        }
+        EXPECT_TRUE(allocator.free(handle));
+    }
+    EXPECT_TRUE(allocator.free(nullptr));
+}
+
+TEST_F(PooledMemoryAllocatorTests, canFreeMemoryOfOtherInstance) {
+    void *handle = PooledMemoryAllocator().alloc(1000);
+    ASSERT_NE(handle, nullptr);
+    EXPECT_TRUE(PooledMemoryAllocator().free(handle));
+}
+
+TEST_F(PooledMemoryAllocatorTests, reusesFreedBlock) {
+    PooledMemoryAllocator allocator;
+    // the size is unlikely to be cached by other tests, so the freed block is the only one of its size class
+    const size_t size = 3 * 1024 * 1024 + 17;
+    void *handle = allocator.alloc(size);
+    ASSERT_NE(handle, nullptr);
+    EXPECT_TRUE(allocator.free(handle));
+
+    // the sizes of the same size class get the same block
+    void *reused = allocator.alloc(size - 16);
+    EXPECT_EQ(handle, reused);
+    EXPECT_TRUE(allocator.free(reused));
+}
+
+TEST_F(PooledMemoryAllocatorTests, keepsCachedBytesInBudget) {
+    PooledMemoryAllocator allocator;
+    // several size classes of large blocks exceed the budget together, the blocks are not touched, so the memory is
+    // not committed
+    std::vector<void *> handles;
+    for (size_t size : {20 << 20, 24 << 20, 28 << 20, 32 << 20}) {
+        for (size_t i = 0; i < 2; i++) {
+            handles.push_back(allocator.alloc(size));
+            ASSERT_NE(handles.back(), nullptr);
+        }
+    }
+    for (auto handle : handles) {
+        EXPECT_TRUE(allocator.free(handle));
+        EXPECT_LE(PooledMemoryAllocator::cachedBytes(), PooledMemoryAllocator::maxCachedBytes);
+    }
+    EXPECT_GT(PooledMemoryAllocator::cachedBytes(), 0);
+}
+
+TEST_F(PooledMemoryAllocatorTests, defaultAllocatorIsPooled) {
+    auto allocator = CreateDefaultAllocator();
+    ASSERT_NE(std::dynamic_pointer_cast<PooledMemoryAllocator>(allocator), nullptr);
+}
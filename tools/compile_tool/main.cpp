@@ -6,7 +6,13 @@
 #include <iostream>
 #include <fstream>
 #include <algorithm>
+#include <atomic>
+#include <cctype>
 #include <chrono>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -16,6 +22,7 @@
 
 #include "inference_engine.hpp"
 #include "openvino/openvino.hpp"
+#include "openvino/util/file_util.hpp"
 #include <vpu/private_plugin_config.hpp>
 #include <vpu/utils/string.hpp>
 
@@ -80,6 +87,25 @@ static constexpr char api1_message[] =
                                              "Optional. Compile model to legacy format for usage in Inference Engine API,\n"
 "                                             by default compiles to OV 2.0 API";
 
+static constexpr char manifest_message[] =
+                                             "Optional. Path to the manifest file to compile many models. Each line of the file is\n"
+"                                             \"<model_xml> <device> [<config_file>]\", the lines starting with '#' are skipped.\n"
+"                                             The relative paths are relative to the manifest directory.\n"
+"                                             Replaces -m, -d and -c options, -o specifies the output directory.";
+
+static constexpr char jobs_message[] =
+                                             "Optional. Number of models of the manifest compiled in parallel. Default value: 1.";
+
+static constexpr char cache_dir_message[] =
+                                             "Optional. Compiles the models to the directory used by ov::Core with the CACHE_DIR property\n"
+"                                             instead of exporting them to the blobs. The models compiled without\n"
+"                                             the precision and layout options are cached as compiled from the model file.";
+
+static constexpr char cache_key_message[] =
+                                             "Optional. Cache entries filled with -cache_dir: \"path\" for the applications compiling\n"
+"                                             the model file by its absolute path, \"model\" for the applications reading\n"
+"                                             the model and compiling the read model. Default value: path.";
+
 // MYRIAD-specific
 static constexpr char number_of_shaves_message[] =
                                              "Optional. Specifies number of shaves.\n"
@@ -112,6 +138,10 @@ DEFINE_string(iml, "", inputs_model_layout_message);
 DEFINE_string(oml, "", outputs_model_layout_message);
 DEFINE_string(ioml, "", ioml_message);
 DEFINE_bool(ov_api_1_0, false, api1_message);
+DEFINE_string(manifest, "", manifest_message);
+DEFINE_int32(j, 1, jobs_message);
+DEFINE_string(cache_dir, "", cache_dir_message);
+DEFINE_string(cache_key, "path", cache_key_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
 DEFINE_string(VPU_TILING_CMX_LIMIT_KB, "", tiling_cmx_limit_message);
@@ -372,11 +402,16 @@ bool isFP32(const ov::element::Type& type) {
     return type == ov::element::f32;
 }
 
+bool hasDefaultIO(const std::string& device) {
+    return device.find("MYRIAD") != std::string::npos || device.find("VPUX") != std::string::npos;
+}
+
 static void setDefaultIO(ov::preprocess::PrePostProcessor& preprocessor,
+                         const std::string& device,
                          const std::vector<ov::Output<ov::Node>>& inputs,
                          const std::vector<ov::Output<ov::Node>>& outputs) {
-    const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
-    const bool isVPUX = FLAGS_d.find("VPUX") != std::string::npos;
+    const bool isMYRIAD = device.find("MYRIAD") != std::string::npos;
+    const bool isVPUX = device.find("VPUX") != std::string::npos;
 
     if (isMYRIAD) {
         for (size_t i = 0; i < inputs.size(); i++) {
@@ -402,6 +437,7 @@ static void setDefaultIO(ov::preprocess::PrePostProcessor& preprocessor,
 }
 
 void configurePrePostProcessing(std::shared_ptr<ov::Model>& model,
+    const std::string& device,
     const std::string& ip,
     const std::string& op,
     const std::string& iop,
@@ -414,7 +450,7 @@ void configurePrePostProcessing(std::shared_ptr<ov::Model>& model,
     auto preprocessor = ov::preprocess::PrePostProcessor(model);
     const auto inputs = model->inputs();
     const auto outputs = model->outputs();
-    setDefaultIO(preprocessor, inputs, outputs);
+    setDefaultIO(preprocessor, device, inputs, outputs);
 
     if (!ip.empty()) {
         auto type = getType(ip);
@@ -589,6 +625,10 @@ static void showUsage() {
     std::cout << "    -oml                         <value>     "   << outputs_model_layout_message << std::endl;
     std::cout << "    -ioml                       \"<value>\"    "   << ioml_message               << std::endl;
     std::cout << "    -ov_api_1_0                              "   << api1_message                 << std::endl;
+    std::cout << "    -manifest                    <value>     "   << manifest_message             << std::endl;
+    std::cout << "    -j                           <value>     "   << jobs_message                 << std::endl;
+    std::cout << "    -cache_dir                   <value>     "   << cache_dir_message            << std::endl;
+    std::cout << "    -cache_key                   <value>     "   << cache_key_message            << std::endl;
     std::cout                                                                                      << std::endl;
     std::cout << " MYRIAD-specific options:                    "                                   << std::endl;
     std::cout << "      -VPU_NUMBER_OF_SHAVES      <value>     "   << number_of_shaves_message     << std::endl;
@@ -605,12 +645,33 @@ static bool parseCommandLine(int* argc, char*** argv) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
-        throw std::invalid_argument("Path to model xml file is required");
+    if (!FLAGS_manifest.empty()) {
+        if (!FLAGS_m.empty() || !FLAGS_d.empty() || !FLAGS_c.empty()) {
+            throw std::invalid_argument("Model, device and configuration file are specified by the manifest");
+        }
+        if (FLAGS_ov_api_1_0) {
+            throw std::invalid_argument("Manifest is supported for OV 2.0 API only");
+        }
+    } else {
+        if (FLAGS_m.empty()) {
+            throw std::invalid_argument("Path to model xml file is required");
+        }
+
+        if (FLAGS_d.empty()) {
+            throw std::invalid_argument("Target device name is required");
+        }
     }
 
-    if (FLAGS_d.empty()) {
-        throw std::invalid_argument("Target device name is required");
+    if (FLAGS_j < 1) {
+        throw std::invalid_argument("Number of parallel jobs must be positive");
+    }
+
+    if (!FLAGS_cache_dir.empty() && FLAGS_ov_api_1_0) {
+        throw std::invalid_argument("Cache directory is supported for OV 2.0 API only");
+    }
+
+    if (FLAGS_cache_key != "path" && FLAGS_cache_key != "model") {
+        throw std::invalid_argument("Unknown cache key " + FLAGS_cache_key + ". Expected path or model");
     }
 
     if (1 < *argc) {
@@ -628,10 +689,10 @@ static bool parseCommandLine(int* argc, char*** argv) {
     return true;
 }
 
-static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
+static std::map<std::string, std::string> parseConfigFile(const std::string& path, char comment = '#') {
     std::map<std::string, std::string> config;
 
-    std::ifstream file(FLAGS_c);
+    std::ifstream file(path);
     if (file.is_open()) {
         std::string option;
         while (std::getline(file, option)) {
@@ -650,9 +711,9 @@ static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
     return config;
 }
 
-static std::map<std::string, std::string> configure() {
-    const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
-    auto config = parseConfigFile();
+static std::map<std::string, std::string> configure(const std::string& device, const std::string& configPath) {
+    const bool isMYRIAD = device.find("MYRIAD") != std::string::npos;
+    auto config = parseConfigFile(configPath);
 
     if (isMYRIAD) {
         if (!FLAGS_VPU_NUMBER_OF_SHAVES.empty()) {
@@ -733,6 +794,184 @@ std::string getFileNameFromPath(const std::string& path,
 
 using TimeDiff = std::chrono::milliseconds;
 
+struct CompileJob {
+    std::string model;
+    std::string device;
+    std::map<std::string, std::string> config;
+    // path of the exported blob, not used when the model is compiled to the cache directory
+    std::string output;
+};
+
+struct CompileResult {
+    TimeDiff time {0};
+    std::string error;
+};
+
+bool hasIOOptions() {
+    return !FLAGS_ip.empty() || !FLAGS_op.empty() || !FLAGS_iop.empty() ||
+           !FLAGS_il.empty() || !FLAGS_ol.empty() || !FLAGS_iol.empty() ||
+           !FLAGS_iml.empty() || !FLAGS_oml.empty() || !FLAGS_ioml.empty();
+}
+
+std::string getBlobName(const std::string& model, const std::string& device, const std::string& configPath) {
+    // the device may be HETERO:<devices> or MULTI:<devices>
+    std::string deviceName = device;
+    std::replace_if(deviceName.begin(), deviceName.end(), [](unsigned char c) { return !std::isalnum(c) && c != '_'; }, '_');
+    std::string blobName = getFileNameFromPath(fileNameNoExt(model)) + "_" + deviceName;
+    // the same model may be compiled for the device with the different configurations
+    if (!configPath.empty()) {
+        blobName += "_" + getFileNameFromPath(fileNameNoExt(configPath));
+    }
+    return blobName + ".blob";
+}
+
+std::string resolvePath(const std::string& directory, const std::string& path) {
+    const bool absolute = path[0] == '/' || path[0] == '\\' || (path.size() > 1 && path[1] == ':');
+    return directory.empty() || absolute ? path : directory + "/" + path;
+}
+
+std::vector<CompileJob> parseManifest(const std::string& path, const std::string& outputDir, char comment = '#') {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::invalid_argument("Manifest file " + path + " can't be opened");
+    }
+
+    // the relative paths of the models and the configuration files are relative to the manifest
+    const auto separatorPos = path.find_last_of("/\\");
+    const std::string manifestDir = separatorPos == std::string::npos ? "" : path.substr(0, separatorPos);
+
+    std::vector<CompileJob> jobs;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        CompileJob job;
+        std::string configPath;
+        if (!(fields >> job.model) || job.model[0] == comment) {
+            continue;
+        }
+        if (!(fields >> job.device)) {
+            throw std::invalid_argument("Invalid manifest line " + line + ". Expected <model_xml> <device> [<config_file>]");
+        }
+        job.model = resolvePath(manifestDir, job.model);
+        if (fields >> configPath) {
+            configPath = resolvePath(manifestDir, configPath);
+        }
+        job.config = configure(job.device, configPath);
+        job.output = getBlobName(job.model, job.device, configPath);
+        if (!outputDir.empty()) {
+            job.output = outputDir + "/" + job.output;
+        }
+        jobs.push_back(std::move(job));
+    }
+    return jobs;
+}
+
+// The jobs compiled in parallel must not write the same blob
+void checkOutputs(const std::vector<CompileJob>& jobs) {
+    std::map<std::string, const CompileJob*> jobsByOutput;
+    for (const auto& job : jobs) {
+        const auto it = jobsByOutput.emplace(job.output, &job);
+        if (!it.second) {
+            throw std::invalid_argument("Manifest lines of " + it.first->second->model + " and " + job.model +
+                                        " are exported to the same blob " + job.output);
+        }
+    }
+}
+
+TimeDiff compileModel(ov::Core& core, const CompileJob& job, bool printInfo) {
+    const auto config = ov::AnyMap{job.config.begin(), job.config.end()};
+    ov::CompiledModel compiledModel;
+    std::chrono::steady_clock::time_point timeBeforeLoadNetwork;
+    if (!FLAGS_cache_dir.empty() && FLAGS_cache_key == "path" && !hasIOOptions() && !hasDefaultIO(job.device)) {
+        // the same cache entry as the applications compiling the model file by its absolute path get
+        timeBeforeLoadNetwork = std::chrono::steady_clock::now();
+        compiledModel = core.compile_model(job.model, job.device, config);
+    } else {
+        auto model = core.read_model(job.model);
+        configurePrePostProcessing(model, job.device, FLAGS_ip, FLAGS_op, FLAGS_iop, FLAGS_il, FLAGS_ol, FLAGS_iol, FLAGS_iml, FLAGS_oml, FLAGS_ioml);
+        if (printInfo) {
+            printInputAndOutputsInfoShort(*model);
+        }
+        timeBeforeLoadNetwork = std::chrono::steady_clock::now();
+        compiledModel = core.compile_model(model, job.device, config);
+    }
+    const auto loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
+
+    if (FLAGS_cache_dir.empty()) {
+        std::ofstream outputFile{job.output, std::ios::out | std::ios::binary};
+        if (!outputFile.is_open()) {
+            throw std::runtime_error("Output file " + job.output + " can't be opened for writing");
+        }
+        compiledModel.export_model(outputFile);
+    }
+    return loadNetworkTimeElapsed;
+}
+
+void checkCachingSupport(ov::Core& core, const std::vector<CompileJob>& jobs) {
+    std::set<std::string> devices;
+    for (const auto& job : jobs) {
+        devices.insert(job.device);
+    }
+    for (const auto& device : devices) {
+        try {
+            const auto capabilities = core.get_property(device, ov::device::capabilities);
+            if (std::find(capabilities.begin(), capabilities.end(), ov::device::capability::EXPORT_IMPORT) == capabilities.end()) {
+                std::cout << "[ WARNING ] " << device << " doesn't support import and export, its models are not cached" << std::endl;
+            }
+        } catch (...) {
+            // the virtual devices report the capabilities of the underlying devices
+        }
+    }
+}
+
+// Compiles the jobs by the bounded number of threads sharing the core, the core is thread safe.
+// Returns the number of the failed jobs.
+size_t compileModels(ov::Core& core, const std::vector<CompileJob>& jobs, size_t jobsNum) {
+    std::vector<CompileResult> results(jobs.size());
+    std::atomic<size_t> nextJob {0};
+    std::mutex printMutex;
+    auto worker = [&] {
+        for (size_t i = nextJob++; i < jobs.size(); i = nextJob++) {
+            try {
+                results[i].time = compileModel(core, jobs[i], false);
+            } catch (const std::exception& error) {
+                results[i].error = error.what();
+            } catch (...) {
+                results[i].error = "Unknown/internal exception happened.";
+            }
+
+            std::lock_guard<std::mutex> lock(printMutex);
+            std::cout << "[" << i + 1 << "/" << jobs.size() << "] " << jobs[i].model << " " << jobs[i].device << ": "
+                      << (results[i].error.empty() ? "done" : "failed") << std::endl;
+        }
+    };
+
+    const auto timeBeforeCompilation = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < std::min(jobsNum, jobs.size()); i++) {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto totalTime = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeCompilation);
+
+    size_t failed = 0;
+    std::cout << std::endl << "Compilation report:" << std::endl;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        std::cout << "    " << jobs[i].model << " : " << jobs[i].device << " : ";
+        if (results[i].error.empty()) {
+            std::cout << results[i].time.count() << " ms" << std::endl;
+        } else {
+            std::cout << "FAILED: " << results[i].error << std::endl;
+            failed++;
+        }
+    }
+    std::cout << "Compiled " << jobs.size() - failed << " of " << jobs.size() << " models by " << std::min(jobsNum, jobs.size())
+              << " jobs in " << totalTime.count() << " ms" << std::endl;
+    return failed;
+}
+
 int main(int argc, char* argv[]) {
     TimeDiff loadNetworkTimeElapsed {0};
 
@@ -762,7 +1001,7 @@ int main(int argc, char* argv[]) {
             printInputAndOutputsInfo(network);
 
             auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
-            auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure());
+            auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure(FLAGS_d, FLAGS_c));
             loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
 
             std::string outputName = FLAGS_o;
@@ -779,31 +1018,44 @@ int main(int argc, char* argv[]) {
             }
         } else {
             ov::Core core;
+            if (!FLAGS_cache_dir.empty()) {
+                core.set_property(ov::cache_dir(FLAGS_cache_dir));
+            }
+
+            std::vector<CompileJob> jobs;
+            if (FLAGS_manifest.empty()) {
+                CompileJob job;
+                job.model = FLAGS_m;
+                job.device = FLAGS_d;
+                job.config = configure(FLAGS_d, FLAGS_c);
+                job.output = FLAGS_o.empty() ? getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob" : FLAGS_o;
+                jobs.push_back(std::move(job));
+            } else {
+                jobs = parseManifest(FLAGS_manifest, FLAGS_o);
+                if (FLAGS_cache_dir.empty()) {
+                    checkOutputs(jobs);
+                    ov::util::create_directory_recursive(FLAGS_o);
+                }
+            }
+
             if (!FLAGS_log_level.empty()) {
                 ov::log::Level level;
                 std::stringstream{FLAGS_log_level} >> level;
-                core.set_property(FLAGS_d, ov::log::level(level));
+                std::set<std::string> devices;
+                for (const auto& job : jobs) {
+                    if (devices.insert(job.device).second) {
+                        core.set_property(job.device, ov::log::level(level));
+                    }
+                }
             }
-
-            auto model = core.read_model(FLAGS_m);
-
-            configurePrePostProcessing(model, FLAGS_ip, FLAGS_op, FLAGS_iop, FLAGS_il, FLAGS_ol, FLAGS_iol, FLAGS_iml, FLAGS_oml, FLAGS_ioml);
-            printInputAndOutputsInfoShort(*model);
-            auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
-            auto configs = configure();
-            auto compiledModel = core.compile_model(model, FLAGS_d, {configs.begin(), configs.end()});
-            loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
-            std::string outputName = FLAGS_o;
-            if (outputName.empty()) {
-                outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
+            if (!FLAGS_cache_dir.empty()) {
+                checkCachingSupport(core, jobs);
             }
 
-            std::ofstream outputFile{outputName, std::ios::out | std::ios::binary};
-            if (!outputFile.is_open()) {
-                std::cout << "Output file " << outputName << " can't be opened for writing" << std::endl;
-                return EXIT_FAILURE;
+            if (FLAGS_manifest.empty()) {
+                loadNetworkTimeElapsed = compileModel(core, jobs.front(), true);
             } else {
-                compiledModel.export_model(outputFile);
+                return compileModels(core, jobs, static_cast<size_t>(FLAGS_j)) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
             }
         }
     } catch (const std::exception& error) {